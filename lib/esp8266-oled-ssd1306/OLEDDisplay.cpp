@@ -775,6 +775,36 @@ bool OLEDDisplay::getChangedBoundingBox(
   // holdes true for all values of pos
   return (minBoundY != (uint8_t)(~0));
 }
+
+bool OLEDDisplay::getChangedPageRange(
+  uint8_t page,
+  uint8_t& minBoundX,
+  uint8_t& maxBoundX)
+{
+  const uint8_t x_maxindex = this->width();
+  const uint16_t offset = page * x_maxindex;
+  const uint8_t* buf = buffer + offset;
+  uint8_t* back_buf = buffer_back + offset;
+
+  if (memcmp(buf, back_buf, x_maxindex) == 0) {
+    return false;
+  }
+
+  uint8_t x = 0;
+  while (buf[x] == back_buf[x]) {
+    ++x;
+  }
+  minBoundX = x;
+
+  x = x_maxindex - 1;
+  while (buf[x] == back_buf[x]) {
+    --x;
+  }
+  maxBoundX = x;
+
+  memcpy(back_buf + minBoundX, buf + minBoundX, maxBoundX - minBoundX + 1);
+  return true;
+}
 #endif
 
 
@@ -255,6 +255,9 @@ class OLEDDisplay : public Print {
 
     #ifdef OLEDDISPLAY_DOUBLE_BUFFER
     uint8_t            *buffer_back = NULL;
+
+    // Nr of display data bytes sent by the last call to display()
+    uint16_t            lastDisplayBytes = 0;
     #endif
 
   protected:
@@ -267,6 +270,14 @@ class OLEDDisplay : public Print {
       uint8_t& minBoundY, 
       uint8_t& maxBoundX, 
       uint8_t& maxBoundY);
+
+    // Get the range of changed columns in a single page (8 pixel rows)
+    // and copy these to buffer_back.
+    // @retval True when there have been pixels changed in this page
+    bool getChangedPageRange(
+      uint8_t page,
+      uint8_t& minBoundX,
+      uint8_t& maxBoundX);
 #endif
 
 
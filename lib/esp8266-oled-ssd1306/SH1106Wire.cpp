@@ -14,17 +14,23 @@
 
     void SH1106Wire::display(void) {
       #ifdef OLEDDISPLAY_DOUBLE_BUFFER
-        uint8_t minBoundX, minBoundY, maxBoundX, maxBoundY;
-        if (!getChangedBoundingBox(minBoundX, minBoundY, maxBoundX, maxBoundY))
-          return;
+        // Page addressing mode, so only send the changed columns per page (8 pixel rows)
+        const uint8_t pages = this->height() / 8;
 
-
-        // Calculate the colum offset
-        uint8_t minBoundXp2H = (minBoundX + 2) & 0x0F;
-        uint8_t minBoundXp2L = 0x10 | ((minBoundX + 2) >> 4 );
+        lastDisplayBytes = 0;
 
         uint8_t k = 0;
-        for (uint8_t y = minBoundY; y <= maxBoundY; y++) {
+        for (uint8_t y = 0; y < pages; y++) {
+          uint8_t minBoundX, maxBoundX;
+          if (!getChangedPageRange(y, minBoundX, maxBoundX))
+            continue;
+
+          // Calculate the colum offset
+          uint8_t minBoundXp2H = (minBoundX + 2) & 0x0F;
+          uint8_t minBoundXp2L = 0x10 | ((minBoundX + 2) >> 4 );
+
+          lastDisplayBytes += maxBoundX - minBoundX + 1;
+
           sendCommand(0xB0 + y);
           sendCommand(minBoundXp2H);
           sendCommand(minBoundXp2L);
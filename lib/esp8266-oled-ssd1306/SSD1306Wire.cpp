@@ -15,37 +15,67 @@
     void SSD1306Wire::display(void) {
       const int x_offset = (128 - this->width()) / 2;
       #ifdef OLEDDISPLAY_DOUBLE_BUFFER
-        uint8_t minBoundX, minBoundY, maxBoundX, maxBoundY;
-        if (!getChangedBoundingBox(minBoundX, minBoundY, maxBoundX, maxBoundY))
-          return;
+        // Only send the changed columns per page (8 pixel rows).
+        // Consecutive changed pages are sent as a single block, using the combined column range,
+        // as setting the column/page address costs about as much as sending 16 data bytes.
+        constexpr uint8_t maxPages = 8;
+        const uint8_t pages = _min(this->height() / 8, maxPages);
+        uint8_t minX[maxPages];
+        uint8_t maxX[maxPages];
+        bool changed[maxPages];
 
-        sendCommand(COLUMNADDR);
-        sendCommand(x_offset + minBoundX);
-        sendCommand(x_offset + maxBoundX);
+        lastDisplayBytes = 0;
 
-        sendCommand(PAGEADDR);
-        sendCommand(minBoundY);
-        sendCommand(maxBoundY);
+        for (uint8_t y = 0; y < pages; y++) {
+          changed[y] = getChangedPageRange(y, minX[y], maxX[y]);
+        }
 
-        uint8_t k = 0;
-        for (uint8_t y = minBoundY; y <= maxBoundY; y++) {
-          for (uint8_t x = minBoundX; x <= maxBoundX; x++) {
-            if (k == 0) {
-              Wire.beginTransmission(_address);
-              Wire.write(0x40);
-            }
-            Wire.write(buffer[x + y * this->width()]);
-            k++;
-            if (k == 16)  {
-              Wire.endTransmission();
-              k = 0;
+        uint8_t y = 0;
+        while (y < pages) {
+          if (!changed[y]) {
+            ++y;
+            continue;
+          }
+          const uint8_t minBoundY = y;
+          uint8_t minBoundX = minX[y];
+          uint8_t maxBoundX = maxX[y];
+          while ((y + 1 < pages) && changed[y + 1]) {
+            ++y;
+            minBoundX = _min(minBoundX, minX[y]);
+            maxBoundX = _max(maxBoundX, maxX[y]);
+          }
+          const uint8_t maxBoundY = y;
+          ++y;
+
+          sendCommand(COLUMNADDR);
+          sendCommand(x_offset + minBoundX);
+          sendCommand(x_offset + maxBoundX);
+
+          sendCommand(PAGEADDR);
+          sendCommand(minBoundY);
+          sendCommand(maxBoundY);
+
+          uint8_t k = 0;
+          for (uint8_t page = minBoundY; page <= maxBoundY; page++) {
+            for (uint8_t x = minBoundX; x <= maxBoundX; x++) {
+              if (k == 0) {
+                Wire.beginTransmission(_address);
+                Wire.write(0x40);
+              }
+              Wire.write(buffer[x + page * this->width()]);
+              k++;
+              if (k == 16)  {
+                Wire.endTransmission();
+                k = 0;
+              }
             }
+            lastDisplayBytes += maxBoundX - minBoundX + 1;
+            yield();
           }
-          yield();
-        }
 
-        if (k != 0) {
-          Wire.endTransmission();
+          if (k != 0) {
+            Wire.endTransmission();
+          }
         }
       #else
 
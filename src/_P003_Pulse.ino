@@ -208,6 +208,11 @@ boolean Plugin_003(uint8_t function, struct EventStruct *event, String& string)
 
       addFormCheckBox(F("Ignore multiple Delta = 0"), F("nozero"), PCONFIG(P003_IDX_IGNORE_ZERO));
 
+      # if FEATURE_PULSE_PCNT
+      addFormCheckBox(F("Use Hardware Counter (PCNT)"), F("pcnt"), PCONFIG(P003_IDX_USE_PCNT));
+      addFormNote(F("Only for Edge Mode Types with Debounce Time 0. Otherwise the GPIO interrupt is used."));
+      # endif // if FEATURE_PULSE_PCNT
+
       success = true;
       break;
     }
@@ -218,6 +223,9 @@ boolean Plugin_003(uint8_t function, struct EventStruct *event, String& string)
       PCONFIG(P003_IDX_COUNTERTYPE)  = getFormItemInt(F("countertype"));
       PCONFIG(P003_IDX_MODETYPE)     = getFormItemInt(F("raisetype"));
       PCONFIG(P003_IDX_IGNORE_ZERO)  = isFormItemChecked(F("nozero"));
+      # if FEATURE_PULSE_PCNT
+      PCONFIG(P003_IDX_USE_PCNT) = isFormItemChecked(F("pcnt"));
+      # endif // if FEATURE_PULSE_PCNT
       success                        = true;
       break;
     }
@@ -230,6 +238,9 @@ boolean Plugin_003(uint8_t function, struct EventStruct *event, String& string)
       config.taskIndex        = event->TaskIndex;
       config.interruptPinMode = static_cast<Internal_GPIO_pulseHelper::GPIOtriggerMode>(PCONFIG(P003_IDX_MODETYPE));
       config.pullupPinMode    = Settings.TaskDevicePin1PullUp[event->TaskIndex] ? INPUT_PULLUP : INPUT;
+      # if FEATURE_PULSE_PCNT
+      config.usePCNT = PCONFIG(P003_IDX_USE_PCNT);
+      # endif // if FEATURE_PULSE_PCNT
 
       // FIXME TD-er: Must set the state using globalMapPortStatus
 
@@ -43,6 +43,9 @@
 // Can only be used for a single instance of this plugin and a single sensor.
 # define P004_SCAN_ON_INIT       PCONFIG(3)
 
+// Start conversion of all sensors on the bus at once, shared with other tasks on the same GPIO pin.
+# define P004_SHARED_CONVERSION  PCONFIG(4)
+
 
 boolean Plugin_004(uint8_t function, struct EventStruct *event, String& string)
 {
@@ -131,6 +134,8 @@ boolean Plugin_004(uint8_t function, struct EventStruct *event, String& string)
       if (validGpio(Plugin_004_DallasPin_RX) && validGpio(Plugin_004_DallasPin_TX)) {
         addFormCheckBox(F("Auto Select Sensor"), F("autoselect"), P004_SCAN_ON_INIT, valueCount > 1);
         addFormNote(F("Auto Select can only be used for 1 Dallas sensor per GPIO pin."));
+        addFormCheckBox(F("Shared Bus Conversion"), F("sharedconv"), P004_SHARED_CONVERSION);
+        addFormNote(F("Start measurement of all sensors on this GPIO pin at once, shared with other tasks using the same pin."));
         Dallas_addr_selector_webform_load(event->TaskIndex, Plugin_004_DallasPin_RX, Plugin_004_DallasPin_TX, valueCount);
 
         {
@@ -192,6 +197,8 @@ boolean Plugin_004(uint8_t function, struct EventStruct *event, String& string)
               addEnabled(false);
               addHtml(F("&nbsp;Too Slow! Reduce pull-up resistance"));
             }
+            Dallas_show_bus_stats_webform_load(Plugin_004_DallasPin_RX);
+
             for (uint8_t i = 0; i < valueCount; ++i) {
               addFormSeparator(2);
               Dallas_show_sensor_stats_webform_load(P004_data->get_sensor_data(i));
@@ -227,6 +234,7 @@ boolean Plugin_004(uint8_t function, struct EventStruct *event, String& string)
         Dallas_setResolution(savedAddress, res, Plugin_004_DallasPin_RX, Plugin_004_DallasPin_TX);
       }
       P004_SCAN_ON_INIT       = isFormItemChecked(F("autoselect"));
+      P004_SHARED_CONVERSION  = isFormItemChecked(F("sharedconv"));
       P004_ERROR_STATE_OUTPUT = getFormItemInt(F("err"));
       success                 = true;
       break;
@@ -291,7 +299,8 @@ boolean Plugin_004(uint8_t function, struct EventStruct *event, String& string)
                              Plugin_004_DallasPin_RX,
                              Plugin_004_DallasPin_TX,
                              res,
-                             valueCount == 1 && P004_SCAN_ON_INIT));
+                             valueCount == 1 && P004_SCAN_ON_INIT,
+                             P004_SHARED_CONVERSION));
       }
       P004_data_struct *P004_data =
         static_cast<P004_data_struct *>(getPluginTaskData(event->TaskIndex));
@@ -593,6 +593,15 @@ boolean Plugin_036(uint8_t function, struct EventStruct *event, String& string)
         }
       }
 
+# if P036_FEATURE_DISPLAY_STATS
+      {
+        P036_data_struct *P036_data = static_cast<P036_data_struct *>(getPluginTaskData(event->TaskIndex));
+
+        if (nullptr != P036_data) {
+          P036_data->web_show_stats();
+        }
+      }
+# endif // if P036_FEATURE_DISPLAY_STATS
 # ifdef P036_CHECK_HEAP
       P036_CheckHeap(F("_LOAD: Before exit"));
 # endif // P036_CHECK_HEAP
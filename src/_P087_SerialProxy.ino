@@ -119,6 +119,9 @@ boolean Plugin_087(uint8_t function, struct EventStruct *event, String& string)
         uint8_t varNr = VARS_PER_TASK;
         pluginWebformShowValue(event->TaskIndex, varNr++, F("Success"),     String(success));
         pluginWebformShowValue(event->TaskIndex, varNr++, F("Error"),       String(error));
+        # if FEATURE_SERIAL_FRAME_READER
+        pluginWebformShowValue(event->TaskIndex, varNr++, F("Dropped Frames"), String(P087_data->getDroppedFrames()));
+        # endif // if FEATURE_SERIAL_FRAME_READER
         pluginWebformShowValue(event->TaskIndex, varNr++, F("Length Last"), String(length_last), true);
 
         // success = true;
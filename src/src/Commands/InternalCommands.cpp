@@ -327,6 +327,9 @@ bool InternalCommands::executeInternalCommand()
     case ESPEasy_cmd_e::hiddenssid:                 COMMAND_CASE_R(Command_Wifi_HiddenSSID, 1);              // wifi.h
 #endif
     case ESPEasy_cmd_e::i2cscanner:                 COMMAND_CASE_R(Command_i2c_Scanner, -1);                 // i2c.h
+#if FEATURE_I2C_BUS_SCHEDULER
+    case ESPEasy_cmd_e::i2cstatsreset:              COMMAND_CASE_A(Command_i2c_StatsReset, 0);               // i2c.h
+#endif // if FEATURE_I2C_BUS_SCHEDULER
     case ESPEasy_cmd_e::inc:                        COMMAND_CASE_A(Command_Rules_Inc,   -1);                 // Rules.h
     case ESPEasy_cmd_e::ip:                         COMMAND_CASE_R(Command_IP,           1);                 // Network Command
 #if FEATURE_USE_IPV6
@@ -90,6 +90,9 @@ const char Internal_commands_fghij[] PROGMEM =
   "hiddenssid|"
 #endif
   "i2cscanner|"
+#if FEATURE_I2C_BUS_SCHEDULER
+  "i2cstatsreset|"
+#endif // if FEATURE_I2C_BUS_SCHEDULER
   "inc|"
   "ip|"
 #if FEATURE_USE_IPV6
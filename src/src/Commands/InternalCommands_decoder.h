@@ -66,6 +66,9 @@ enum class ESPEasy_cmd_e : uint8_t {
 #endif
 
   i2cscanner,
+#if FEATURE_I2C_BUS_SCHEDULER
+  i2cstatsreset,
+#endif // if FEATURE_I2C_BUS_SCHEDULER
   inc,
   ip,
 #if FEATURE_USE_IPV6
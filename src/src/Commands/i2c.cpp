@@ -7,6 +7,7 @@
 #include "../Globals/Settings.h"
 
 #include "../Helpers/Hardware_I2C.h"
+#include "../Helpers/I2C_BusScheduler.h"
 #include "../Helpers/StringConverter.h"
 
 #include "../../ESPEasy_common.h"
@@ -70,3 +71,12 @@ const __FlashStringHelper* Command_i2c_Scanner(struct EventStruct *event, const
   I2CSelectHighClockSpeed(0); // By default the bus is in standard speed
   return return_see_serial(event);
 }
+
+#if FEATURE_I2C_BUS_SCHEDULER
+const __FlashStringHelper* Command_i2c_StatsReset(struct EventStruct *event, const char *Line)
+{
+  I2C_clearBusStats();
+  return return_command_success_flashstr();
+}
+
+#endif // if FEATURE_I2C_BUS_SCHEDULER
@@ -10,4 +10,9 @@ void i2c_scanI2Cbus(bool    dbg,
 const __FlashStringHelper* Command_i2c_Scanner(struct EventStruct *event,
                                                const char         *Line);
 
+#if FEATURE_I2C_BUS_SCHEDULER
+const __FlashStringHelper* Command_i2c_StatsReset(struct EventStruct *event,
+                                                  const char         *Line);
+#endif // if FEATURE_I2C_BUS_SCHEDULER
+
 #endif // COMMAND_I2C_H
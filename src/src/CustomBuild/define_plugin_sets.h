@@ -4463,6 +4463,62 @@ To create/register a plugin, you have to :
 #endif
 #endif
 
+#ifndef FEATURE_I2C_BUS_SCHEDULER
+  #ifdef LIMIT_BUILD_SIZE
+    #define FEATURE_I2C_BUS_SCHEDULER 0
+  #else
+    #define FEATURE_I2C_BUS_SCHEDULER 1
+  #endif
+#endif
+
+#ifndef FEATURE_ADC_CONTINUOUS
+  #if defined(ESP32) && ESP_IDF_VERSION_MAJOR >= 5 && defined(SOC_ADC_DMA_SUPPORTED) && SOC_ADC_DMA_SUPPORTED && !defined(LIMIT_BUILD_SIZE)
+    #define FEATURE_ADC_CONTINUOUS 1
+  #else
+    #define FEATURE_ADC_CONTINUOUS 0
+  #endif
+#endif
+
+#ifndef FEATURE_PULSE_PCNT
+  #if defined(ESP32) && ESP_IDF_VERSION_MAJOR >= 5 && defined(SOC_PCNT_SUPPORTED) && SOC_PCNT_SUPPORTED && !defined(LIMIT_BUILD_SIZE)
+    #define FEATURE_PULSE_PCNT 1
+  #else
+    #define FEATURE_PULSE_PCNT 0
+  #endif
+#endif
+
+#ifndef FEATURE_SERIAL_FRAME_READER
+  #ifdef LIMIT_BUILD_SIZE
+    #define FEATURE_SERIAL_FRAME_READER 0
+  #else
+    #define FEATURE_SERIAL_FRAME_READER 1
+  #endif
+#endif
+
+#ifndef FEATURE_TIMING_STATS_HISTOGRAM
+  #if FEATURE_TIMING_STATS && !defined(LIMIT_BUILD_SIZE)
+    #define FEATURE_TIMING_STATS_HISTOGRAM 1
+  #else
+    #define FEATURE_TIMING_STATS_HISTOGRAM 0
+  #endif
+#endif
+
+#ifndef FEATURE_SETTINGS_READ_BATCH
+  #define FEATURE_SETTINGS_READ_BATCH 1
+#endif
+
+#ifndef FEATURE_SETTINGS_DELTA_SAVE
+  #define FEATURE_SETTINGS_DELTA_SAVE 1
+#endif
+
+#ifndef FEATURE_JSON_CBOR
+  #if defined(LIMIT_BUILD_SIZE) || !defined(WEBSERVER_JSON)
+    #define FEATURE_JSON_CBOR 0
+  #else
+    #define FEATURE_JSON_CBOR 1
+  #endif
+#endif
+
 #ifndef FEATURE_COLORIZE_CONSOLE_LOGS
 #ifdef LIMIT_BUILD_SIZE
 #define FEATURE_COLORIZE_CONSOLE_LOGS 0
@@ -8,6 +8,9 @@
 
 #include "../Helpers/ESPEasy_Storage.h"
 #include "../Helpers/StringConverter.h"
+#ifdef WEBSERVER_METRICS
+# include "../WebServer/Metrics.h"
+#endif // ifdef WEBSERVER_METRICS
 
 #ifdef PLUGIN_USES_SERIAL
 # include <ESPeasySerial.h>
@@ -30,6 +33,9 @@ void Caches::clearAllTaskCaches() {
   taskIndexValueName.clear();
   extraTaskSettings_cache.clear();
   updateActiveTaskUseSerial0();
+  #ifdef WEBSERVER_METRICS
+  metrics_clearSeriesCache();
+  #endif // ifdef WEBSERVER_METRICS
 }
 
 void Caches::clearTaskCache(taskIndex_t TaskIndex) {
@@ -41,6 +47,9 @@ void Caches::clearTaskCache(taskIndex_t TaskIndex) {
     extraTaskSettings_cache.erase(it);
   }
   updateActiveTaskUseSerial0();
+  #ifdef WEBSERVER_METRICS
+  metrics_clearSeriesCache(TaskIndex);
+  #endif // ifdef WEBSERVER_METRICS
 }
 
 void Caches::clearFileCaches()
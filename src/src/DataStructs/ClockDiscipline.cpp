@@ -0,0 +1,87 @@
+#include "../DataStructs/ClockDiscipline.h"
+
+
+bool ClockDiscipline::processOffset(int64_t offset_usec, uint64_t systemMicros, bool updateDrift)
+{
+  if (updateDrift && (_lastMeasurement_usec != 0)) {
+    const int64_t interval_usec = static_cast<int64_t>(systemMicros - _lastMeasurement_usec);
+
+    if (interval_usec >= CLOCK_DISCIPLINE_MIN_INTERVAL_USEC) {
+      // The offset still to be slewed in was already known at the previous measurement.
+      // Only the remaining part was caused by the frequency error since then.
+      const float freqError_ppm =
+        static_cast<float>(offset_usec - _slewRemaining_usec) * 1e6f /
+        static_cast<float>(interval_usec);
+
+      // Ignore implausible values, e.g. when the time source was changed
+      if ((freqError_ppm < (2 * CLOCK_DISCIPLINE_MAX_DRIFT_PPM)) &&
+          (freqError_ppm > (-2 * CLOCK_DISCIPLINE_MAX_DRIFT_PPM))) {
+        setDrift_ppm(_drift_ppm + CLOCK_DISCIPLINE_FLL_GAIN * freqError_ppm);
+      }
+    }
+  }
+
+  if (updateDrift) {
+    _lastMeasurement_usec = systemMicros;
+  }
+
+  if ((offset_usec > CLOCK_DISCIPLINE_STEP_THRESHOLD_USEC) ||
+      (offset_usec < -CLOCK_DISCIPLINE_STEP_THRESHOLD_USEC)) {
+    return true;
+  }
+
+  // The new offset already includes what was not yet slewed in.
+  _slewRemaining_usec = offset_usec;
+  return false;
+}
+
+void ClockDiscipline::timeStepped(uint64_t systemMicros, bool updateDrift)
+{
+  _slewRemaining_usec  = 0;
+  _lastCorrection_usec = systemMicros;
+
+  // Only use the new time as reference for the next drift estimate when it is accurate.
+  _lastMeasurement_usec = updateDrift ? systemMicros : 0;
+}
+
+int64_t ClockDiscipline::getCorrection(uint64_t systemMicros)
+{
+  if ((_lastCorrection_usec == 0) || (systemMicros <= _lastCorrection_usec)) {
+    _lastCorrection_usec = systemMicros;
+    return 0;
+  }
+  const int64_t elapsed_usec = static_cast<int64_t>(systemMicros - _lastCorrection_usec);
+
+  _lastCorrection_usec = systemMicros;
+
+  // Drift compensation
+  _driftRemainder_usec += static_cast<float>(elapsed_usec) * _drift_ppm / 1e6f;
+  int64_t correction = static_cast<int64_t>(_driftRemainder_usec);
+
+  _driftRemainder_usec -= static_cast<float>(correction);
+
+  // Slew in the remaining offset
+  if (_slewRemaining_usec != 0) {
+    const int64_t maxSlew = (elapsed_usec * CLOCK_DISCIPLINE_MAX_SLEW_PPM) / 1000000ll;
+    int64_t slew          = _slewRemaining_usec;
+
+    if (slew > maxSlew) {
+      slew = maxSlew;
+    } else if (slew < -maxSlew) {
+      slew = -maxSlew;
+    }
+    _slewRemaining_usec -= slew;
+    correction          += slew;
+  }
+  return correction;
+}
+
+void ClockDiscipline::setDrift_ppm(float drift_ppm)
+{
+  if (drift_ppm > CLOCK_DISCIPLINE_MAX_DRIFT_PPM) {
+    drift_ppm = CLOCK_DISCIPLINE_MAX_DRIFT_PPM;
+  } else if (drift_ppm < -CLOCK_DISCIPLINE_MAX_DRIFT_PPM) {
+    drift_ppm = -CLOCK_DISCIPLINE_MAX_DRIFT_PPM;
+  }
+  _drift_ppm = drift_ppm;
+}
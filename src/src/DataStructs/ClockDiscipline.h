@@ -0,0 +1,82 @@
+#ifndef DATASTRUCTS_CLOCKDISCIPLINE_H
+#define DATASTRUCTS_CLOCKDISCIPLINE_H
+
+#include "../../ESPEasy_common.h"
+
+/*********************************************************************************************\
+* ClockDiscipline
+* Keep the system time close to an external time source without stepping the time.
+*
+* - Small offsets reported by a time source are not applied at once,
+*   but slewed in at most CLOCK_DISCIPLINE_MAX_SLEW_PPM of the elapsed time.
+*   The system time thus never jumps and never runs backwards.
+* - The frequency error of the local oscillator (drift) is estimated from
+*   the offsets between consecutive time syncs (FLL) and compensated continuously.
+* - Offsets larger than CLOCK_DISCIPLINE_STEP_THRESHOLD_USEC are still applied as a step.
+\*********************************************************************************************/
+
+#ifndef CLOCK_DISCIPLINE_STEP_THRESHOLD_USEC
+# define CLOCK_DISCIPLINE_STEP_THRESHOLD_USEC  128000 // Same as ntpd
+#endif // ifndef CLOCK_DISCIPLINE_STEP_THRESHOLD_USEC
+
+#ifndef CLOCK_DISCIPLINE_MAX_SLEW_PPM
+# define CLOCK_DISCIPLINE_MAX_SLEW_PPM         500
+#endif // ifndef CLOCK_DISCIPLINE_MAX_SLEW_PPM
+
+#ifndef CLOCK_DISCIPLINE_MAX_DRIFT_PPM
+# define CLOCK_DISCIPLINE_MAX_DRIFT_PPM        300
+#endif // ifndef CLOCK_DISCIPLINE_MAX_DRIFT_PPM
+
+// Min. time between offset measurements to update the drift estimate
+#ifndef CLOCK_DISCIPLINE_MIN_INTERVAL_USEC
+# define CLOCK_DISCIPLINE_MIN_INTERVAL_USEC    60000000ll
+#endif // ifndef CLOCK_DISCIPLINE_MIN_INTERVAL_USEC
+
+// Fraction of the measured frequency error added to the drift estimate
+#ifndef CLOCK_DISCIPLINE_FLL_GAIN
+# define CLOCK_DISCIPLINE_FLL_GAIN             0.5f
+#endif // ifndef CLOCK_DISCIPLINE_FLL_GAIN
+
+class ClockDiscipline {
+public:
+
+  // Process the offset between an external time source and the system time.
+  // @param offset_usec      Offset to add to the system time to get the time of the external time source
+  // @param systemMicros     Moment of the measurement
+  // @param updateDrift      Whether the time source is accurate enough to estimate the drift
+  // @retval true when the offset must be applied as a step, followed by a call to timeStepped().
+  bool processOffset(int64_t  offset_usec,
+                     uint64_t systemMicros,
+                     bool     updateDrift);
+
+  // Call when the time was set by other means than processOffset(),
+  // e.g. manually or when processOffset() returned true.
+  void timeStepped(uint64_t systemMicros,
+                   bool     updateDrift);
+
+  // Correction to add to the Unix time offset for the time passed since the last call.
+  int64_t getCorrection(uint64_t systemMicros);
+
+  float getDrift_ppm() const {
+    return _drift_ppm;
+  }
+
+  void setDrift_ppm(float drift_ppm);
+
+  // Part of the offset which has not yet been slewed in.
+  int64_t getRemainingSlew_usec() const {
+    return _slewRemaining_usec;
+  }
+
+private:
+
+  int64_t  _slewRemaining_usec{};
+  uint64_t _lastCorrection_usec{};
+  uint64_t _lastMeasurement_usec{};
+  float    _drift_ppm{};
+
+  // Sub-usec part of the drift correction, carried over to the next call
+  float _driftRemainder_usec{};
+};
+
+#endif // ifndef DATASTRUCTS_CLOCKDISCIPLINE_H
@@ -27,6 +27,7 @@ bool LogBuffer::getNext(LogDestination logDestination, uint32_t& timestamp, Stri
       message   = LogEntries[pos].getMessage();
       loglevel  = LogEntries[pos].getLogLevel();
       LogEntries[pos].markReadBySubscriber(logDestination);
+      LogEntries[pos].setFormattedMessage(message);
       clearExpiredEntries();
       return true;
     }
@@ -50,6 +51,12 @@ uint32_t LogBuffer::getNrMessages(LogDestination logDestination) const
   return res;
 }
 
+uint32_t LogBuffer::getNrDropped(LogDestination logDestination) const
+{
+  if (logDestination >= NR_LOG_TO_DESTINATIONS) { return 0; }
+  return droppedEntries[logDestination];
+}
+
 bool LogBuffer::logActiveRead(LogDestination logDestination) {
   if (logDestination >= NR_LOG_TO_DESTINATIONS) { return false; }
   return timePassedSince(lastReadTimeStamp[logDestination]) < LOG_BUFFER_ACTIVE_READ_TIMEOUT;
@@ -62,6 +69,11 @@ void LogBuffer::clearExpiredEntries() {
 
     if (it->isExpired()) {
       for (size_t i = 0; i < NR_LOG_TO_DESTINATIONS; ++i) {
+        if (it->validForSubscriber(i)) {
+          // Not read by this destination before it expired
+          ++droppedEntries[i];
+        }
+
         if (cache_iterator_pos[i]) {
           --cache_iterator_pos[i];
         }
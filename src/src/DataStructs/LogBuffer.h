@@ -55,6 +55,9 @@ struct LogBuffer {
   // Return the number of messages left for given log destination.
   uint32_t getNrMessages(LogDestination logDestination) const;
 
+  // Return the number of messages which expired before given log destination could read them.
+  uint32_t getNrDropped(LogDestination logDestination) const;
+
   bool logActiveRead(LogDestination logDestination);
 
   void clearExpiredEntries();
@@ -66,6 +69,8 @@ private:
 
   uint32_t cache_iterator_pos[NR_LOG_TO_DESTINATIONS]{};
 
+  uint32_t droppedEntries[NR_LOG_TO_DESTINATIONS]{};
+
 };
 
 
@@ -1,5 +1,6 @@
 #include "../DataStructs/LogEntry.h"
 
+#include "../DataStructs/LogRecord.h"
 
 #include "../Helpers/ESPEasy_time_calc.h"
 #include "../Helpers/StringConverter.h"
@@ -11,6 +12,7 @@ LogEntry_t::LogEntry_t(const uint8_t              logLevel,
   _timestamp(millis()),
   _strLength(message ? strlen_P((const char *)(message)) : 0),
   _isFlashString(true),
+  _isFormatRecord(false),
   _logLevel(logLevel),
   _subscriberPendingRead(0)
 {}
@@ -21,6 +23,7 @@ LogEntry_t::LogEntry_t(const uint8_t logLevel,
   _timestamp(millis()),
   _strLength(message ? strlen_P((const char *)(message)) : 0),
   _isFlashString(false),
+  _isFormatRecord(false),
   _logLevel(logLevel),
   _subscriberPendingRead(0)
 {
@@ -39,6 +42,7 @@ LogEntry_t::LogEntry_t(const uint8_t logLevel,
   _timestamp(millis()),
   _strLength(message.length()),
   _isFlashString(false),
+  _isFormatRecord(false),
   _logLevel(logLevel),
   _subscriberPendingRead(0)
 {
@@ -58,6 +62,7 @@ LogEntry_t::LogEntry_t(const uint8_t logLevel,
   _timestamp(millis()),
   _strLength(message.length()),
   _isFlashString(false),
+  _isFormatRecord(false),
   _logLevel(logLevel),
   _subscriberPendingRead(0)
 {
@@ -74,6 +79,21 @@ LogEntry_t::LogEntry_t(const uint8_t logLevel,
   }
 }
 
+LogEntry_t::LogEntry_t(const uint8_t       logLevel,
+                       LogRecord_writer && record) :
+  _message(nullptr),
+  _timestamp(millis()),
+  _strLength(record.size()),
+  _isFlashString(false),
+  _isFormatRecord(true),
+  _logLevel(logLevel),
+  _subscriberPendingRead(0)
+{
+  if (_strLength && loglevelActiveFor(logLevel)) {
+    _message = record.release();
+  }
+}
+
 LogEntry_t::~LogEntry_t()
 {
   if (!_isFlashString && (_message != nullptr)) {
@@ -161,16 +181,24 @@ bool LogEntry_t::validForSubscriber(uint8_t subscriber) const
 
 size_t LogEntry_t::print(Print& out, size_t offset, size_t length) const
 {
-  if (offset > _strLength) { return 0; }
+  if (_isFormatRecord) {
+    const String message = getMessage();
+    return print(out, message.c_str(), message.length(), offset, length);
+  }
+  return print(out, (const char *)_message, _strLength, offset, length);
+}
+
+size_t LogEntry_t::print(Print& out, const char *begin, size_t strLength, size_t offset, size_t length)
+{
+  if (offset > strLength) { return 0; }
 
-  const char*begin = (const char *)_message;
-  const char*end   = begin;
+  const char*end = begin;
 
-  if (_strLength > (offset + length)) {
+  if (strLength > (offset + length)) {
     end += (offset + length);
   }
   else {
-    end += _strLength;
+    end += strLength;
   }
   const char*pos = begin + offset;
 
@@ -184,12 +212,34 @@ String LogEntry_t::getMessage() const
 {
   if (_message == nullptr) { return EMPTY_STRING; }
 
+  if (_isFormatRecord) {
+    return LogRecord_format((const uint8_t *)_message, _strLength);
+  }
+
   if (_isFlashString) {
     return String((const __FlashStringHelper *)_message);
   }
   return String((const char *)_message);
 }
 
+void LogEntry_t::setFormattedMessage(const String& message)
+{
+  if (!_isFormatRecord || (_message == nullptr) || (_subscriberPendingRead == 0)) { return; }
+
+  free(_message);
+  _message        = nullptr;
+  _isFormatRecord = false;
+  _strLength      = message.length();
+
+  if (_strLength) {
+    _message = special_calloc(1, _strLength + 1);
+
+    if (_message) {
+      memcpy(_message, message.c_str(), _strLength);
+    }
+  }
+}
+
 bool LogEntry_t::isExpired() const
 {
   return
@@ -4,6 +4,8 @@
 
 #include "../DataTypes/LogLevels.h"
 
+class LogRecord_writer;
+
 
 #ifdef ESP32
   # define LOG_BUFFER_EXPIRE         30000 // Time after which a buffered log item is considered expired.
@@ -30,6 +32,11 @@ struct LogEntry_t {
   LogEntry_t(const uint8_t logLevel,
              String     && message);
 
+  // Format string + arguments, only formatted when read.
+  // Takes ownership of the record.
+  LogEntry_t(const uint8_t       logLevel,
+             LogRecord_writer && record);
+
   ~LogEntry_t();
 
   LogEntry_t(LogEntry_t&& rhs);
@@ -56,8 +63,13 @@ struct LogEntry_t {
                size_t offset = 0,
                size_t length = std::numeric_limits<size_t>::max()) const;
 
+  // Formats the message when the log entry is a LogRecord
   String   getMessage() const;
 
+  // Replace a LogRecord by its formatted message, when other subscribers still have to read it.
+  // So the record is formatted only once.
+  void     setFormattedMessage(const String& message);
+
   bool     isExpired() const;
 
   bool     isValid() const;
@@ -68,14 +80,21 @@ struct LogEntry_t {
 
 private:
 
+  static size_t print(Print     & out,
+                      const char *begin,
+                      size_t      strLength,
+                      size_t      offset,
+                      size_t      length);
+
   void    *_message{};
   uint32_t _timestamp;
   union {
     uint32_t _flags;
 
     struct {
-      uint32_t _strLength             : 19;
+      uint32_t _strLength             : 18;
       uint32_t _isFlashString         : 1;
+      uint32_t _isFormatRecord        : 1; // _message is a LogRecord, _strLength is the record size
       uint32_t _logLevel              : 4;
       uint32_t _subscriberPendingRead : 8; // See NR_LOG_TO_DESTINATIONS
 
@@ -0,0 +1,357 @@
+#include "../DataStructs/LogRecord.h"
+
+#include "../Helpers/Memory.h"
+#include "../Helpers/StringConverter.h"
+#include "../Helpers/StringConverter_Numerical.h"
+
+
+LogRecord_writer::LogRecord_writer(const __FlashStringHelper *format, size_t argsSize)
+{
+  PGM_P pformat = reinterpret_cast<PGM_P>(format);
+
+  _buffer = static_cast<uint8_t *>(special_calloc(1, sizeof(pformat) + argsSize));
+
+  if (_buffer != nullptr) {
+    _capacity = sizeof(pformat) + argsSize;
+    memcpy(_buffer, &pformat, sizeof(pformat));
+    _size = sizeof(pformat);
+  }
+}
+
+LogRecord_writer::~LogRecord_writer()
+{
+  free(_buffer);
+}
+
+uint8_t * LogRecord_writer::release()
+{
+  uint8_t *res = _buffer;
+
+  _buffer   = nullptr;
+  _size     = 0;
+  _capacity = 0;
+  return res;
+}
+
+void LogRecord_writer::addArg(float value)
+{
+  addArg(static_cast<double>(value));
+}
+
+void LogRecord_writer::addArg(double value)
+{
+  write(ArgType::Double, &value, sizeof(value));
+}
+
+void LogRecord_writer::addArg(const char *str)
+{
+  if (str == nullptr) {
+    str = "";
+  }
+
+  // Need room for the type and the terminating '\0'
+  const size_t length = strlen(str);
+
+  if ((_size + 2 + length) > _capacity) {
+    // Do not store any further arguments
+    _capacity = _size;
+    return;
+  }
+  _buffer[_size++] = static_cast<uint8_t>(ArgType::String);
+  memcpy(&_buffer[_size], str, length);
+  _size           += length;
+  _buffer[_size++] = 0;
+}
+
+void LogRecord_writer::addArg(const String& str)
+{
+  addArg(str.c_str());
+}
+
+void LogRecord_writer::addArg(const __FlashStringHelper *str)
+{
+  PGM_P pstr = reinterpret_cast<PGM_P>(str);
+
+  write(ArgType::FlashString, &pstr, sizeof(pstr));
+}
+
+void LogRecord_writer::write(ArgType type, const void *value, size_t size)
+{
+  if ((_size + 1 + size) > _capacity) {
+    // Do not store any further arguments
+    _capacity = _size;
+    return;
+  }
+  _buffer[_size++] = static_cast<uint8_t>(type);
+  memcpy(&_buffer[_size], value, size);
+  _size += size;
+}
+
+/*********************************************************************************************\
+* Formatting
+\*********************************************************************************************/
+namespace {
+struct LogRecord_arg {
+  LogRecord_writer::ArgType type;
+  union {
+    int64_t  i;
+    uint64_t u;
+    double   d;
+    PGM_P    str;
+  };
+};
+
+bool readArg(const uint8_t *& pos, const uint8_t *end, LogRecord_arg& arg)
+{
+  if (pos >= end) { return false; }
+  arg.type = static_cast<LogRecord_writer::ArgType>(*pos);
+  ++pos;
+
+  switch (arg.type) {
+    case LogRecord_writer::ArgType::Int32:
+    {
+      int32_t tmp{};
+
+      if ((pos + sizeof(tmp)) > end) { return false; }
+      memcpy(&tmp, pos, sizeof(tmp));
+      pos  += sizeof(tmp);
+      arg.i = tmp;
+      return true;
+    }
+    case LogRecord_writer::ArgType::UInt32:
+    {
+      uint32_t tmp{};
+
+      if ((pos + sizeof(tmp)) > end) { return false; }
+      memcpy(&tmp, pos, sizeof(tmp));
+      pos  += sizeof(tmp);
+      arg.u = tmp;
+      return true;
+    }
+    case LogRecord_writer::ArgType::Int64:
+    case LogRecord_writer::ArgType::UInt64:
+    case LogRecord_writer::ArgType::Double:
+
+      if ((pos + sizeof(uint64_t)) > end) { return false; }
+      memcpy(&arg.u, pos, sizeof(uint64_t));
+      pos += sizeof(uint64_t);
+      return true;
+    case LogRecord_writer::ArgType::String:
+    {
+      arg.str = reinterpret_cast<const char *>(pos);
+
+      while (pos < end && *pos != 0) { ++pos; }
+
+      if (pos >= end) { return false; }
+      ++pos;
+      return true;
+    }
+    case LogRecord_writer::ArgType::FlashString:
+
+      if ((pos + sizeof(PGM_P)) > end) { return false; }
+      memcpy(&arg.str, pos, sizeof(PGM_P));
+      pos += sizeof(PGM_P);
+      return true;
+  }
+  return false;
+}
+
+bool isSignedArg(const LogRecord_arg& arg)
+{
+  return arg.type == LogRecord_writer::ArgType::Int32 ||
+         arg.type == LogRecord_writer::ArgType::Int64;
+}
+
+bool is64bitArg(const LogRecord_arg& arg)
+{
+  return arg.type == LogRecord_writer::ArgType::Int64 ||
+         arg.type == LogRecord_writer::ArgType::UInt64;
+}
+
+bool isStringArg(const LogRecord_arg& arg)
+{
+  return arg.type == LogRecord_writer::ArgType::String ||
+         arg.type == LogRecord_writer::ArgType::FlashString;
+}
+
+double argAsDouble(const LogRecord_arg& arg)
+{
+  switch (arg.type) {
+    case LogRecord_writer::ArgType::Double: return arg.d;
+    case LogRecord_writer::ArgType::Int32:
+    case LogRecord_writer::ArgType::Int64:  return static_cast<double>(arg.i);
+    case LogRecord_writer::ArgType::UInt32:
+    case LogRecord_writer::ArgType::UInt64: return static_cast<double>(arg.u);
+    default: break;
+  }
+  return 0.0;
+}
+
+int64_t argAsInt(const LogRecord_arg& arg)
+{
+  if (arg.type == LogRecord_writer::ArgType::Double) {
+    return static_cast<int64_t>(arg.d);
+  }
+
+  if (isStringArg(arg)) {
+    return 0;
+  }
+  return arg.i;
+}
+
+template<typename T>
+void appendFormatted(String& res, const char *spec, T value)
+{
+  char buf[32];
+  const int len = snprintf(buf, sizeof(buf), spec, value);
+
+  if (len < 0) { return; }
+
+  if (len < static_cast<int>(sizeof(buf))) {
+    res += buf;
+  } else {
+    res += strformat(String(spec), value);
+  }
+}
+} // namespace
+
+String LogRecord_format(const uint8_t *record, size_t size)
+{
+  String res;
+
+  if ((record == nullptr) || (size < sizeof(PGM_P))) {
+    return res;
+  }
+  PGM_P format{};
+
+  memcpy(&format, record, sizeof(format));
+
+  if (format == nullptr) {
+    return res;
+  }
+
+  const uint8_t *pos = record + sizeof(format);
+  const uint8_t *end = record + size;
+
+  // Most log lines are a bit longer than the format string
+  res.reserve(strlen_P(format) + size);
+
+  char c;
+
+  while ((c = pgm_read_byte(format++)) != 0) {
+    if (c != '%') {
+      res += c;
+      continue;
+    }
+
+    // Collect flags, width and precision, skip length modifiers.
+    // The type of the argument is known from the record.
+    char   spec[24];
+    size_t specLength = 0;
+    spec[specLength++] = '%';
+    char conversion    = 0;
+
+    while (conversion == 0 && (c = pgm_read_byte(format)) != 0) {
+      ++format;
+
+      if (c == '*') {
+        // Width or precision as argument
+        LogRecord_arg arg;
+
+        if (readArg(pos, end, arg) && (specLength < (sizeof(spec) - 12))) {
+          specLength += snprintf(&spec[specLength], sizeof(spec) - specLength, "%d", static_cast<int>(argAsInt(arg)));
+        }
+      } else if (strchr_P(PSTR("hlLqjzt"), c) != nullptr) {
+        // Length modifier
+      } else if (isalpha(c) || (c == '%')) {
+        conversion = c;
+      } else if (specLength < (sizeof(spec) - 4)) {
+        spec[specLength++] = c;
+      }
+    }
+
+    if (conversion == 0) {
+      break;
+    }
+
+    if (conversion == '%') {
+      res += '%';
+      continue;
+    }
+
+    LogRecord_arg arg;
+
+    if (!readArg(pos, end, arg)) {
+      // Missing argument, e.g. record was truncated
+      res += '?';
+      continue;
+    }
+
+    if (isStringArg(arg) || (conversion == 's')) {
+      if (!isStringArg(arg)) {
+        res += isSignedArg(arg) ? ll2String(arg.i) : ull2String(arg.u);
+      } else if (specLength == 1) {
+        if (arg.type == LogRecord_writer::ArgType::FlashString) {
+          res += reinterpret_cast<const __FlashStringHelper *>(arg.str);
+        } else {
+          res += arg.str;
+        }
+      } else {
+        const String str = (arg.type == LogRecord_writer::ArgType::FlashString)
+          ? String(reinterpret_cast<const __FlashStringHelper *>(arg.str))
+          : String(arg.str);
+        spec[specLength++] = 's';
+        spec[specLength]   = 0;
+        appendFormatted(res, spec, str.c_str());
+      }
+      continue;
+    }
+
+    spec[specLength++] = conversion;
+    spec[specLength]   = 0;
+
+    switch (conversion) {
+      case 'd':
+      case 'i':
+
+        if (is64bitArg(arg)) {
+          res += isSignedArg(arg) ? ll2String(arg.i) : ull2String(arg.u);
+        } else {
+          appendFormatted(res, spec, static_cast<int>(argAsInt(arg)));
+        }
+        break;
+      case 'u':
+      case 'x':
+      case 'X':
+      case 'o':
+
+        if (is64bitArg(arg)) {
+          const uint8_t base = (conversion == 'u') ? 10 : ((conversion == 'o') ? 8 : 16);
+          String str         = ull2String(arg.u, base);
+
+          if (conversion == 'X') { str.toUpperCase(); }
+          res += str;
+        } else {
+          appendFormatted(res, spec, static_cast<unsigned int>(argAsInt(arg)));
+        }
+        break;
+      case 'c':
+        res += static_cast<char>(argAsInt(arg));
+        break;
+      case 'f':
+      case 'F':
+      case 'e':
+      case 'E':
+      case 'g':
+      case 'G':
+      case 'a':
+      case 'A':
+        appendFormatted(res, spec, argAsDouble(arg));
+        break;
+      default:
+        res += '?';
+        break;
+    }
+  }
+  return res;
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+#include "../../ESPEasy_common.h"
+
+#include <type_traits>
+
+/*********************************************************************************************\
+* LogRecord
+* Format string (PROGMEM) and its arguments, stored as a binary record.
+* The log line is only formatted when a log destination reads it.
+*
+* Record layout:
+* - Pointer to the format string
+* - Per argument: 1 byte ArgType, followed by the value.
+*   Strings in RAM are copied including the terminating '\0'.
+*   Flash strings are stored as pointer.
+*
+* The record is allocated on the heap with the size computed by argsSize(),
+* so strings are not truncated and no large buffer is needed on the stack.
+\*********************************************************************************************/
+
+class LogRecord_writer {
+public:
+
+  enum class ArgType : uint8_t {
+    Int32,
+    UInt32,
+    Int64,
+    UInt64,
+    Double,
+    String,
+    FlashString
+  };
+
+  // Allocates the record for the format string and arguments of argsSize()
+  LogRecord_writer(const __FlashStringHelper *format,
+                   size_t                     argsSize);
+
+  ~LogRecord_writer();
+
+  LogRecord_writer(const LogRecord_writer&)            = delete;
+  LogRecord_writer& operator=(const LogRecord_writer&) = delete;
+
+  static size_t argsSize() {
+    return 0;
+  }
+
+  template<typename T, typename ... Args>
+  static size_t argsSize(const T& arg, const Args&... args) {
+    return argSize(arg) + argsSize(args ...);
+  }
+
+  void add() {}
+
+  template<typename T, typename ... Args>
+  void add(const T& arg, const Args&... args) {
+    addArg(arg);
+    add(args ...);
+  }
+
+  const uint8_t* data() const {
+    return _buffer;
+  }
+
+  size_t size() const {
+    return _size;
+  }
+
+  // Take ownership of the record, to be freed using free()
+  uint8_t* release();
+
+private:
+
+  template<typename T>
+  static typename std::enable_if<std::is_integral<T>::value, size_t>::type argSize(T) {
+    return 1 + ((sizeof(T) > sizeof(int32_t)) ? sizeof(int64_t) : sizeof(int32_t));
+  }
+
+  static size_t argSize(float) {
+    return 1 + sizeof(double);
+  }
+
+  static size_t argSize(double) {
+    return 1 + sizeof(double);
+  }
+
+  static size_t argSize(const char *str) {
+    return 2 + (str == nullptr ? 0 : strlen(str));
+  }
+
+  static size_t argSize(const String& str) {
+    return 2 + str.length();
+  }
+
+  static size_t argSize(const __FlashStringHelper *) {
+    return 1 + sizeof(PGM_P);
+  }
+
+  template<typename T>
+  typename std::enable_if<std::is_integral<T>::value>::type addArg(T value) {
+    if (sizeof(T) > sizeof(int32_t)) {
+      if (std::is_signed<T>::value) {
+        const int64_t tmp = value;
+        write(ArgType::Int64, &tmp, sizeof(tmp));
+      } else {
+        const uint64_t tmp = value;
+        write(ArgType::UInt64, &tmp, sizeof(tmp));
+      }
+    } else {
+      if (std::is_signed<T>::value) {
+        const int32_t tmp = value;
+        write(ArgType::Int32, &tmp, sizeof(tmp));
+      } else {
+        const uint32_t tmp = value;
+        write(ArgType::UInt32, &tmp, sizeof(tmp));
+      }
+    }
+  }
+
+  void addArg(float value);
+  void addArg(double value);
+  void addArg(const char *str);
+  void addArg(const String& str);
+  void addArg(const __FlashStringHelper *str);
+
+  void write(ArgType     type,
+             const void *value,
+             size_t      size);
+
+  uint8_t *_buffer{};
+  size_t   _size{};
+  size_t   _capacity{};
+};
+
+// Format the log record as it would have been formatted by strformat()
+String LogRecord_format(const uint8_t *record,
+                        size_t         size);
@@ -12,8 +12,7 @@
     flashCounter = 0;
     bootCounter = 0;
     lastMixedSchedulerId = 0;
-    unused1 = 0;
-    unused2 = 0;
+    clockDrift = 0;
     lastSysTime = 0;
   }
 
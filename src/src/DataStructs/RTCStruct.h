@@ -65,8 +65,7 @@ struct RTCStruct
   uint32_t bootCounter           = 0;
   uint32_t lastMixedSchedulerId  = 0;
   uint8_t  lastBSSID[6]          = { 0 };
-  uint8_t  unused1               = 0; // Force alignment to 4 bytes
-  uint8_t  unused2               = 0;
+  int16_t  clockDrift            = 0; // Estimated clock drift in 0.01 ppm
   uint32_t lastSysTime           = 0;
 
 };
@@ -0,0 +1,37 @@
+#include "../DataStructs/SampleRecord.h"
+
+
+SampleRecord *SampleRecord::_active = nullptr;
+
+SampleRecord::SampleRecord(struct EventStruct *event) :
+  _prev(_active),
+  _taskIndex(event->TaskIndex),
+  _sensorType(event->getSensorType())
+{
+  _active = this;
+}
+
+SampleRecord::~SampleRecord()
+{
+  _active = _prev;
+}
+
+SampleRecord * SampleRecord::getActive(const struct EventStruct *event)
+{
+  if ((_active == nullptr) || (event == nullptr)) {
+    return nullptr;
+  }
+
+  if ((_active->_taskIndex != event->TaskIndex) ||
+      (_active->_sensorType != event->sensorType)) {
+    return nullptr;
+  }
+  return _active;
+}
+
+void SampleRecord::setFormatted(uint8_t rel_index, const String& value)
+{
+  if (rel_index >= VARS_PER_TASK) { return; }
+  _formatted[rel_index] = value;
+  bitSet(_formattedMask, rel_index);
+}
@@ -0,0 +1,55 @@
+#ifndef DATASTRUCTS_SAMPLERECORD_H
+#define DATASTRUCTS_SAMPLERECORD_H
+
+#include "../../ESPEasy_common.h"
+
+#include "../CustomBuild/ESPEasyLimits.h"
+#include "../DataStructs/ESPEasy_EventStruct.h"
+#include "../DataTypes/SensorVType.h"
+#include "../DataTypes/TaskIndex.h"
+
+/*********************************************************************************************\
+   Sample record
+
+   Task values of a single sample, sent to all enabled controllers (and rules/logger) by sendData().
+   Each task value is only formatted once, when first requested by any of them.
+   All other calls to formatUserVar() for the same task value then return the already formatted string.
+
+   The record is active as long as the object exists, so it should only be created on the stack.
+   Task values must not be changed while the record is active.
+ \*********************************************************************************************/
+class SampleRecord {
+public:
+
+  explicit SampleRecord(struct EventStruct *event);
+
+  ~SampleRecord();
+
+  // Active sample record matching the task and sensor type of the event, or nullptr when none.
+  static SampleRecord* getActive(const struct EventStruct *event);
+
+  bool                 hasFormatted(uint8_t rel_index) const {
+    return (rel_index < VARS_PER_TASK) && bitRead(_formattedMask, rel_index);
+  }
+
+  const String& getFormatted(uint8_t rel_index) const {
+    return _formatted[rel_index];
+  }
+
+  void setFormatted(uint8_t       rel_index,
+                    const String& value);
+
+private:
+
+  static SampleRecord *_active;
+
+  // Previous active record, in case sendData() is called recursively
+  SampleRecord *_prev{};
+
+  String       _formatted[VARS_PER_TASK];
+  taskIndex_t  _taskIndex;
+  Sensor_VType _sensorType;
+  uint8_t      _formattedMask{};
+};
+
+#endif // ifndef DATASTRUCTS_SAMPLERECORD_H
@@ -97,6 +97,19 @@ class SettingsStruct_tmpl
   inline bool EcoPowerMode() const { return VariousBits_1.EcoPowerMode; }
   inline void EcoPowerMode(bool value) { VariousBits_1.EcoPowerMode = value; }
 
+  // Schedule task reads at a multiple of the task interval, so tasks with the same interval are read at the same moment.
+  // This reduces the number of wake-ups.
+  inline bool AlignTaskReads() const { return VariousBits_3.AlignTaskReads; }
+  inline void AlignTaskReads(bool value) { VariousBits_3.AlignTaskReads = value; }
+
+  // 0 = UDP RFC3164 (one message per packet), 1 = UDP RFC5424 batched, 2 = TCP RFC5424 octet-counting
+  inline uint8_t SyslogTransport() const { return VariousBits_3.SyslogTransport; }
+  inline void SyslogTransport(uint8_t value) { VariousBits_3.SyslogTransport = value; }
+
+  // Write the SD card value log in binary format (VALUES.BIN) instead of CSV
+  inline bool ValueLoggerBinary() const { return VariousBits_3.ValueLoggerBinary; }
+  inline void ValueLoggerBinary(bool value) { VariousBits_3.ValueLoggerBinary = value; }
+
   inline bool WifiNoneSleep() const { return VariousBits_1.WifiNoneSleep; }
   inline void WifiNoneSleep(bool value) { VariousBits_1.WifiNoneSleep = value; }
 
@@ -520,10 +533,9 @@ public:
   uint32_t WireClockStretchLimit = 0;
   union {
     struct {
-      uint32_t unused_00                        : 1; // Bit 0
-      uint32_t unused_01                        : 1; // Bit 1
-      uint32_t unused_02                        : 1; // Bit 2
-      uint32_t unused_03                        : 1; // Bit 3
+      uint32_t AlignTaskReads                   : 1; // Bit 0
+      uint32_t SyslogTransport                  : 2; // Bit 1 & 2
+      uint32_t ValueLoggerBinary                : 1; // Bit 3
       uint32_t unused_04                        : 1; // Bit 4
       uint32_t unused_05                        : 1; // Bit 5
       uint32_t unused_06                        : 1; // Bit 6
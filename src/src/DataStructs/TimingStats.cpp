@@ -11,19 +11,85 @@ std::map<int, TimingStats> pluginStats;
 std::map<int, TimingStats> controllerStats;
 std::map<int, TimingStats> networkStats;
 std::map<TimingStatsElements, TimingStats> miscStats;
+TimingStats taskStats[TASKS_MAX];
+TimingStats taskFormulaStats[TASKS_MAX];
+uint32_t formatUserVar_bytes{};
+uint32_t formatUserVar_cacheHits{};
 unsigned long timingstats_last_reset(0);
 
+// Pointers to the elements in miscStats, to skip the map lookup on every call.
+// Elements are never removed from miscStats, only reset, so these remain valid.
+TimingStats *miscStatsIndex[NR_TIMING_STATS_ELEMENTS]{};
+
+
+# if FEATURE_TIMING_STATS_HISTOGRAM
+TimingStats::TimingStats(const TimingStats& other) {
+  *this = other;
+}
+
+TimingStats& TimingStats::operator=(const TimingStats& other) {
+  if (this == &other) { return *this; }
+  _timeTotal = other._timeTotal;
+  _count     = other._count;
+  _maxVal    = other._maxVal;
+  _minVal    = other._minVal;
+
+  if (other._histogram == nullptr) {
+    delete[] _histogram;
+    _histogram = nullptr;
+  } else {
+    if (_histogram == nullptr) {
+      _histogram = new (std::nothrow) uint16_t[TIMING_STATS_NR_BUCKETS];
+    }
+
+    if (_histogram != nullptr) {
+      memcpy(_histogram, other._histogram, TIMING_STATS_NR_BUCKETS * sizeof(uint16_t));
+    }
+  }
+  return *this;
+}
+
+TimingStats::~TimingStats() {
+  delete[] _histogram;
+}
+
+# endif // if FEATURE_TIMING_STATS_HISTOGRAM
 
 void TimingStats::add(int32_t duration_usec) {
   // Max duration in usec is roughly 35 minutes.
   // For timing stats more than enough
   if (duration_usec < 0) return;
+  # ifdef ESP32
+
+  if (xPortInIsrContext()) {
+    // Must not allocate memory in an ISR, nor update the stats while the main loop may be updating them.
+    return;
+  }
+  # endif // ifdef ESP32
   _timeTotal += static_cast<uint64_t>(duration_usec);
   ++_count;
 
   if (static_cast<uint32_t>(duration_usec) > _maxVal) { _maxVal = duration_usec; }
 
   if (static_cast<uint32_t>(duration_usec) < _minVal) { _minVal = duration_usec; }
+
+  # if FEATURE_TIMING_STATS_HISTOGRAM
+
+  if (_histogram == nullptr) {
+    _histogram = new (std::nothrow) uint16_t[TIMING_STATS_NR_BUCKETS]();
+
+    if (_histogram == nullptr) { return; }
+  }
+
+  const uint8_t index = getBucketIndex(duration_usec);
+
+  if (_histogram[index] == 0xFFFF) {
+    for (size_t i = 0; i < TIMING_STATS_NR_BUCKETS; ++i) {
+      _histogram[i] >>= 1;
+    }
+  }
+  ++_histogram[index];
+  # endif // if FEATURE_TIMING_STATS_HISTOGRAM
 }
 
 void TimingStats::reset() {
@@ -31,6 +97,12 @@ void TimingStats::reset() {
   _count     = 0u;
   _maxVal    = 0u;
   _minVal    = 4294967295u;
+  # if FEATURE_TIMING_STATS_HISTOGRAM
+
+  // Free the histogram, as the stats may not be used again
+  delete[] _histogram;
+  _histogram = nullptr;
+  # endif // if FEATURE_TIMING_STATS_HISTOGRAM
 }
 
 bool TimingStats::isEmpty() const {
@@ -42,6 +114,10 @@ float TimingStats::getAvg() const {
   return static_cast<float>(_timeTotal) / static_cast<float>(_count);
 }
 
+uint64_t TimingStats::getTotal() const {
+  return _timeTotal;
+}
+
 uint32_t TimingStats::getMinMax(uint32_t& minVal, uint32_t& maxVal) const {
   minVal = _minVal;
   maxVal = _maxVal;
@@ -55,6 +131,81 @@ bool TimingStats::thresholdExceeded(const uint32_t& threshold) const {
   return _maxVal > threshold;
 }
 
+# if FEATURE_TIMING_STATS_HISTOGRAM
+uint32_t TimingStats::getPercentile(uint8_t percentile) const {
+  if (_count == 0) { return 0; }
+
+  if ((percentile >= 100) || (_histogram == nullptr)) { return _maxVal; }
+
+  uint32_t total = 0;
+
+  for (size_t i = 0; i < TIMING_STATS_NR_BUCKETS; ++i) {
+    total += _histogram[i];
+  }
+
+  // Rank of the sample in the sorted list of samples, 1 ... total
+  const uint32_t rank = (total * percentile + 99) / 100;
+  uint32_t cumulative = 0;
+
+  for (uint8_t i = 0; i < TIMING_STATS_NR_BUCKETS; ++i) {
+    const uint32_t bucketCount = _histogram[i];
+
+    if ((bucketCount != 0) && ((cumulative + bucketCount) >= rank)) {
+      // Assume the samples are evenly spread over the bucket
+      const uint32_t lowerBound = getBucketLowerBound(i);
+      const uint32_t upperBound = (i + 1 < TIMING_STATS_NR_BUCKETS)
+        ? getBucketLowerBound(i + 1)
+        : _maxVal + 1;
+      uint32_t res = lowerBound;
+
+      if (upperBound > lowerBound) {
+        res += static_cast<uint32_t>(
+          (static_cast<uint64_t>(upperBound - lowerBound) * (rank - cumulative) - 1) / bucketCount);
+      }
+
+      if (res < _minVal) { return _minVal; }
+
+      if (res > _maxVal) { return _maxVal; }
+      return res;
+    }
+    cumulative += bucketCount;
+  }
+  return _maxVal;
+}
+
+uint8_t TimingStats::getBucketIndex(uint32_t duration_usec) {
+  constexpr uint32_t subBucketMask = (1u << TIMING_STATS_SUB_BUCKET_BITS) - 1;
+
+  if (duration_usec < (2u << TIMING_STATS_SUB_BUCKET_BITS)) {
+    // Small values have their own bucket
+    return duration_usec;
+  }
+
+  const uint32_t msb = 31 - __builtin_clz(duration_usec);
+
+  if (msb > TIMING_STATS_MAX_BUCKET_MSB) {
+    return TIMING_STATS_NR_BUCKETS - 1;
+  }
+
+  return ((msb - TIMING_STATS_SUB_BUCKET_BITS + 1) << TIMING_STATS_SUB_BUCKET_BITS) +
+         ((duration_usec >> (msb - TIMING_STATS_SUB_BUCKET_BITS)) & subBucketMask);
+}
+
+uint32_t TimingStats::getBucketLowerBound(uint8_t index) {
+  constexpr uint32_t subBucketMask = (1u << TIMING_STATS_SUB_BUCKET_BITS) - 1;
+
+  if (index < (2u << TIMING_STATS_SUB_BUCKET_BITS)) {
+    return index;
+  }
+
+  const uint32_t msb      = (index >> TIMING_STATS_SUB_BUCKET_BITS) + TIMING_STATS_SUB_BUCKET_BITS - 1;
+  const uint32_t subIndex = index & subBucketMask;
+
+  return ((1u << TIMING_STATS_SUB_BUCKET_BITS) + subIndex) << (msb - TIMING_STATS_SUB_BUCKET_BITS);
+}
+
+# endif // if FEATURE_TIMING_STATS_HISTOGRAM
+
 /********************************************************************************************\
    Functions used for displaying timing stats
  \*********************************************************************************************/
@@ -257,6 +408,9 @@ const __FlashStringHelper* getMiscStatsName_F(TimingStatsElements stat) {
     case TimingStatsElements::TRY_OPEN_FILE:              return F("TryOpenFile()");
     case TimingStatsElements::FS_GC_SUCCESS:              return F("ESPEASY_FS GC success");
     case TimingStatsElements::FS_GC_FAIL:                 return F("ESPEASY_FS GC fail");
+#if FEATURE_SD
+    case TimingStatsElements::SD_VALUELOGGER_FLUSH:       return F("SD value logger flush");
+#endif
     case TimingStatsElements::RULES_PROCESSING:           return F("rulesProcessing()");
     case TimingStatsElements::RULES_PARSE_LINE:           return F("parseCompleteNonCommentLine()");
     case TimingStatsElements::RULES_PROCESS_MATCHED:      return F("processMatchedRule()");
@@ -341,6 +495,32 @@ void stopTimerTask(deviceIndex_t T, int F, uint32_t statisticsTimerStart)
   if (mustLogFunction(F)) { pluginStats[static_cast<int>(T.value) * 256 + (F)].add(usecPassedSince_fast(statisticsTimerStart)); }
 }
 
+void stopTimerTask(taskIndex_t TI, deviceIndex_t T, int F, uint32_t statisticsTimerStart)
+{
+  if (mustLogFunction(F)) {
+    const int32_t duration = usecPassedSince_fast(statisticsTimerStart);
+
+    pluginStats[static_cast<int>(T.value) * 256 + (F)].add(duration);
+
+    if (validTaskIndex(TI)) {
+      taskStats[TI].add(duration);
+    }
+  }
+}
+
+void stopTimerTaskFormula(taskIndex_t TI, uint32_t statisticsTimerStart)
+{
+  if (Settings.EnableTimingStats()) {
+    const int32_t duration = usecPassedSince_fast(statisticsTimerStart);
+
+    getMiscStats(TimingStatsElements::COMPUTE_FORMULA_STATS).add(duration);
+
+    if (validTaskIndex(TI)) {
+      taskFormulaStats[TI].add(duration);
+    }
+  }
+}
+
 void stopTimerController(protocolIndex_t T, CPlugin::Function F, uint32_t statisticsTimerStart)
 {
   if (mustLogCFunction(F)) { controllerStats[static_cast<int>(T) * 256 + static_cast<int>(F)].add(usecPassedSince_fast(statisticsTimerStart)); }
@@ -354,12 +534,44 @@ void stopTimerNetwork(ESPEasy::net::networkDriverIndex_t T, NWPlugin::Function F
 
 void stopTimer(TimingStatsElements L, uint32_t statisticsTimerStart)
 {
-  if (Settings.EnableTimingStats()) { miscStats[L].add(usecPassedSince_fast(statisticsTimerStart)); }
+  if (Settings.EnableTimingStats()) { getMiscStats(L).add(usecPassedSince_fast(statisticsTimerStart)); }
 }
 
 void addMiscTimerStat(TimingStatsElements L, int32_t T)
 {
-  if (Settings.EnableTimingStats()) { miscStats[L].add(T); }
+  if (Settings.EnableTimingStats()) { getMiscStats(L).add(T); }
+}
+
+TimingStats& getMiscStats(TimingStatsElements L)
+{
+  const size_t index = static_cast<size_t>(L);
+
+  if (index >= NR_TIMING_STATS_ELEMENTS) {
+    return miscStats[L];
+  }
+
+  if (miscStatsIndex[index] == nullptr) {
+    miscStatsIndex[index] = &miscStats[L];
+  }
+  return *miscStatsIndex[index];
+}
+
+void resetTimingStats()
+{
+  pluginStats.clear();
+  controllerStats.clear();
+
+  for (auto& x : miscStats) {
+    x.second.reset();
+  }
+
+  for (taskIndex_t x = 0; x < TASKS_MAX; ++x) {
+    taskStats[x].reset();
+    taskFormulaStats[x].reset();
+  }
+  formatUserVar_bytes     = 0;
+  formatUserVar_cacheHits = 0;
+  timingstats_last_reset  = millis();
 }
 
 #endif // if FEATURE_TIMING_STATS
@@ -5,10 +5,12 @@
 
 #if FEATURE_TIMING_STATS
 
+# include "../CustomBuild/ESPEasyLimits.h"
 # include "../DataTypes/DeviceIndex.h"
 # include "../DataTypes/ESPEasy_plugin_functions.h"
 # include "../../ESPEasy/net/DataTypes/NetworkDriverIndex.h"
 # include "../DataTypes/ProtocolIndex.h"
+# include "../DataTypes/TaskIndex.h"
 # include "../Globals/Settings.h"
 # include "../Helpers/ESPEasy_time_calc.h"
 
@@ -103,6 +105,9 @@ enum class TimingStatsElements {
   TRY_OPEN_FILE,
   FS_GC_SUCCESS,
   FS_GC_FAIL,
+#if FEATURE_SD
+  SD_VALUELOGGER_FLUSH,
+#endif
 
   // Scheduler related
   SAVE_TO_RTC,
@@ -147,25 +152,72 @@ enum class TimingStatsElements {
 
 #if FEATURE_TIMING_STATS
 
+constexpr size_t NR_TIMING_STATS_ELEMENTS = static_cast<size_t>(TimingStatsElements::LOOP_STATS) + 1;
+
+# if FEATURE_TIMING_STATS_HISTOGRAM
+
+// Durations are also counted in a log-bucketed histogram (like HDR histograms)
+// to estimate percentiles.
+// Each power of 2 is split in 2^TIMING_STATS_SUB_BUCKET_BITS buckets.
+// Durations of 2^(TIMING_STATS_MAX_BUCKET_MSB + 1) usec (16.8 sec) and longer are counted in the last bucket.
+# ifndef TIMING_STATS_SUB_BUCKET_BITS
+#  ifdef ESP8266
+#   define TIMING_STATS_SUB_BUCKET_BITS  0
+#  else // ifdef ESP8266
+#   define TIMING_STATS_SUB_BUCKET_BITS  1
+#  endif // ifdef ESP8266
+# endif // ifndef TIMING_STATS_SUB_BUCKET_BITS
+# define TIMING_STATS_MAX_BUCKET_MSB     23
+# define TIMING_STATS_NR_BUCKETS         ((TIMING_STATS_MAX_BUCKET_MSB - TIMING_STATS_SUB_BUCKET_BITS + 2) << TIMING_STATS_SUB_BUCKET_BITS)
+# endif // if FEATURE_TIMING_STATS_HISTOGRAM
+
+// Stats are only updated from the main loop, or from the RTOS server task while it holds
+// the main loop lock (ESP32), so they are not locked.
+// Calls from an ISR are ignored on ESP32.
 class TimingStats {
 public:
 
   TimingStats() = default;
+# if FEATURE_TIMING_STATS_HISTOGRAM
+  TimingStats(const TimingStats& other);
+  TimingStats& operator=(const TimingStats& other);
+  ~TimingStats();
+# endif // if FEATURE_TIMING_STATS_HISTOGRAM
 
   void     add(int32_t duration_usec);
   void     reset();
   bool     isEmpty() const;
   float    getAvg() const;
+  uint64_t getTotal() const;
   uint32_t getMinMax(uint32_t& minVal,
                      uint32_t& maxVal) const;
   bool     thresholdExceeded(const uint32_t& threshold) const;
 
+# if FEATURE_TIMING_STATS_HISTOGRAM
+
+  // Estimated duration in usec which is not exceeded by the given percentage of calls.
+  // @param percentile  1 ... 100
+  uint32_t getPercentile(uint8_t percentile) const;
+
+  static uint8_t  getBucketIndex(uint32_t duration_usec);
+  static uint32_t getBucketLowerBound(uint8_t index);
+# endif // if FEATURE_TIMING_STATS_HISTOGRAM
+
 private:
 
   uint64_t _timeTotal{};
   uint32_t _count{};
   uint32_t _maxVal{};
   uint32_t _minVal = 4294967295;
+
+# if FEATURE_TIMING_STATS_HISTOGRAM
+
+  // TIMING_STATS_NR_BUCKETS counts, allocated on the first add().
+  // Stats which are never used (e.g. of tasks not configured) only take the pointer.
+  // When a bucket is full, all buckets are halved.
+  // Only the relative bucket counts are used to compute percentiles.
+  uint16_t *_histogram = nullptr;
+# endif // if FEATURE_TIMING_STATS_HISTOGRAM
 };
 
 
@@ -190,16 +242,39 @@ void                       stopTimer(TimingStatsElements L,
 void                       addMiscTimerStat(TimingStatsElements L,
                                             int32_t             T);
 
+// Plugin call timing stats per task, as well as per plugin and function
+void                       stopTimerTask(taskIndex_t   TI,
+                                         deviceIndex_t T,
+                                         int           F,
+                                         uint32_t      statisticsTimerStart);
+
+// Formula computation timing stats per task, as well as for all formulas
+void                       stopTimerTaskFormula(taskIndex_t TI,
+                                                uint32_t    statisticsTimerStart);
+
+// Direct access to the miscStats element, without a lookup in the map
+TimingStats&               getMiscStats(TimingStatsElements L);
+
+void                       resetTimingStats();
+
 extern std::map<int, TimingStats> pluginStats;
 extern std::map<int, TimingStats> controllerStats;
 extern std::map<int, TimingStats> networkStats;
 extern std::map<TimingStatsElements, TimingStats> miscStats;
+extern TimingStats taskStats[TASKS_MAX];
+extern TimingStats taskFormulaStats[TASKS_MAX];
+
+// Nr of bytes of formatted task values, and nr of times an already formatted value was used.
+extern uint32_t formatUserVar_bytes;
+extern uint32_t formatUserVar_cacheHits;
 extern unsigned long timingstats_last_reset;
 
 # define START_TIMER const uint32_t statisticsTimerStart(micros());
 # define STOP_TIMER_TASK(T, F) stopTimerTask(T, F, statisticsTimerStart);
+# define STOP_TIMER_TASK_INDEX(TI, T, F) stopTimerTask(TI, T, F, statisticsTimerStart);
 # define STOP_TIMER_CONTROLLER(T, F) stopTimerController(T, F, statisticsTimerStart);
 # define STOP_TIMER_NETWORK(T, F) stopTimerNetwork(T, F, statisticsTimerStart);
+# define STOP_TIMER_TASK_FORMULA(TI) stopTimerTaskFormula(TI, statisticsTimerStart);
 
 // #define STOP_TIMER_LOADFILE miscStats[LOADFILE_STATS].add(usecPassedSince_fast(statisticsTimerStart));
 # define STOP_TIMER(L) stopTimer(TimingStatsElements::L, statisticsTimerStart);
@@ -212,8 +287,10 @@ extern unsigned long timingstats_last_reset;
 
 # define START_TIMER ;
 # define STOP_TIMER_TASK(T, F) ;
+# define STOP_TIMER_TASK_INDEX(TI, T, F) ;
 # define STOP_TIMER_CONTROLLER(T, F) ;
 # define STOP_TIMER_NETWORK(T, F) ;
+# define STOP_TIMER_TASK_FORMULA(TI) ;
 # define STOP_TIMER(L) ;
 # define ADD_TIMER_STAT(L, T) ;
 
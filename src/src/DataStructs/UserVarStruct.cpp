@@ -4,10 +4,12 @@
 #include "../DataStructs/TimingStats.h"
 #include "../ESPEasyCore/ESPEasy_Log.h"
 #include "../Globals/Cache.h"
+#include "../Globals/ESPEasy_time.h"
 #include "../Globals/Plugins.h"
 #include "../Globals/RulesCalculate.h"
 #include "../Helpers/_Plugin_SensorTypeHelper.h"
 #include "../Helpers/CRC_functions.h"
+#include "../Helpers/Numerical.h"
 #include "../Helpers/StringConverter.h"
 #include "../Helpers/StringParser.h"
 
@@ -21,6 +23,7 @@ void UserVarStruct::clear()
   _computed.clear();
 #ifndef LIMIT_BUILD_SIZE
   _preprocessedFormula.clear();
+  _formulaPrograms.clear();
 #endif // ifndef LIMIT_BUILD_SIZE
   _prevValue.clear();
 }
@@ -334,6 +337,15 @@ void UserVarStruct::clear_computed(taskIndex_t taskIndex)
   if (it != _computed.end()) {
     _computed.erase(it);
   }
+#ifndef LIMIT_BUILD_SIZE
+  {
+    auto it = _formulaPrograms.find(taskIndex);
+
+    if (it != _formulaPrograms.end()) {
+      _formulaPrograms.erase(it);
+    }
+  }
+#endif // ifndef LIMIT_BUILD_SIZE
 
   for (taskVarIndex_t varNr = 0; validTaskVarIndex(varNr); ++varNr) {
     const uint16_t key = makeWord(taskIndex, varNr);
@@ -359,14 +371,50 @@ void UserVarStruct::clear_computed(taskIndex_t taskIndex)
 void UserVarStruct::markPluginRead(taskIndex_t taskIndex)
 {
   struct EventStruct TempEvent(taskIndex);
+#ifndef LIMIT_BUILD_SIZE
+  auto programs_it = _formulaPrograms.find(taskIndex);
+#endif // ifndef LIMIT_BUILD_SIZE
   for (taskVarIndex_t varNr = 0; validTaskVarIndex(varNr); ++varNr) {
     if (Cache.hasFormula_with_prevValue(taskIndex, varNr)) {
       const uint16_t key = makeWord(taskIndex, varNr);
       _prevValue[key] = formatUserVarNoCheck(&TempEvent, varNr);
+#ifndef LIMIT_BUILD_SIZE
+      if (programs_it != _formulaPrograms.end()) {
+        programs_it->second.setPrevValue(varNr, _prevValue[key]);
+      }
+#endif // ifndef LIMIT_BUILD_SIZE
     }
   }
 }
 
+#if FEATURE_JSON_CBOR
+void UserVarStruct::markTaskValuesSent(taskIndex_t taskIndex)
+{
+  if (validTaskIndex(taskIndex)) {
+    ++_updateSequence;
+    _taskUpdateSequence[taskIndex] = _updateSequence;
+    _taskUpdateTime[taskIndex]     = node_time.getUnixTime();
+  }
+}
+
+uint32_t UserVarStruct::getUpdateSequence(taskIndex_t taskIndex) const
+{
+  if (validTaskIndex(taskIndex)) {
+    return _taskUpdateSequence[taskIndex];
+  }
+  return 0;
+}
+
+uint32_t UserVarStruct::getUpdateTime(taskIndex_t taskIndex) const
+{
+  if (validTaskIndex(taskIndex)) {
+    return _taskUpdateTime[taskIndex];
+  }
+  return 0;
+}
+
+#endif // if FEATURE_JSON_CBOR
+
 const TaskValues_Data_t * UserVarStruct::getRawOrComputed(
   taskIndex_t    taskIndex,
   taskVarIndex_t varNr,
@@ -376,6 +424,25 @@ const TaskValues_Data_t * UserVarStruct::getRawOrComputed(
   if (!raw && Cache.hasFormula(taskIndex, varNr)) {
     auto it = _computed.find(taskIndex);
 
+#ifndef LIMIT_BUILD_SIZE
+    if ((it == _computed.end()) || !it->second.isSet(varNr)) {
+      // Compute all values of this task set since the last read in one go.
+      applyPendingCompiledFormulas(taskIndex);
+      it = _computed.find(taskIndex);
+
+      if ((it == _computed.end()) || !it->second.isSet(varNr)) {
+        TaskFormula_programs *programs = getCompiledFormula(taskIndex, varNr);
+
+        if (programs != nullptr) {
+          START_TIMER;
+          applyCompiledFormula(taskIndex, varNr, getAsDouble(taskIndex, varNr, sensorType, true), *programs, sensorType);
+          STOP_TIMER_TASK_FORMULA(taskIndex);
+          it = _computed.find(taskIndex);
+        }
+      }
+    }
+#endif // ifndef LIMIT_BUILD_SIZE
+
     if ((it == _computed.end()) || !it->second.isSet(varNr)) {
       // Try to compute values which do have a formula but not yet a 'computed' value cached.
       // FIXME TD-er: This may yield unexpected results when formula contains references to %pvalue%
@@ -465,7 +532,7 @@ bool UserVarStruct::applyFormula(taskIndex_t    taskIndex,
       res = false;
     }
 
-    STOP_TIMER(COMPUTE_FORMULA_STATS);
+    STOP_TIMER_TASK_FORMULA(taskIndex);
   }
   return res;
 }
@@ -484,6 +551,38 @@ bool UserVarStruct::applyFormulaAndSet(taskIndex_t                     taskIndex
     return true;
   }
 
+#ifndef LIMIT_BUILD_SIZE
+
+  if (sensorType != Sensor_VType::SENSOR_TYPE_NOT_SET) {
+    TaskFormula_programs *programs = getCompiledFormula(taskIndex, varNr);
+
+    if (programs != nullptr) {
+      if (!Cache.hasFormula_with_prevValue(taskIndex, varNr)) {
+        // Delay calculations until it is read for the first time.
+        auto it = _computed.find(taskIndex);
+
+        if (it != _computed.end()) {
+          it->second.clear(varNr);
+        }
+        bitSet(programs->pending_map, varNr);
+        programs->sensorType[varNr] = sensorType;
+        _rawData[taskIndex].set(varNr, value, sensorType);
+        return true;
+      }
+      START_TIMER;
+      const bool res = applyCompiledFormula(taskIndex, varNr, value, *programs, sensorType);
+      STOP_TIMER_TASK_FORMULA(taskIndex);
+
+      if (res) {
+        _rawData[taskIndex].set(varNr, value, sensorType);
+        return true;
+      }
+
+      // Else fall back to the string based formula
+    }
+  }
+#endif // ifndef LIMIT_BUILD_SIZE
+
   // Use a temporary TaskValues_Data_t object to have uniform formatting
   TaskValues_Data_t tmp;
 
@@ -546,3 +645,108 @@ String UserVarStruct::getPreviousValue(taskIndex_t taskIndex, taskVarIndex_t var
   // Do not call getAsString here as this will result in stack overflow.
   return EMPTY_STRING;
 }
+
+#ifndef LIMIT_BUILD_SIZE
+void TaskFormula_programs::setPrevValue(taskVarIndex_t varNr, const String& value)
+{
+  bitClear(prevValue_set_map, varNr);
+  bitClear(prevValue_invalid_map, varNr);
+
+  if (value.isEmpty()) {
+    return;
+  }
+
+  if (validDoubleFromString(value, prevValue[varNr])) {
+    bitSet(prevValue_set_map, varNr);
+  } else {
+    bitSet(prevValue_invalid_map, varNr);
+  }
+}
+
+TaskFormula_programs * UserVarStruct::getCompiledFormula(taskIndex_t taskIndex, taskVarIndex_t varNr) const
+{
+  if (!validTaskIndex(taskIndex) || !validTaskVarIndex(varNr)) {
+    return nullptr;
+  }
+  auto it = _formulaPrograms.find(taskIndex);
+
+  if (it == _formulaPrograms.end()) {
+    it = _formulaPrograms.emplace(taskIndex, TaskFormula_programs()).first;
+  }
+  TaskFormula_programs& programs = it->second;
+
+  if (!bitRead(programs.checked_map, varNr)) {
+    bitSet(programs.checked_map, varNr);
+
+    const String formula = getPreprocessedFormula(taskIndex, varNr);
+
+    if (!formula.isEmpty()
+        #if FEATURE_STRING_VARIABLES
+        && formula[1] != TASK_VALUE_PRESENTATION_PREFIX_CHAR
+        #endif // FEATURE_STRING_VARIABLES
+        && RulesCalculate.compile(formula, programs.program[varNr])) {
+      bitSet(programs.compiled_map, varNr);
+
+      // The previous value may already be known when the task was read before compiling.
+      const String prev_str = getPreviousValue(taskIndex, varNr, Sensor_VType::SENSOR_TYPE_NOT_SET);
+      programs.setPrevValue(varNr, prev_str);
+    }
+  }
+
+  if (programs.isCompiled(varNr)) {
+    return &programs;
+  }
+  return nullptr;
+}
+
+bool UserVarStruct::applyCompiledFormula(taskIndex_t                     taskIndex,
+                                         taskVarIndex_t                  varNr,
+                                         const ESPEASY_RULES_FLOAT_TYPE& value,
+                                         TaskFormula_programs          & programs,
+                                         Sensor_VType                    sensorType) const
+{
+  bitClear(programs.pending_map, varNr);
+
+  // The string based formula does not accept "nan" or "inf" as a value.
+  if (!isValidDouble(value) || bitRead(programs.prevValue_invalid_map, varNr)) {
+    return false;
+  }
+
+  const ESPEASY_RULES_FLOAT_TYPE pvalue = bitRead(programs.prevValue_set_map, varNr)
+    ? programs.prevValue[varNr]
+    : value;
+
+  ESPEASY_RULES_FLOAT_TYPE result{};
+
+  if (isError(RulesCalculate.evaluate(programs.program[varNr], value, pvalue, result))) {
+    return false;
+  }
+  _computed[taskIndex].set(varNr, result, sensorType);
+  return true;
+}
+
+void UserVarStruct::applyPendingCompiledFormulas(taskIndex_t taskIndex) const
+{
+  auto it = _formulaPrograms.find(taskIndex);
+
+  if ((it == _formulaPrograms.end()) || (it->second.pending_map == 0)) {
+    return;
+  }
+  START_TIMER;
+  TaskFormula_programs& programs = it->second;
+
+  for (taskVarIndex_t varNr = 0; validTaskVarIndex(varNr); ++varNr) {
+    if (bitRead(programs.pending_map, varNr)) {
+      const Sensor_VType sensorType = programs.sensorType[varNr];
+      applyCompiledFormula(
+        taskIndex,
+        varNr,
+        getAsDouble(taskIndex, varNr, sensorType, true),
+        programs,
+        sensorType);
+    }
+  }
+  STOP_TIMER_TASK_FORMULA(taskIndex);
+}
+
+#endif // ifndef LIMIT_BUILD_SIZE
@@ -8,6 +8,8 @@
 #include "../DataTypes/TaskIndex.h"
 #include "../DataTypes/TaskValues_Data.h"
 
+#include "../Helpers/Rules_calculate.h"
+
 #include <vector>
 #include <map>
 
@@ -32,6 +34,37 @@ struct TaskValues_Data_cache {
   uint32_t          values_set_map{};
 };
 
+#ifndef LIMIT_BUILD_SIZE
+
+// Compiled formulas of all task values of a task.
+// Values set via applyFormulaAndSet() are marked pending and all pending values
+// are computed in one go when the first one is read.
+struct TaskFormula_programs {
+  bool isCompiled(taskVarIndex_t varNr) const {
+    return bitRead(compiled_map, varNr);
+  }
+
+  void setPrevValue(taskVarIndex_t varNr, const String& value);
+
+  RulesCalculate_program_t program[VARS_PER_TASK];
+
+  // Values of %pvalue%, as formatted after the last PLUGIN_READ
+  ESPEASY_RULES_FLOAT_TYPE prevValue[VARS_PER_TASK]{};
+
+  // Sensor type of the pending raw values
+  Sensor_VType sensorType[VARS_PER_TASK]{};
+
+  // Formula has been compiled, or tried to compile
+  uint8_t checked_map{};
+  uint8_t compiled_map{};
+  uint8_t pending_map{};
+  uint8_t prevValue_set_map{};
+
+  // Previous value was set, but is not a number. Must use the string formula to get the same result.
+  uint8_t prevValue_invalid_map{};
+};
+#endif // ifndef LIMIT_BUILD_SIZE
+
 struct UserVarStruct {
   UserVarStruct() = default;
 
@@ -136,6 +169,22 @@ struct UserVarStruct {
 
   void                     markPluginRead(taskIndex_t taskIndex);
 
+#if FEATURE_JSON_CBOR
+
+  // Keep track of sent task values, to be able to only output tasks with new values.
+  void     markTaskValuesSent(taskIndex_t taskIndex);
+
+  // Sequence nr of the last sent task values of any task, 0 = none sent yet
+  uint32_t getUpdateSequence() const {
+    return _updateSequence;
+  }
+
+  uint32_t getUpdateSequence(taskIndex_t taskIndex) const;
+
+  // Unix time of the last sent task values of a task, 0 = none sent yet
+  uint32_t getUpdateTime(taskIndex_t taskIndex) const;
+#endif // if FEATURE_JSON_CBOR
+
 private:
 
   const TaskValues_Data_t* getRawOrComputed(taskIndex_t    taskIndex,
@@ -158,6 +207,12 @@ private:
   // Raw TaskValues data as stored in RTC
   TaskValues_Data_t _rawData[TASKS_MAX]{};
 
+#if FEATURE_JSON_CBOR
+  uint32_t _updateSequence{};
+  uint32_t _taskUpdateSequence[TASKS_MAX]{};
+  uint32_t _taskUpdateTime[TASKS_MAX]{};
+#endif // if FEATURE_JSON_CBOR
+
   // Computed TaskValues for those tasks which use a formula
   // Not stored in RTC, but used to cache calculated values.
   // Since we can refer to any previous value in a formula (%pvalue%),
@@ -166,6 +221,23 @@ private:
 
   String getPreprocessedFormula(taskIndex_t    taskIndex,
                                 taskVarIndex_t varNr) const;
+
+#ifndef LIMIT_BUILD_SIZE
+
+  // @retval nullptr when the formula of this task value cannot be compiled
+  TaskFormula_programs* getCompiledFormula(taskIndex_t    taskIndex,
+                                           taskVarIndex_t varNr) const;
+
+  // @retval false when the value could not be computed and the string based formula must be used.
+  bool                  applyCompiledFormula(taskIndex_t                     taskIndex,
+                                             taskVarIndex_t                  varNr,
+                                             const ESPEASY_RULES_FLOAT_TYPE& value,
+                                             TaskFormula_programs          & programs,
+                                             Sensor_VType                    sensorType) const;
+
+  // Compute all pending values of a task with a compiled formula
+  void                  applyPendingCompiledFormulas(taskIndex_t taskIndex) const;
+#endif // ifndef LIMIT_BUILD_SIZE
 public:
   String getPreviousValue(taskIndex_t    taskIndex,
                           taskVarIndex_t varNr,
@@ -173,6 +245,7 @@ public:
 private:
 #ifndef LIMIT_BUILD_SIZE
   mutable std::map<uint16_t, String>_preprocessedFormula;
+  mutable std::map<taskIndex_t, TaskFormula_programs>_formulaPrograms;
 #endif // ifndef LIMIT_BUILD_SIZE
   mutable std::map<uint16_t, String>_prevValue;
 };
@@ -11,6 +11,7 @@
 
 #include "../DataStructs/ControllerSettingsStruct.h"
 #include "../DataStructs/ESPEasy_EventStruct.h"
+#include "../DataStructs/SampleRecord.h"
 
 #include "../DataTypes/ESPEasy_plugin_functions.h"
 #include "../DataTypes/SPI_options.h"
@@ -25,6 +26,8 @@
 #include "../Globals/MQTT.h"
 #include "../Globals/Plugins.h"
 #include "../Globals/RulesCalculate.h"
+#include "../Globals/RuntimeData.h"
+#include "../Globals/Statistics.h"
 
 #include "../Helpers/_CPlugin_Helper.h"
 
@@ -53,6 +56,13 @@ void sendData(struct EventStruct *event, bool sendEvents)
 #endif // ifndef BUILD_NO_RAM_TRACKER
   //  LoadTaskSettings(event->TaskIndex);
 
+#if FEATURE_JSON_CBOR
+  UserVar.markTaskValuesSent(event->TaskIndex);
+#endif // if FEATURE_JSON_CBOR
+
+  // Task values are formatted only once for rules, logger and all controllers.
+  SampleRecord sampleRecord(event);
+
   if (Settings.UseRules && sendEvents) {
     createRuleEvents(event);
   }
@@ -1292,6 +1302,9 @@ void SensorSendTask(struct EventStruct *event, unsigned long timestampUnixTime,
     String dummy;
 
     if (PluginCall(PLUGIN_READ, &TempEvent, dummy)) {
+      if (firstSensorReadMoment == 0) {
+        firstSensorReadMoment = millis();
+      }
       sendData(&TempEvent);
     }
     STOP_TIMER(SENSOR_SEND_TASK);
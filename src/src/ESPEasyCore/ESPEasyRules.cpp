@@ -99,9 +99,7 @@ void rulesProcessing(const String& event) {
   const unsigned long timer = millis();
 #endif // ifndef BUILD_NO_DEBUG
 #ifndef BUILD_NO_DEBUG
-  if (loglevelActiveFor(LOG_LEVEL_INFO)) {
-    addLogMove(LOG_LEVEL_INFO, concat(F("EVENT: "), event));
-  }
+  addLogFormat(LOG_LEVEL_INFO, F("EVENT: %s"), event);
 #endif
   if (Settings.OldRulesEngine()) {
     bool eventHandled = false;
@@ -128,8 +126,8 @@ void rulesProcessing(const String& event) {
     }
     # ifndef BUILD_NO_DEBUG
     else {
-      addLog(LOG_LEVEL_DEBUG, strformat(F("EVENT: %s is ingnored. File %s not found."),
-             event.c_str(), fileName.c_str()));
+      addLogFormat(LOG_LEVEL_DEBUG, F("EVENT: %s is ingnored. File %s not found."),
+                   event, fileName);
     }
     # endif    // ifndef BUILD_NO_DEBUG
     #endif // WEBSERVER_NEW_RULES
@@ -137,9 +135,7 @@ void rulesProcessing(const String& event) {
 
 #ifndef BUILD_NO_DEBUG
 
-  if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
-    addLogMove(LOG_LEVEL_DEBUG, strformat(F("EVENT: %s Processing: %d ms"), event.c_str(), timePassedSince(timer)));
-  }
+  addLogFormat(LOG_LEVEL_DEBUG, F("EVENT: %s Processing: %d ms"), event, timePassedSince(timer));
 #endif // ifndef BUILD_NO_DEBUG
   STOP_TIMER(RULES_PROCESSING);
   backgroundtasks();
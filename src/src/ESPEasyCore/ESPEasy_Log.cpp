@@ -266,3 +266,23 @@ void addToLogMove(uint8_t logLevel, String&& str)
   #endif // ifdef ESP32
   Logging.addLogEntry(LogEntry_t(logLevel, std::move(str)));
 }
+
+bool addLogRecordAllowed()
+{
+  #ifdef ESP32
+
+  if (xPortInIsrContext()) {
+    // When called from an ISR, you should not send out logs.
+    // Allocating memory from within an ISR is a big no-no.
+    // Also long-time blocking like sending logs (especially to a syslog server)
+    // is also really not a good idea from an ISR call.
+    return false;
+  }
+  #endif // ifdef ESP32
+  return true;
+}
+
+void addLogRecord(uint8_t logLevel, LogRecord_writer&& record)
+{
+  Logging.addLogEntry(LogEntry_t(logLevel, std::move(record)));
+}
@@ -5,12 +5,22 @@
 #include "../DataTypes/LogLevels.h"
 
 #include "../DataStructs/LogEntry.h"
+#include "../DataStructs/LogRecord.h"
 
 
 
 // Move the log String so it does not have to be copied in the web log
 #define addLogMove(L, S) addToLogMove(L, std::move(S))
 
+// printf-style logging, without formatting the log line.
+// Format string and arguments are stored in a LogRecord and only formatted
+// when a log destination (serial, web log, syslog, SD) reads the log entry.
+// Arguments are copied, so they may go out of scope.
+// Supported arguments: integer types, float, double, const char *, String and F() strings.
+// N.B. Format string must be a F() string.
+#define addLogFormat(L, FMT, ...) \
+  do { if (loglevelActiveFor(L)) { addLogRecord(L, FMT, ## __VA_ARGS__); } } while (0)
+
 enum LogDestination : uint8_t;
 
 /********************************************************************************************\
@@ -47,3 +57,21 @@ void    addLog(uint8_t       logLevel,
 
 void    addToLogMove(uint8_t  logLevel,
                      String&& str);
+
+// False when called from an ISR, as no memory may be allocated then.
+bool    addLogRecordAllowed();
+
+void    addLogRecord(uint8_t             logLevel,
+                     LogRecord_writer && record);
+
+template<typename ... Args>
+void addLogRecord(uint8_t                    logLevel,
+                  const __FlashStringHelper *format,
+                  const Args&...             args)
+{
+  if (!addLogRecordAllowed()) { return; }
+  LogRecord_writer record(format, LogRecord_writer::argsSize(args ...));
+
+  record.add(args ...);
+  addLogRecord(logLevel, std::move(record));
+}
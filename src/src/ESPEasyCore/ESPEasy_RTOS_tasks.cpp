@@ -0,0 +1,165 @@
+#include "../ESPEasyCore/ESPEasy_RTOS_tasks.h"
+
+#ifdef USE_RTOS_MULTITASKING
+
+# include "../../ESPEasy-Globals.h"
+# include "../../ESPEasy/net/ESPEasyNetwork.h"
+# include "../../ESPEasy/net/Globals/NetworkState.h"
+# include "../../ESPEasy/net/wifi/ESPEasyWifi.h"
+# include "../ESPEasyCore/ESPEasy_Log.h"
+# include "../DataStructs/TimingStats.h"
+# include "../Helpers/ESPEasyMutex.h"
+# include "../Helpers/ESPEasy_time_calc.h"
+# include "../Globals/Settings.h"
+# include "../Helpers/Networking.h"
+# include "../WebServer/ESPEasy_WebServer.h"
+
+# include <atomic>
+
+// The network stack (WiFi/lwIP) runs on the core not used by the Arduino loop task.
+# if CONFIG_FREERTOS_UNICORE
+#  define RTOS_SERVER_TASK_CORE  0
+# else // if CONFIG_FREERTOS_UNICORE
+#  define RTOS_SERVER_TASK_CORE  ((CONFIG_ARDUINO_RUNNING_CORE == 0) ? 1 : 0)
+# endif // if CONFIG_FREERTOS_UNICORE
+
+# define RTOS_SERVER_TASK_INTERVAL_MSEC  5
+
+// Max. time the main loop waits for the server task to take the lock.
+# define RTOS_MAIN_LOOP_HANDOVER_USEC  1000
+
+
+ESPEasy_Mutex     RTOS_mainLoopMutex;
+std::atomic<bool> RTOS_serverTaskWaiting(false);
+bool              RTOS_mainLoopLocked = false;
+int8_t            RTOS_serverTaskCore = -1;
+int8_t            RTOS_mainLoopCore   = -1;
+
+// Only changed while holding the lock, so they can be read while holding it
+uint64_t RTOS_serverTaskBusy_usec = 0;
+uint64_t RTOS_mainLoopBusy_usec   = 0;
+uint64_t RTOS_mainLoopLockStart   = 0;
+uint64_t RTOS_statsStart          = 0;
+
+
+void RTOS_TaskServers(void *parameter)
+{
+  while (true) {
+    delay(RTOS_SERVER_TASK_INTERVAL_MSEC);
+
+    RTOS_serverTaskWaiting = true;
+    RTOS_mainLoopMutex.lock();
+    RTOS_serverTaskWaiting = false;
+
+    const uint64_t start = getMicros64();
+
+    if (webserverRunning &&
+        (ESPEasy::net::NetworkConnected() || ESPEasy::net::wifi::wifiAPmodeActivelyUsed())) {
+      START_TIMER
+      web_server.handleClient();
+      STOP_TIMER(WEBSERVER_HANDLE_CLIENT);
+    }
+    # if FEATURE_ESPEASY_P2P
+
+    if (ESPEasy::net::NetworkConnected()) {
+      checkUDP();
+    }
+    # endif // if FEATURE_ESPEASY_P2P
+    RTOS_serverTaskBusy_usec += usecPassedSince(start);
+    RTOS_mainLoopMutex.unlock();
+  }
+}
+
+void RTOS_startTasks()
+{
+  UseRTOSMultitasking = Settings.UseRTOSMultitasking;
+
+  if (!UseRTOSMultitasking) {
+    return;
+  }
+
+  if (loglevelActiveFor(LOG_LEVEL_INFO)) {
+    addLogMove(LOG_LEVEL_INFO, strformat(
+                 F("RTOS : Launching server task on core %d, main loop on core %d"),
+                 RTOS_SERVER_TASK_CORE,
+                 xPortGetCoreID()));
+  }
+  RTOS_statsStart     = getMicros64();
+  RTOS_serverTaskCore = RTOS_SERVER_TASK_CORE;
+  RTOS_mainLoopCore   = xPortGetCoreID();
+
+  // The rest of setup() runs in the same task as the main loop,
+  // so take the lock before the server task can run.
+  // It is released at the end of the first main loop iteration.
+  RTOS_mainLoopBegin();
+
+  xTaskCreatePinnedToCore(
+    RTOS_TaskServers,      /* Function to implement the task */
+    "RTOS_TaskServers",    /* Name of the task */
+    16384,                 /* Stack size in words */
+    nullptr,               /* Task input parameter */
+    1,                     /* Priority of the task */
+    nullptr,               /* Task handle. */
+    RTOS_SERVER_TASK_CORE);/* Core where the task should run */
+}
+
+void RTOS_mainLoopBegin()
+{
+  if (UseRTOSMultitasking && !RTOS_mainLoopLocked) {
+    RTOS_mainLoopMutex.lock();
+    RTOS_mainLoopLocked    = true;
+    RTOS_mainLoopLockStart = getMicros64();
+  }
+}
+
+void RTOS_mainLoopEnd()
+{
+  if (!RTOS_mainLoopLocked) { return; }
+  RTOS_mainLoopBusy_usec += usecPassedSince(RTOS_mainLoopLockStart);
+  RTOS_mainLoopMutex.unlock();
+  RTOS_mainLoopLocked = false;
+
+  // A released mutex is not handed over to a waiting task,
+  // so give the server task some time to take it before the next loop iteration.
+  if (RTOS_serverTaskWaiting) {
+    const uint64_t start = getMicros64();
+
+    while (RTOS_serverTaskWaiting && (usecPassedSince(start) < RTOS_MAIN_LOOP_HANDOVER_USEC)) {
+      taskYIELD();
+    }
+  }
+}
+
+int8_t RTOS_getServerTaskCore()
+{
+  return RTOS_serverTaskCore;
+}
+
+int8_t RTOS_getMainLoopCore()
+{
+  return RTOS_mainLoopCore;
+}
+
+uint32_t RTOS_getLoad(uint64_t busy_usec)
+{
+  const int64_t elapsed_usec = usecPassedSince(RTOS_statsStart);
+
+  if ((RTOS_serverTaskCore < 0) || (elapsed_usec <= 0)) {
+    return 0;
+  }
+
+  // In 0.1% units
+  return (busy_usec * 1000) / static_cast<uint64_t>(elapsed_usec);
+}
+
+uint32_t RTOS_getServerTaskLoad()
+{
+  return RTOS_getLoad(RTOS_serverTaskBusy_usec);
+}
+
+uint32_t RTOS_getMainLoopLoad()
+{
+  return RTOS_getLoad(RTOS_mainLoopBusy_usec);
+}
+
+#endif // ifdef USE_RTOS_MULTITASKING
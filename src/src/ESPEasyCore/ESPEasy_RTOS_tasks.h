@@ -0,0 +1,43 @@
+#ifndef ESPEASYCORE_ESPEASY_RTOS_TASKS_H
+#define ESPEASYCORE_ESPEASY_RTOS_TASKS_H
+
+#include "../../ESPEasy_common.h"
+
+#ifdef USE_RTOS_MULTITASKING
+
+/*********************************************************************************************\
+ * RTOS multitasking
+ *
+ * When enabled, the web server and UDP (p2p) are handled in a separate RTOS task,
+ * running on the core also used by the network stack.
+ * The Arduino loop task keeps running the scheduler, plugins, rules and controllers.
+ *
+ * Both tasks share most of the global state (Settings, UserVar, Scheduler, event queues, log buffer)
+ * so only one of them may run ESPEasy code at a time.
+ * The main loop holds the lock during each loop iteration and hands it over
+ * to the server task between iterations when the server task is waiting for it.
+\*********************************************************************************************/
+
+// Start the RTOS tasks, called at the end of setup()
+// The main loop lock is taken before starting the tasks.
+void RTOS_startTasks();
+
+// Called at the start and end of each main loop iteration.
+void RTOS_mainLoopBegin();
+void RTOS_mainLoopEnd();
+
+// Core on which the server task runs, -1 when not running
+int8_t   RTOS_getServerTaskCore();
+
+int8_t   RTOS_getMainLoopCore();
+
+// Time spent in the server task and in the main loop (holding the lock),
+// in 0.1% of the elapsed time since the tasks were started.
+// Reading does not reset these figures.
+uint32_t RTOS_getServerTaskLoad();
+
+uint32_t RTOS_getMainLoopLoad();
+
+#endif // ifdef USE_RTOS_MULTITASKING
+
+#endif // ifndef ESPEASYCORE_ESPEASY_RTOS_TASKS_H
@@ -80,8 +80,10 @@ void backgroundtasks()
   #endif
   Logging.loop();
 
+  serial();
+
   if (!UseRTOSMultitasking) {
-    serial();
+    // When using RTOS multitasking, UDP is handled in the server task
 
 //    if (webserverRunning) {
 /*
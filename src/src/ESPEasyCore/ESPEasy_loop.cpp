@@ -9,6 +9,9 @@
 #include "../Commands/InternalCommands_decoder.h"
 #include "../DataStructs/TimingStats.h"
 #include "../ESPEasyCore/ESPEasy_Log.h"
+#ifdef USE_RTOS_MULTITASKING
+# include "../ESPEasyCore/ESPEasy_RTOS_tasks.h"
+#endif // ifdef USE_RTOS_MULTITASKING
 #include "../ESPEasyCore/ESPEasy_backgroundtasks.h"
 #include "../Globals/ESPEasy_Scheduler.h"
 #include "../Globals/EventQueue.h"
@@ -64,6 +67,9 @@ void ESPEasy_loop()
   #ifdef USE_SECOND_HEAP
   HeapSelectDram ephemeral;
   #endif
+  #ifdef USE_RTOS_MULTITASKING
+  RTOS_mainLoopBegin();
+  #endif // ifdef USE_RTOS_MULTITASKING
   /*
      //FIXME TD-er: No idea what this does.
      if(MainLoopCall_ptr)
@@ -170,10 +176,7 @@ void ESPEasy_loop()
   // normal mode, run each task when its time
   else
   {
-    if (!UseRTOSMultitasking) {
-      // On ESP32, when using RTOS multitasking, the schedule is executed in a separate RTOS task
-      Scheduler.handle_schedule();
-    }
+    Scheduler.handle_schedule();
   }
 
   // Calls above may have received/generated commands for the command queue, thus need to process them.
@@ -185,4 +188,7 @@ void ESPEasy_loop()
 
     // deepsleep will never return, its a special kind of reboot
   }
+  #ifdef USE_RTOS_MULTITASKING
+  RTOS_mainLoopEnd();
+  #endif // ifdef USE_RTOS_MULTITASKING
 }
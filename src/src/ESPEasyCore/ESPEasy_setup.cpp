@@ -37,6 +37,7 @@
 
 
 #ifdef USE_RTOS_MULTITASKING
+# include "../ESPEasyCore/ESPEasy_RTOS_tasks.h"
 # include "../Helpers/Networking.h"
 # include "../Helpers/PeriodicalActions.h"
 #endif // ifdef USE_RTOS_MULTITASKING
@@ -77,44 +78,6 @@
 #endif // ifdef ESP32
 
 
-#ifdef USE_RTOS_MULTITASKING
-
-void RTOS_TaskServers(void *parameter)
-{
-  while (true) {
-    delay(100);
-    web_server.handleClient();
-    # if FEATURE_ESPEASY_P2P
-    checkUDP();
-    # endif // if FEATURE_ESPEASY_P2P
-  }
-}
-
-void RTOS_TaskSerial(void *parameter)
-{
-  while (true) {
-    delay(100);
-    serial();
-  }
-}
-
-void RTOS_Task10ps(void *parameter)
-{
-  while (true) {
-    delay(100);
-    run10TimesPerSecond();
-  }
-}
-
-void RTOS_HandleSchedule(void *parameter)
-{
-  while (true) {
-    Scheduler.handle_schedule();
-  }
-}
-
-#endif // ifdef USE_RTOS_MULTITASKING
-
 /*********************************************************************************************\
 * ISR call back function for handling the watchdog.
 \*********************************************************************************************/
@@ -361,6 +324,11 @@ void ESPEasy_setup()
   #endif // ifndef BUILD_NO_RAM_TRACKER
 
   //  progMemMD5check();
+  #if FEATURE_SETTINGS_READ_BATCH
+
+  // Keep settings file open until all plugins are initialized
+  beginSettingsReadBatch();
+  #endif // if FEATURE_SETTINGS_READ_BATCH
   LoadSettings();
 #if FEATURE_DEFINE_SERIAL_CONSOLE_PORT
   ESPEasy_Console.reInit();
@@ -481,6 +449,9 @@ void ESPEasy_setup()
     serialPrintln(String(Settings.Version));
     serialPrintln(F("INIT : Incorrect PID or version!"));
     delay(1000);
+    #if FEATURE_SETTINGS_READ_BATCH
+    endSettingsReadBatch();
+    #endif // if FEATURE_SETTINGS_READ_BATCH
     ResetFactory();
   }
 
@@ -518,6 +489,9 @@ void ESPEasy_setup()
   #endif // if FEATURE_NOTIFIER
 
   PluginInit();
+  #if FEATURE_SETTINGS_READ_BATCH
+  endSettingsReadBatch();
+  #endif // if FEATURE_SETTINGS_READ_BATCH
 
   initSerial(); // Plugins may have altered serial, so re-init serial
 
@@ -624,24 +598,7 @@ void ESPEasy_setup()
 
 
   #ifdef USE_RTOS_MULTITASKING
-  UseRTOSMultitasking = Settings.UseRTOSMultitasking;
-
-  if (UseRTOSMultitasking) {
-    if (loglevelActiveFor(LOG_LEVEL_INFO)) {
-      addLog(LOG_LEVEL_INFO, F("RTOS : Launching tasks"));
-    }
-    xTaskCreatePinnedToCore(RTOS_TaskServers, "RTOS_TaskServers", 16384, nullptr, 1, nullptr, 1);
-    xTaskCreatePinnedToCore(RTOS_TaskSerial,  "RTOS_TaskSerial",  8192,  nullptr, 1, nullptr, 1);
-    xTaskCreatePinnedToCore(RTOS_Task10ps,    "RTOS_Task10ps",    8192,  nullptr, 1, nullptr, 1);
-    xTaskCreatePinnedToCore(
-      RTOS_HandleSchedule,   /* Function to implement the task */
-      "RTOS_HandleSchedule", /* Name of the task */
-      16384,                 /* Stack size in words */
-      nullptr,               /* Task input parameter */
-      1,                     /* Priority of the task */
-      nullptr,               /* Task handle. */
-      1);                    /* Core where the task should run */
-  }
+  RTOS_startTasks();
   #endif // ifdef USE_RTOS_MULTITASKING
 
   // Start the interval timers at N msec from now.
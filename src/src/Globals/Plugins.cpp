@@ -29,6 +29,7 @@
 #include "../Helpers/ESPEasyRTC.h"
 #include "../Helpers/ESPEasy_Storage.h"
 #include "../Helpers/Hardware_I2C.h"
+#include "../Helpers/I2C_BusScheduler.h"
 #include "../Helpers/Misc.h"
 #include "../Helpers/_Plugin_init.h"
 #include "../Helpers/PortStatus.h"
@@ -212,6 +213,11 @@ bool prepare_I2C_by_taskIndex(taskIndex_t taskIndex, deviceIndex_t DeviceIndex)
   }
 
   if (Device[DeviceIndex].Type != DEVICE_TYPE_I2C) {
+    #if FEATURE_I2C_BUS_SCHEDULER
+
+    // Make sure the bus is in its default state, like after a non-batched I2C task call
+    I2C_flushDeferredPostTask();
+    #endif // if FEATURE_I2C_BUS_SCHEDULER
     return true; // No I2C task, so consider all-OK
   }
 
@@ -229,6 +235,10 @@ bool prepare_I2C_by_taskIndex(taskIndex_t taskIndex, deviceIndex_t DeviceIndex)
   const uint8_t i2cBus = 0;
   #endif // if FEATURE_I2C_MULTIPLE
 
+  #if FEATURE_I2C_BUS_SCHEDULER
+  I2C_flushDeferredPostTaskOnOtherBus(i2cBus);
+  #endif // if FEATURE_I2C_BUS_SCHEDULER
+
   if (bitRead(Settings.I2C_SPI_bus_Flags[taskIndex], I2C_FLAGS_SLOW_SPEED)) {
     I2CSelectLowClockSpeed(i2cBus);  // Set to slow, also switch the bus
   } else {
@@ -236,12 +246,23 @@ bool prepare_I2C_by_taskIndex(taskIndex_t taskIndex, deviceIndex_t DeviceIndex)
   }
 
   #if FEATURE_I2CMULTIPLEXER
+  # if FEATURE_I2C_BUS_SCHEDULER
+
+  if (!I2CMultiplexerPortSelectedForTask(taskIndex)) {
+    // A previous task in the same batch may have left a channel selected.
+    I2CMultiplexerOff(i2cBus);
+  }
+  # endif // if FEATURE_I2C_BUS_SCHEDULER
   I2CMultiplexerSelectByTaskIndex(taskIndex);
 
   // Output is selected after this write, so now we must make sure the
   // frequency is set before anything else is sent.
   #endif // if FEATURE_I2CMULTIPLEXER
 
+  #if FEATURE_I2C_BUS_SCHEDULER
+  I2C_startTransaction(i2cBus);
+  #endif // if FEATURE_I2C_BUS_SCHEDULER
+
   return true;
 }
 
@@ -258,6 +279,14 @@ void post_I2C_by_taskIndex(taskIndex_t taskIndex, deviceIndex_t DeviceIndex) {
   #else // if FEATURE_I2C_MULTIPLE
   const uint8_t i2cBus = 0;
   #endif // ifdef ESP32
+  #if FEATURE_I2C_BUS_SCHEDULER
+  I2C_endTransaction(i2cBus);
+
+  if (I2C_deferPostTask(i2cBus)) {
+    // Next task in the batch may use the same bus state
+    return;
+  }
+  #endif // if FEATURE_I2C_BUS_SCHEDULER
   #if FEATURE_I2CMULTIPLEXER
   I2CMultiplexerOff(i2cBus);
   #endif // if FEATURE_I2CMULTIPLEXER
@@ -432,7 +461,7 @@ bool PluginCallForTask(taskIndex_t taskIndex, uint8_t Function, EventStruct *Tem
           START_TIMER;
           retval = (do_PluginCall(DeviceIndex, Function, TempEvent, command));
 
-          STOP_TIMER_TASK(DeviceIndex, Function);
+          STOP_TIMER_TASK_INDEX(taskIndex, DeviceIndex, Function);
 
           if (Function == PLUGIN_INIT) {
               #if FEATURE_PLUGIN_STATS
@@ -695,6 +724,17 @@ bool PluginCall(uint8_t Function, struct EventStruct *event, String& str)
       }
       bool result = true;
 
+      #if FEATURE_I2C_BUS_SCHEDULER
+
+      // Periodic calls are done as a batch, so consecutive tasks using the same I2C bus state
+      // do not need to reset and select the multiplexer channel and clock speed in between.
+      const bool batchI2C = Function != PLUGIN_INIT;
+
+      if (batchI2C) {
+        I2C_beginBatch();
+      }
+      #endif // if FEATURE_I2C_BUS_SCHEDULER
+
       for (taskIndex_t taskIndex = 0; taskIndex < TASKS_MAX; taskIndex++)
       {
         #ifndef BUILD_NO_DEBUG
@@ -754,6 +794,12 @@ bool PluginCall(uint8_t Function, struct EventStruct *event, String& str)
           #endif // ifndef BUILD_NO_DEBUG
         }
       }
+      #if FEATURE_I2C_BUS_SCHEDULER
+
+      if (batchI2C) {
+        I2C_endBatch();
+      }
+      #endif // if FEATURE_I2C_BUS_SCHEDULER
 
       return result;
     }
@@ -972,7 +1018,7 @@ bool PluginCall(uint8_t Function, struct EventStruct *event, String& str)
           queueTaskEvent(F("TaskExit"), event->TaskIndex, retval);
           updateActiveTaskUseSerial0();
         }
-        STOP_TIMER_TASK(DeviceIndex, Function);
+        STOP_TIMER_TASK_INDEX(event->TaskIndex, DeviceIndex, Function);
         #if FEATURE_I2C_DEVICE_CHECK
       }
         #endif // if FEATURE_I2C_DEVICE_CHECK
@@ -1083,7 +1129,7 @@ bool PluginCall(uint8_t Function, struct EventStruct *event, String& str)
         }
 
 
-        STOP_TIMER_TASK(DeviceIndex, Function);
+        STOP_TIMER_TASK_INDEX(event->TaskIndex, DeviceIndex, Function);
         delay(0); // SMY: call delay(0) unconditionally
         return retval;
       }
@@ -1125,7 +1171,7 @@ bool PluginCall(uint8_t Function, struct EventStruct *event, String& str)
             }
           }
         }
-        STOP_TIMER_TASK(DeviceIndex, Function);
+        STOP_TIMER_TASK_INDEX(event->TaskIndex, DeviceIndex, Function);
         delay(0); // SMY: call delay(0) unconditionally
         return retval;
       }
@@ -26,6 +26,7 @@ float loop_usec_duration_total  = 0.0f;
 
 
 uint32_t dailyResetCounter                   = 0;
+uint32_t firstSensorReadMoment               = 0;
 
 ESPEASY_VOLATILE(uint32_t) sw_watchdog_callback_count{};
 
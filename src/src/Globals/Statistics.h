@@ -42,6 +42,9 @@ extern uint32_t loopCounter_full;
 extern float loop_usec_duration_total;
 
 extern uint32_t dailyResetCounter;
+
+// Uptime in msec of the first sensor read after boot, 0 = no sensor read yet
+extern uint32_t firstSensorReadMoment;
 extern ESPEASY_VOLATILE(uint32_t) sw_watchdog_callback_count;
 
 #if FEATURE_CLEAR_I2C_STUCK
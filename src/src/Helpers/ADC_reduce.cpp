@@ -0,0 +1,79 @@
+#include "../Helpers/ADC_reduce.h"
+
+#include <math.h>
+
+void ADC_reduce_t::add(const uint16_t *samples, size_t nrSamples)
+{
+  if ((samples == nullptr) || (nrSamples == 0)) { return; }
+
+  // Keep the accumulators local and the loop free of branches,
+  // so the compiler can keep everything in registers (or vectorize).
+  // Max. block size is limited to keep the 32-bit sum from overflowing.
+  constexpr size_t maxBlockSize = 65536;
+
+  while (nrSamples > 0) {
+    const size_t blockSize = nrSamples < maxBlockSize ? nrSamples : maxBlockSize;
+    uint32_t     blockSum{};
+    uint64_t     blockSumSq{};
+    uint16_t     blockMin = minValue;
+    uint16_t     blockMax = maxValue;
+
+    for (size_t i = 0; i < blockSize; ++i) {
+      const uint32_t value = samples[i];
+      blockSum   += value;
+      blockSumSq += value * value;
+      blockMin    = value < blockMin ? value : blockMin;
+      blockMax    = value > blockMax ? value : blockMax;
+    }
+    count   += blockSize;
+    sum     += blockSum;
+    sumSq   += blockSumSq;
+    minValue = blockMin;
+    maxValue = blockMax;
+
+    samples   += blockSize;
+    nrSamples -= blockSize;
+  }
+}
+
+void ADC_reduce_t::merge(const ADC_reduce_t& other)
+{
+  if (other.count == 0) { return; }
+  count += other.count;
+  sum   += other.sum;
+  sumSq += other.sumSq;
+
+  if (other.minValue < minValue) { minValue = other.minValue; }
+
+  if (other.maxValue > maxValue) { maxValue = other.maxValue; }
+}
+
+void ADC_reduce_t::clear()
+{
+  *this = ADC_reduce_t();
+}
+
+float ADC_reduce_t::getMean() const
+{
+  if (count == 0) { return 0.0f; }
+  return static_cast<double>(sum) / count;
+}
+
+float ADC_reduce_t::getRMS_AC() const
+{
+  if (count == 0) { return 0.0f; }
+
+  // Var = E[x^2] - E[x]^2
+  // Computed in double, as both terms are large and almost equal for a small AC component.
+  const double mean     = static_cast<double>(sum) / count;
+  const double variance = static_cast<double>(sumSq) / count - mean * mean;
+
+  if (variance <= 0.0) { return 0.0f; }
+  return sqrt(variance);
+}
+
+float ADC_reduce_t::getRMS() const
+{
+  if (count == 0) { return 0.0f; }
+  return sqrt(static_cast<double>(sumSq) / count);
+}
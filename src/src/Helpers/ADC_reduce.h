@@ -0,0 +1,39 @@
+#ifndef HELPERS_ADC_REDUCE_H
+#define HELPERS_ADC_REDUCE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/********************************************************************************************\
+   Reduction of a block of raw ADC samples to count, sum, sum of squares, min and max.
+
+   Blocks can be merged, so samples collected over some time can be reduced per block
+   and combined later, without keeping the samples.
+   Does not depend on any ESP specific code.
+ \*********************************************************************************************/
+struct ADC_reduce_t {
+  // Add a block of samples
+  void     add(const uint16_t *samples,
+               size_t          count);
+
+  void     merge(const ADC_reduce_t& other);
+
+  void     clear();
+
+  float    getMean() const;
+
+  // RMS of the AC component, e.g. for current clamps.
+  // This is the standard deviation of the samples.
+  float    getRMS_AC() const;
+
+  // RMS including the DC component
+  float    getRMS() const;
+
+  uint32_t count{};
+  uint64_t sum{};
+  uint64_t sumSq{};
+  uint16_t minValue = UINT16_MAX;
+  uint16_t maxValue{};
+};
+
+#endif // ifndef HELPERS_ADC_REDUCE_H
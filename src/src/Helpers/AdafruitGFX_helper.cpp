@@ -912,6 +912,142 @@ void AdafruitGFX_helper::invertDisplay(bool i) {
   _display->invertDisplay(_displayInverted);
 }
 
+# if ADAGFX_ENABLE_TEXT_CACHE
+
+/****************************************************************************
+ * setTextCache(): Enable/disable the text cache, always starts empty
+ ***************************************************************************/
+void AdafruitGFX_helper::setTextCache(bool state) {
+  _textCacheEnabled = state;
+  invalidateTextCache();
+}
+
+/****************************************************************************
+ * invalidateTextCache(): Forget all retained texts
+ ***************************************************************************/
+void AdafruitGFX_helper::invalidateTextCache() {
+  _textCache.clear();
+}
+
+/****************************************************************************
+ * checkTextCache(): Check if the text was already printed at the same location with the same attributes
+ * Returns false if nothing needs to be printed.
+ * For fixed-width fonts, text and x are updated to only print the changed range of characters.
+ ***************************************************************************/
+bool AdafruitGFX_helper::checkTextCache(String        & text,
+                                        int16_t       & x,
+                                        const int16_t & y,
+                                        const uint8_t & textSize,
+                                        const uint16_t& color,
+                                        const uint16_t& bkcolor,
+                                        const uint16_t& maxWidth) {
+  _textCacheSkipUpdate = false;
+
+  for (auto it = _textCache.begin(); it != _textCache.end(); ++it) {
+    if ((it->x == x) && (it->y == y)) {
+      if ((it->textSize != textSize) || (it->fontId != _fontId) || (it->color != color) || (it->bkcolor != bkcolor) ||
+          (it->maxWidth != maxWidth) || (it->printMode != static_cast<uint8_t>(_textPrintMode))) {
+        return true; // Different attributes, print all
+      }
+      const uint32_t pixels = it->wText * it->hText;
+
+      if (it->text.equals(text)) {
+        _textCachePixelsSkip += pixels;
+        return false; // Already on display
+      }
+      const int len = text.length();
+
+      if (_isProportional || (color == bkcolor) || (maxWidth != 0) || (len == 0) || (len != static_cast<int>(it->text.length())) ||
+          (_textPrintMode == AdaGFXTextPrintMode::ClearThenTruncate) ||
+          (_textPrintMode == AdaGFXTextPrintMode::ContinueToNextLine)) {
+        return true; // Can't determine the changed area, print all
+      }
+
+      // Same length, fixed-width font: only print the changed characters
+      int first = 0;
+      int last  = len - 1;
+
+      while (text[first] == it->text[first]) { ++first; } // Strings differ, so will stop before len
+
+      while (text[last] == it->text[last]) { --last; }
+
+      _textCachePixelsSkip += (pixels / len) * (len - (last - first + 1));
+      it->text              = text;
+      _textCacheSkipUpdate  = true;
+
+      text = text.substring(first, last + 1);
+      x   += first * _fontwidth * textSize;
+      return true;
+    }
+  }
+  return true;
+}
+
+/****************************************************************************
+ * updateTextCache(): Store printed text and remove any overlapped texts
+ ***************************************************************************/
+void AdafruitGFX_helper::updateTextCache(const String  & text,
+                                         const int16_t & x,
+                                         const int16_t & y,
+                                         const int16_t & xText,
+                                         const int16_t & yText,
+                                         const uint16_t& wText,
+                                         const uint16_t& hText,
+                                         const uint8_t & textSize,
+                                         const uint16_t& color,
+                                         const uint16_t& bkcolor,
+                                         const uint16_t& maxWidth) {
+  for (auto it = _textCache.begin(); it != _textCache.end();) {
+    if (((it->x != x) || (it->y != y)) &&
+        (xText < it->xText + it->wText) && (it->xText < xText + wText) &&
+        (yText < it->yText + it->hText) && (it->yText < yText + hText)) {
+      it = _textCache.erase(it); // Overlapped, so no longer known what's on display
+    } else {
+      ++it;
+    }
+  }
+
+  tTextCacheItem *item = nullptr;
+
+  for (auto& cached : _textCache) {
+    if ((cached.x == x) && (cached.y == y)) { item = &cached; }
+  }
+
+  if (_textCacheSkipUpdate && (nullptr != item)) {
+    return; // Partial update, text and area already set
+  }
+
+  if (nullptr == item) {
+    if (_textCache.size() >= ADAGFX_TEXT_CACHE_MAX_ITEMS) {
+      _textCache.erase(_textCache.begin()); // Drop oldest
+    }
+    _textCache.emplace_back();
+    item        = &_textCache.back();
+    item->xText = xText;
+    item->yText = yText;
+    item->wText = wText;
+    item->hText = hText;
+  } else { // Keep the area covering any previous (longer) text, that's not cleared
+    const int16_t x2 = max(item->xText + item->wText, xText + wText);
+    const int16_t y2 = max(item->yText + item->hText, yText + hText);
+    item->xText = min(item->xText, xText);
+    item->yText = min(item->yText, yText);
+    item->wText = x2 - item->xText;
+    item->hText = y2 - item->yText;
+  }
+  item->text      = text;
+  item->x         = x;
+  item->y         = y;
+  item->color     = color;
+  item->bkcolor   = bkcolor;
+  item->maxWidth  = maxWidth;
+  item->textSize  = textSize;
+  item->fontId    = _fontId;
+  item->printMode = static_cast<uint8_t>(_textPrintMode);
+}
+
+# endif // if ADAGFX_ENABLE_TEXT_CACHE
+
 /****************************************************************************
  * processCommand: Parse string to <command>,<subcommand>[,<arguments>...] and execute that command
  ***************************************************************************/
@@ -932,6 +1068,9 @@ const char adagfx_commands[] PROGMEM =
   # if ADAGFX_ENABLE_BUTTON_DRAW
   "btn|"              // 20..29
   # endif // if ADAGFX_ENABLE_BUTTON_DRAW
+  # if ADAGFX_ENABLE_TEXT_CACHE
+  "tcache|"
+  # endif // if ADAGFX_ENABLE_TEXT_CACHE
   # if ADAGFX_ENABLE_FRAMED_WINDOW
   "win|defwin|delwin" // 30..
   # endif // if ADAGFX_ENABLE_FRAMED_WINDOW
@@ -976,6 +1115,9 @@ enum class adagfx_commands_e : int8_t {
   # if ADAGFX_ENABLE_BUTTON_DRAW
   btn, // 29
   # endif // if ADAGFX_ENABLE_BUTTON_DRAW
+  # if ADAGFX_ENABLE_TEXT_CACHE
+  tcache,
+  # endif // if ADAGFX_ENABLE_TEXT_CACHE
   # if ADAGFX_ENABLE_FRAMED_WINDOW
   win, // 30
   defwin,
@@ -1367,6 +1509,30 @@ bool AdafruitGFX_helper::processCommand(const String& string) {
                                                                     nParams[1] + nParams[3]);
   # endif // if ADAGFX_ARGUMENT_VALIDATION
 
+  # if ADAGFX_ENABLE_TEXT_CACHE
+
+  if (_textCacheEnabled) {
+    switch (subcmd) { // Any drawing, other than printing text, may overwrite retained texts
+      case adagfx_commands_e::txp:
+      case adagfx_commands_e::txz:
+      case adagfx_commands_e::txl:
+      case adagfx_commands_e::txc:
+      case adagfx_commands_e::txs:
+      case adagfx_commands_e::txtfull:
+      case adagfx_commands_e::tpm:
+      case adagfx_commands_e::font:
+      case adagfx_commands_e::tcache:
+      #  if ADAGFX_ENABLE_FRAMED_WINDOW
+      case adagfx_commands_e::win:
+      #  endif // if ADAGFX_ENABLE_FRAMED_WINDOW
+        break;
+      default:
+        invalidateTextCache();
+        break;
+    }
+  }
+  # endif // if ADAGFX_ENABLE_TEXT_CACHE
+
   switch (subcmd)
   {
     case adagfx_commands_e::invalid:
@@ -2290,6 +2456,15 @@ bool AdafruitGFX_helper::processCommand(const String& string) {
       }
       break;
     # endif // if ADAGFX_ENABLE_BUTTON_DRAW
+    # if ADAGFX_ENABLE_TEXT_CACHE
+    case adagfx_commands_e::tcache: // tcache: enable/disable the text cache
+
+      if ((argCount == 1) && (nParams[0] >= 0) && (nParams[0] <= 1)) {
+        setTextCache(nParams[0] == 1);
+        success = true;
+      }
+      break;
+    # endif // if ADAGFX_ENABLE_TEXT_CACHE
     # if ADAGFX_ENABLE_FRAMED_WINDOW
     case adagfx_commands_e::win: // win: select window by id
 
@@ -2367,6 +2542,9 @@ const char adagfx_getcommands[] PROGMEM = "win|iswin|width|height|length|texthei
                                           #  if ADAGFX_FONTS_INCLUDED
                                           "|font"
                                           #  endif // if ADAGFX_FONTS_INCLUDED
+                                          #  if ADAGFX_ENABLE_TEXT_CACHE
+                                          "|tcache"
+                                          #  endif // if ADAGFX_ENABLE_TEXT_CACHE
 ;
 enum class adagfx_getcommands_e : int8_t {
   invalid = -1,
@@ -2382,6 +2560,9 @@ enum class adagfx_getcommands_e : int8_t {
   #  if ADAGFX_FONTS_INCLUDED
   font,
   #  endif // if ADAGFX_FONTS_INCLUDED
+  #  if ADAGFX_ENABLE_TEXT_CACHE
+  tcache,
+  #  endif // if ADAGFX_ENABLE_TEXT_CACHE
 };
 
 bool AdafruitGFX_helper::pluginGetConfigValue(String& string) {
@@ -2483,6 +2664,15 @@ bool AdafruitGFX_helper::pluginGetConfigValue(String& string) {
       success = true;
       break;
     #  endif // if ADAGFX_FONTS_INCLUDED
+    #  if ADAGFX_ENABLE_TEXT_CACHE
+    case adagfx_getcommands_e::tcache:
+    { // tcache: get percentage of text pixels not updated because of the text cache
+      const uint32_t total = _textCachePixels + _textCachePixelsSkip;
+      string  = total == 0 ? 0 : static_cast<int>((static_cast<uint64_t>(_textCachePixelsSkip) * 100) / total);
+      success = true;
+      break;
+    }
+    #  endif // if ADAGFX_ENABLE_TEXT_CACHE
     case adagfx_getcommands_e::invalid:
       break;
   }
@@ -2634,6 +2824,21 @@ void AdafruitGFX_helper::printText(const char     *string,
     }
   }
 
+  # if ADAGFX_ENABLE_TEXT_CACHE
+  const int16_t  cacheX     = _x;
+  const int16_t  cacheY     = _y;
+  const uint16_t cacheColor = bkcolor;
+  String cacheString;
+
+  if (_textCacheEnabled) {
+    cacheString = newString;
+
+    if (!checkTextCache(newString, _x, _y, textSize, color, bkcolor, maxWidth)) {
+      return; // Already on display
+    }
+  }
+  # endif // if ADAGFX_ENABLE_TEXT_CACHE
+
   _display->getTextBounds(newString, _x, _y, &xText, &yText, &wText, &hText); // Calculate length
 
   if ((hText < hChar1) && _columnRowMode) {                                   // If the text-height is lower than the default height
@@ -2685,6 +2890,17 @@ void AdafruitGFX_helper::printText(const char     *string,
 
   _display->setCursor(_x + oLeft, _y); // add left offset to center, _y may be updated
   _display->print(newString);
+
+  # if ADAGFX_ENABLE_TEXT_CACHE
+
+  if (_textCacheEnabled) {
+    const uint16_t wArea = _textPrintMode == AdaGFXTextPrintMode::ClearThenTruncate ? res_x - (_x - xOffset) : max(_w, wText);
+    const uint16_t hArea = hText + oBottom - oTop;
+    _textCachePixels += wArea * hArea;
+    updateTextCache(cacheString, cacheX, cacheY, _x + oTop, yText, wArea, hArea,
+                    textSize, color, cacheColor, maxWidth);
+  }
+  # endif // if ADAGFX_ENABLE_TEXT_CACHE
 }
 
 /****************************************************************************
@@ -3246,6 +3462,10 @@ void AdafruitGFX_helper::setValidation(const bool& state) {
 void AdafruitGFX_helper::setRotation(uint8_t m) {
   const uint8_t rotation = m & 3;
 
+  # if ADAGFX_ENABLE_TEXT_CACHE
+  invalidateTextCache();
+  # endif // if ADAGFX_ENABLE_TEXT_CACHE
+
   _display->setRotation(m); // Set rotation 0/1/2/3
   _rotation = rotation;
 
@@ -111,6 +111,10 @@
 # ifndef ADAGFX_ENABLE_GET_CONFIG_VALUE
 #  define ADAGFX_ENABLE_GET_CONFIG_VALUE  1 // Enable getting values features
 # endif // ifndef ADAGFX_ENABLE_GET_CONFIG_VALUE
+# ifndef ADAGFX_ENABLE_TEXT_CACHE
+#  define ADAGFX_ENABLE_TEXT_CACHE    1     // Enable retained text, only redraw changed texts/characters
+# endif // ifndef ADAGFX_ENABLE_TEXT_CACHE
+# define ADAGFX_TEXT_CACHE_MAX_ITEMS  32    // Max. nr of texts retained
 
 # define ADAGFX_FONTS_EXTRA_5PT_INCLUDED    // 1 extra 5pt font, should only be enabled in non-LIMIT_BUILD_SIZE builds, adds ~0.3 kB
 // # define ADAGFX_FONTS_EXTRA_8PT_INCLUDED  // 8 extra 8pt fonts, should probably only be enabled in a private custom build, adds ~15.4 kB
@@ -211,6 +215,10 @@
 #   undef ADAGFX_ENABLE_BUTTON_SLIDER
 #   define ADAGFX_ENABLE_BUTTON_SLIDER  0 // Disable displaying button-shape with slider-actions
 #  endif // if ADAGFX_ENABLE_BUTTON_SLIDER
+#  if ADAGFX_ENABLE_TEXT_CACHE
+#   undef ADAGFX_ENABLE_TEXT_CACHE
+#   define ADAGFX_ENABLE_TEXT_CACHE  0
+#  endif // if ADAGFX_ENABLE_TEXT_CACHE
 # endif  // ifdef LIMIT_BUILD_SIZE
 
 # ifdef PLUGIN_SET_MAX // Include all fonts in MAX builds
@@ -391,6 +399,23 @@ struct tWindowObject {
   int8_t       rotation = 0;
 };
 # endif // if ADAGFX_ENABLE_FRAMED_WINDOW
+# if ADAGFX_ENABLE_TEXT_CACHE
+struct tTextCacheItem {
+  String   text;
+  int16_t  x        = 0; // Print position, incl. window offset
+  int16_t  y        = 0;
+  int16_t  xText    = 0; // Area covered on screen
+  int16_t  yText    = 0;
+  uint16_t wText    = 0;
+  uint16_t hText    = 0;
+  uint16_t color    = 0;
+  uint16_t bkcolor  = 0;
+  uint16_t maxWidth = 0;
+  uint8_t  textSize  = 0;
+  uint8_t  fontId    = 0;
+  uint8_t  printMode = 0;
+};
+# endif // if ADAGFX_ENABLE_TEXT_CACHE
 
 class AdafruitGFX_helper; // Forward declaration
 
@@ -579,6 +604,12 @@ public:
   void invertDisplay(bool i);
   void initialize();
 
+  # if ADAGFX_ENABLE_TEXT_CACHE
+  void setTextCache(bool state);           // When enabled, printing the same text at the same position is skipped,
+                                           // and only changed characters are redrawn for fixed-width fonts
+  void invalidateTextCache();              // Must be called when the display content is changed outside of this helper
+  # endif // if ADAGFX_ENABLE_TEXT_CACHE
+
 private:
 
   # if ADAGFX_ARGUMENT_VALIDATION
@@ -643,6 +674,31 @@ private:
   uint8_t _window      = 0; // current window
   uint8_t _windowIndex = 0; // current window Index
   # endif // if ADAGFX_ENABLE_FRAMED_WINDOW
+  # if ADAGFX_ENABLE_TEXT_CACHE
+  bool checkTextCache(String        & text,
+                      int16_t       & x,
+                      const int16_t & y,
+                      const uint8_t & textSize,
+                      const uint16_t& color,
+                      const uint16_t& bkcolor,
+                      const uint16_t& maxWidth);
+  void updateTextCache(const String  & text,
+                       const int16_t & x,
+                       const int16_t & y,
+                       const int16_t & xText,
+                       const int16_t & yText,
+                       const uint16_t& wText,
+                       const uint16_t& hText,
+                       const uint8_t & textSize,
+                       const uint16_t& color,
+                       const uint16_t& bkcolor,
+                       const uint16_t& maxWidth);
+  std::vector<tTextCacheItem>_textCache;
+  bool     _textCacheEnabled    = false;
+  bool     _textCacheSkipUpdate = false; // Set when checkTextCache already updated the cache item
+  uint32_t _textCachePixels     = 0; // Nr of pixels cleared/printed
+  uint32_t _textCachePixelsSkip = 0; // Nr of pixels not updated because of the text cache
+  # endif // if ADAGFX_ENABLE_TEXT_CACHE
 };
 #endif // ifdef PLUGIN_USES_ADAFRUITGFX
 
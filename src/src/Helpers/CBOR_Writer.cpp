@@ -0,0 +1,118 @@
+#include "../Helpers/CBOR_Writer.h"
+
+#if FEATURE_JSON_CBOR
+
+# include "../WebServer/HTML_wrappers.h"
+
+void CBOR_writeTypeAndValue(uint8_t majorType, uint64_t value)
+{
+  majorType <<= 5;
+
+  if (value < 24) {
+    addHtml(static_cast<char>(majorType | value));
+    return;
+  }
+  uint8_t additionalInfo = 27; // 8 bytes
+  uint8_t nrBytes        = 8;
+
+  if (value <= 0xFF) {
+    additionalInfo = 24;
+    nrBytes        = 1;
+  } else if (value <= 0xFFFF) {
+    additionalInfo = 25;
+    nrBytes        = 2;
+  } else if (value <= 0xFFFFFFFFull) {
+    additionalInfo = 26;
+    nrBytes        = 4;
+  }
+  addHtml(static_cast<char>(majorType | additionalInfo));
+
+  // Big endian
+  for (int8_t i = nrBytes - 1; i >= 0; --i) {
+    addHtml(static_cast<char>((value >> (8 * i)) & 0xFF));
+  }
+}
+
+void CBOR_writeUInt(uint64_t value)
+{
+  CBOR_writeTypeAndValue(CBOR_UINT, value);
+}
+
+void CBOR_writeInt(int64_t value)
+{
+  if (value < 0) {
+    // Encoded as -1 - n
+    CBOR_writeTypeAndValue(CBOR_NEGINT, static_cast<uint64_t>(-1 - value));
+  } else {
+    CBOR_writeTypeAndValue(CBOR_UINT, static_cast<uint64_t>(value));
+  }
+}
+
+void CBOR_writeFloat(float value)
+{
+  uint32_t bits{};
+
+  memcpy(&bits, &value, sizeof(bits));
+  addHtml(static_cast<char>((CBOR_SIMPLE_FLOAT << 5) | 26));
+
+  for (int8_t i = 3; i >= 0; --i) {
+    addHtml(static_cast<char>((bits >> (8 * i)) & 0xFF));
+  }
+}
+
+void CBOR_writeDouble(double value)
+{
+  uint64_t bits{};
+
+  memcpy(&bits, &value, sizeof(bits));
+  addHtml(static_cast<char>((CBOR_SIMPLE_FLOAT << 5) | 27));
+
+  for (int8_t i = 7; i >= 0; --i) {
+    addHtml(static_cast<char>((bits >> (8 * i)) & 0xFF));
+  }
+}
+
+void CBOR_writeBool(bool value)
+{
+  addHtml(static_cast<char>((CBOR_SIMPLE_FLOAT << 5) | (value ? 21 : 20)));
+}
+
+void CBOR_writeNull()
+{
+  addHtml(static_cast<char>((CBOR_SIMPLE_FLOAT << 5) | 22));
+}
+
+void CBOR_writeString(const __FlashStringHelper *str)
+{
+  CBOR_writeTypeAndValue(CBOR_TEXT_STRING, strlen_P(reinterpret_cast<PGM_P>(str)));
+  addHtml(str);
+}
+
+void CBOR_writeString(const String& str)
+{
+  CBOR_writeTypeAndValue(CBOR_TEXT_STRING, str.length());
+  addHtml(str);
+}
+
+void CBOR_beginArray(size_t nrItems)
+{
+  CBOR_writeTypeAndValue(CBOR_ARRAY, nrItems);
+}
+
+void CBOR_beginMap(size_t nrPairs)
+{
+  CBOR_writeTypeAndValue(CBOR_MAP, nrPairs);
+}
+
+void CBOR_beginArray()
+{
+  // Indefinite length
+  addHtml(static_cast<char>((CBOR_ARRAY << 5) | 31));
+}
+
+void CBOR_writeBreak()
+{
+  addHtml(static_cast<char>(0xFF));
+}
+
+#endif // if FEATURE_JSON_CBOR
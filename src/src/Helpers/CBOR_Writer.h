@@ -0,0 +1,45 @@
+#ifndef HELPERS_CBOR_WRITER_H
+#define HELPERS_CBOR_WRITER_H
+
+#include "../../ESPEasy_common.h"
+
+#if FEATURE_JSON_CBOR
+
+/********************************************************************************************\
+   Minimal CBOR (RFC 8949) encoder, writing directly to the web server TXBuffer.
+
+   Integers are always encoded in the smallest possible size.
+   Arrays and maps with a known number of items are preferred,
+   for arrays with an unknown number of items, use CBOR_beginArray() and CBOR_writeBreak().
+ \*********************************************************************************************/
+
+// Major types
+# define CBOR_UINT          0
+# define CBOR_NEGINT        1
+# define CBOR_TEXT_STRING   3
+# define CBOR_ARRAY         4
+# define CBOR_MAP           5
+# define CBOR_SIMPLE_FLOAT  7
+
+void CBOR_writeTypeAndValue(uint8_t  majorType,
+                            uint64_t value);
+
+void CBOR_writeUInt(uint64_t value);
+void CBOR_writeInt(int64_t value);
+void CBOR_writeFloat(float value);
+void CBOR_writeDouble(double value);
+void CBOR_writeBool(bool value);
+void CBOR_writeNull();
+void CBOR_writeString(const __FlashStringHelper *str);
+void CBOR_writeString(const String& str);
+
+void CBOR_beginArray(size_t nrItems);
+void CBOR_beginMap(size_t nrPairs);
+
+// Array of unknown length, must be closed with CBOR_writeBreak()
+void CBOR_beginArray();
+void CBOR_writeBreak();
+
+#endif // if FEATURE_JSON_CBOR
+
+#endif // ifndef HELPERS_CBOR_WRITER_H
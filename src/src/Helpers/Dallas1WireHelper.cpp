@@ -34,6 +34,7 @@
 # endif // ifdef ESP32
 
 
+# include <map>
 # include <vector>
 
 unsigned char ROM_NO[8]{ 0 };
@@ -45,6 +46,9 @@ int32_t usec_release{};
 int32_t presence_start{};
 int32_t presence_end{};
 
+// Bus statistics and conversion state, per RX pin
+std::map<int8_t, Dallas_BusStats> Dallas_bus_stats;
+
 
 void DALLAS_IRAM_ATTR Dallas_pinModeInput(uint32_t gpio_pin_rx, uint32_t gpio_pin_tx)
 {
@@ -1292,6 +1296,116 @@ uint16_t Dallas_crc16(const uint8_t *input, uint16_t len, uint16_t crc)
   return crc;
 }
 
+/*********************************************************************************************\
+*  Dallas bus level scheduling
+\*********************************************************************************************/
+uint32_t Dallas_BusStats::getCRCErrorRate() const
+{
+  if (scratchpad_reads == 0) { return 0; }
+  return (static_cast<uint64_t>(crc_errors) * 1000ull) / scratchpad_reads;
+}
+
+uint32_t Dallas_conversion_time(uint8_t res)
+{
+  /*********************************************************************************************\
+  *  Dallas Start Temperature Conversion, expected max duration:
+  *    9 bits resolution ->  93.75 ms
+  *   10 bits resolution -> 187.5 ms
+  *   11 bits resolution -> 375 ms
+  *   12 bits resolution -> 750 ms
+  \*********************************************************************************************/
+  if ((res < 9) || (res > 12)) { res = 12; }
+  return 800 / (1 << (12 - res));
+}
+
+bool Dallas_bus_start_conversion(int8_t gpio_pin_rx, int8_t gpio_pin_tx, uint8_t res, unsigned long& ready_time)
+{
+  Dallas_BusStats& stats = Dallas_bus_stats[gpio_pin_rx];
+
+  if (stats.conversionValid &&
+      (timePassedSince(stats.last_conversion_start) < DALLAS_BUS_SHARE_CONVERSION_WINDOW)) {
+    // Another task on this bus recently started a conversion, use its result.
+    ++stats.conversions_shared;
+    ready_time = stats.last_conversion_start + Dallas_conversion_time(res);
+    return true;
+  }
+
+  const uint64_t start_usec = getMicros64();
+
+  stats.conversionValid = false;
+
+  if (!Dallas_reset(gpio_pin_rx, gpio_pin_tx)) {
+    stats.bus_time_usec += usecPassedSince(start_usec);
+    return false;
+  }
+  Dallas_write(0xCC, gpio_pin_rx, gpio_pin_tx); // Skip ROM, address all devices
+  Dallas_write(0x44, gpio_pin_rx, gpio_pin_tx); // Take temperature measurement
+
+  stats.last_conversion_start = millis();
+  stats.conversionValid       = true;
+  ++stats.conversions_started;
+  stats.bus_time_usec += usecPassedSince(start_usec);
+
+  ready_time = stats.last_conversion_start + Dallas_conversion_time(res);
+  return true;
+}
+
+void Dallas_bus_invalidate_conversion(int8_t gpio_pin_rx)
+{
+  auto it = Dallas_bus_stats.find(gpio_pin_rx);
+
+  if (it != Dallas_bus_stats.end()) {
+    it->second.conversionValid = false;
+  }
+}
+
+void Dallas_bus_add_scratchpad_read(int8_t gpio_pin_rx, bool crc_error, uint32_t duration_usec)
+{
+  Dallas_BusStats& stats = Dallas_bus_stats[gpio_pin_rx];
+
+  ++stats.scratchpad_reads;
+
+  if (crc_error) {
+    ++stats.crc_errors;
+  }
+  stats.bus_time_usec += duration_usec;
+}
+
+const Dallas_BusStats* Dallas_get_bus_stats(int8_t gpio_pin_rx)
+{
+  auto it = Dallas_bus_stats.find(gpio_pin_rx);
+
+  if (it == Dallas_bus_stats.end()) {
+    return nullptr;
+  }
+  return &(it->second);
+}
+
+# ifndef LIMIT_BUILD_SIZE
+void Dallas_show_bus_stats_webform_load(int8_t gpio_pin_rx)
+{
+  const Dallas_BusStats *stats = Dallas_get_bus_stats(gpio_pin_rx);
+
+  if (stats == nullptr) {
+    return;
+  }
+  addRowLabel(F("Bus Conversions"));
+  addHtmlInt(stats->conversions_started);
+
+  addRowLabel(F("Bus Shared Conversions"));
+  addHtmlInt(stats->conversions_shared);
+
+  addRowLabel(F("Bus Time"));
+  addHtmlInt(static_cast<uint32_t>(stats->bus_time_usec / 1000ull));
+  addUnit(F("msec"));
+
+  addRowLabel(F("Bus CRC Error Rate"));
+  addHtmlFloat(stats->getCRCErrorRate() / 10.0f, 1);
+  addUnit('%');
+}
+
+# endif // ifndef LIMIT_BUILD_SIZE
+
 void Dallas_SensorData::clear() {
   addr                  = 0u;
   value                 = 0.0f;
@@ -1321,11 +1435,8 @@ void Dallas_SensorData::set_measurement_inactive() {
   valueRead         = false;
 }
 
-bool Dallas_SensorData::initiate_read(int8_t gpio_rx, int8_t gpio_tx, int8_t res) {
+bool Dallas_SensorData::prepare_read(int8_t gpio_rx, int8_t gpio_tx, int8_t res) {
   if (addr == 0) { return false; }
-  uint8_t tmpaddr[8];
-
-  Dallas_uint64_to_addr(addr, tmpaddr);
 
   if (lastReadError) {
     if (!check_sensor(gpio_rx, gpio_tx, res)) {
@@ -1333,6 +1444,16 @@ bool Dallas_SensorData::initiate_read(int8_t gpio_rx, int8_t gpio_tx, int8_t res
     }
     lastReadError = false;
   }
+  return true;
+}
+
+bool Dallas_SensorData::initiate_read(int8_t gpio_rx, int8_t gpio_tx, int8_t res) {
+  if (!prepare_read(gpio_rx, gpio_tx, res)) {
+    return false;
+  }
+  uint8_t tmpaddr[8];
+
+  Dallas_uint64_to_addr(addr, tmpaddr);
 
   if (!Dallas_address_ROM(tmpaddr, gpio_rx, gpio_tx)) {
     ++start_read_retry;
@@ -1362,7 +1483,9 @@ bool Dallas_SensorData::collect_value(int8_t gpio_rx, int8_t gpio_tx) {
 
     while (nrRetries) {
       --nrRetries;
+      const uint32_t start   = micros();
       Dallas_read_result res = Dallas_readTemp(tmpaddr, &value, gpio_rx, gpio_tx);
+      Dallas_bus_add_scratchpad_read(gpio_rx, res == Dallas_read_result::CRCerr, usecPassedSince_fast(start));
 
       switch (res) {
         case Dallas_read_result::OK:
@@ -25,6 +25,12 @@ struct Dallas_SensorData {
 
   void set_measurement_inactive();
 
+  // Check whether the sensor can take part in a measurement.
+  // Will re-check the sensor when the last read failed.
+  bool prepare_read(int8_t gpio_rx,
+                    int8_t gpio_tx,
+                    int8_t res);
+
   bool initiate_read(int8_t gpio_rx,
                      int8_t gpio_tx,
                      int8_t res);
@@ -56,6 +62,59 @@ struct Dallas_SensorData {
 };
 
 
+/*********************************************************************************************\
+   Bus level scheduling of conversions
+   All temperature sensors on a single GPIO pin can be started with a single
+   'Skip ROM' + 'Convert T' command.
+   Tasks using the same pin may join a conversion which was started recently,
+   so the bus is not occupied with separate conversions for each task.
+\*********************************************************************************************/
+
+// Max. age of a conversion (in msec) for another task to still use its result
+# ifndef DALLAS_BUS_SHARE_CONVERSION_WINDOW
+#  define DALLAS_BUS_SHARE_CONVERSION_WINDOW  1000
+# endif // ifndef DALLAS_BUS_SHARE_CONVERSION_WINDOW
+
+struct Dallas_BusStats {
+  // CRC errors per 1000 scratchpad reads
+  uint32_t getCRCErrorRate() const;
+
+  uint64_t      bus_time_usec{};
+  uint32_t      conversions_started{};
+  uint32_t      conversions_shared{};
+  uint32_t      scratchpad_reads{};
+  uint32_t      crc_errors{};
+  unsigned long last_conversion_start{};
+  bool          conversionValid{};
+};
+
+// Start a conversion on all sensors connected to this bus, or join a conversion started recently.
+// @param res         Resolution used to compute the conversion time
+// @param ready_time  Timestamp (millis) when the conversion is complete
+// @retval true when a conversion is active on the bus.
+bool                   Dallas_bus_start_conversion(int8_t         gpio_pin_rx,
+                                                   int8_t         gpio_pin_tx,
+                                                   uint8_t        res,
+                                                   unsigned long& ready_time);
+
+// Prevent other tasks from sharing the last conversion, e.g. when a sensor was found in an unknown state.
+void                   Dallas_bus_invalidate_conversion(int8_t gpio_pin_rx);
+
+void                   Dallas_bus_add_scratchpad_read(int8_t   gpio_pin_rx,
+                                                      bool     crc_error,
+                                                      uint32_t duration_usec);
+
+// @retval nullptr when no statistics are kept for this pin
+const Dallas_BusStats* Dallas_get_bus_stats(int8_t gpio_pin_rx);
+
+# ifndef LIMIT_BUILD_SIZE
+void                   Dallas_show_bus_stats_webform_load(int8_t gpio_pin_rx);
+# endif // ifndef LIMIT_BUILD_SIZE
+
+// Max. conversion time in msec for given resolution.
+uint32_t               Dallas_conversion_time(uint8_t res);
+
+
 /*********************************************************************************************\
    Variables used to keep track of scanning the bus
    N.B. these should not be shared for simultaneous scans on different pins
@@ -6,6 +6,7 @@
 #include "../DataStructs/TimingStats.h"
 #include "../WebServer/ESPEasy_WebServer.h"
 #include "../Helpers/Convert.h"
+#include "../Helpers/Misc.h"
 #include "../Helpers/_Plugin_init.h"
 
 
@@ -19,6 +20,11 @@ void stream_json_timing_stats(const TimingStats& stats, long timeSinceLastReset)
   json_number(F("min"),   ull2String(minVal));
   json_number(F("max"),   ull2String(maxVal));
   json_number(F("avg"),   toString(stats.getAvg(), 2));
+#if FEATURE_TIMING_STATS_HISTOGRAM
+  json_number(F("p50"),   ull2String(stats.getPercentile(50)));
+  json_number(F("p95"),   ull2String(stats.getPercentile(95)));
+  json_number(F("p99"),   ull2String(stats.getPercentile(99)));
+#endif // if FEATURE_TIMING_STATS_HISTOGRAM
   json_prop(F("unit"), F("usec"));
 }
 
@@ -131,11 +137,22 @@ void jsonStatistics(bool clearStats) {
 
   json_close(true);   // Close misc list
 
+
+  json_open(true, F("task"));
+  for (taskIndex_t x = 0; x < TASKS_MAX; ++x) {
+    if (!taskStats[x].isEmpty()) {
+      json_open(); // open new task item
+      json_prop(F("name"), getTaskDeviceName(x));
+      json_prop(F("id"),   String(x + 1));
+      stream_json_timing_stats(taskStats[x], timeSinceLastReset);
+      json_close(); // close task item
+    }
+  }
+
+  json_close(true);   // Close task list
+
   if (clearStats) {
-    pluginStats.clear();
-    controllerStats.clear();
-    miscStats.clear();
-    timingstats_last_reset = millis();
+    resetTimingStats();
   }
 }
 
@@ -162,6 +162,11 @@ void ResetFactory(bool formatFS)
 
   if (formatFS) {
     // always format on factory reset, in case of corrupt FS
+    #if FEATURE_SETTINGS_READ_BATCH
+
+    // Settings file may still be open when called from LoadSettings() at boot
+    closeSettingsReadBatchFile();
+    #endif // if FEATURE_SETTINGS_READ_BATCH
     ESPEASY_FS.end();
     serialPrintln(F("RESET: formatting..."));
     FS_format();
@@ -208,6 +208,13 @@ fs::File tryOpenFile(const String& fname, const String& mode, FileDestination_e
   if (fname.isEmpty() || equals(fname, '/')) {
     return f;
   }
+  #if FEATURE_SETTINGS_READ_BATCH
+
+  if (!equals(mode, 'r')) {
+    // Don't keep a read handle open while the file may be changed
+    closeSettingsReadBatchFile();
+  }
+  #endif // if FEATURE_SETTINGS_READ_BATCH
 
   FileDestination_e where = FileDestination_e::ANY;
   const bool exists = fileExists(fname, where);
@@ -242,6 +249,9 @@ bool fileMatchesTaskSettingsType(const String& fname) {
 
 bool tryRenameFile(const String& fname_old, const String& fname_new, FileDestination_e destination) {
   clearFileCaches();
+  #if FEATURE_SETTINGS_READ_BATCH
+  closeSettingsReadBatchFile();
+  #endif // if FEATURE_SETTINGS_READ_BATCH
 
   if (fileExists(fname_old) && !fileExists(fname_new)) {
     if (fileMatchesTaskSettingsType(fname_old)) {
@@ -275,6 +285,9 @@ bool tryDeleteFile(const String& fname, FileDestination_e destination) {
       ControllerCache.closeOpenFiles();
     }
     #endif // if FEATURE_RTC_CACHE_STORAGE
+    #if FEATURE_SETTINGS_READ_BATCH
+    closeSettingsReadBatchFile();
+    #endif // if FEATURE_SETTINGS_READ_BATCH
 
     if (fileMatchesTaskSettingsType(fname)) {
       clearAllCaches();
@@ -631,6 +644,9 @@ void fileSystemCheck()
 }
 
 bool FS_format() {
+#if FEATURE_SETTINGS_READ_BATCH
+  closeSettingsReadBatchFile();
+#endif // if FEATURE_SETTINGS_READ_BATCH
 #ifdef USE_LITTLEFS
 # ifdef ESP32
   const bool res = ESPEASY_FS.begin(true);
@@ -1966,6 +1982,48 @@ String SaveToFile_trunc(const char *fname, int index, const uint8_t *memAddress,
   return doSaveToFile(fname, index, memAddress, datasize, "w+");
 }
 
+#if FEATURE_SETTINGS_DELTA_SAVE
+SettingsSaveStats settingsSaveStats;
+
+const SettingsSaveStats& getSettingsSaveStats()
+{
+  return settingsSaveStats;
+}
+
+// Compare data with the current file content, per chunk.
+// @param firstDiff  Set to the start of the first changed chunk
+// @param lastDiff   Set to the end of the last changed chunk
+// @retval false when the file content is equal to the data.
+bool getChangedRangeInFile(const char *fname, int index, const uint8_t *memAddress, int datasize, int& firstDiff, int& lastDiff)
+{
+  firstDiff = -1;
+  lastDiff  = -1;
+  fs::File f = tryOpenFile(fname, "r");
+
+  if (!f || (static_cast<int>(f.size()) < (index + datasize)) || !f.seek(index, fs::SeekSet)) {
+    firstDiff = 0;
+    lastDiff  = datasize;
+    return true;
+  }
+  uint8_t buffer[SETTINGS_SAVE_CHUNK_SIZE];
+
+  for (int pos = 0; pos < datasize; pos += SETTINGS_SAVE_CHUNK_SIZE) {
+    const int length = std::min(SETTINGS_SAVE_CHUNK_SIZE, datasize - pos);
+
+    if ((static_cast<int>(f.read(buffer, length)) != length) ||
+        (memcmp_P(buffer, memAddress + pos, length) != 0)) {
+      if (firstDiff < 0) {
+        firstDiff = pos;
+      }
+      lastDiff = pos + length;
+    }
+  }
+  f.close();
+  return firstDiff >= 0;
+}
+
+#endif // if FEATURE_SETTINGS_DELTA_SAVE
+
 // See for mode description: https://github.com/esp8266/Arduino/blob/master/doc/filesystem.rst
 String doSaveToFile(const char *fname, int index, const uint8_t *memAddress, int datasize, const char *mode)
 {
@@ -1993,6 +2051,27 @@ String doSaveToFile(const char *fname, int index, const uint8_t *memAddress, int
   #ifndef BUILD_NO_RAM_TRACKER
   checkRAM(F("SaveToFile"));
   #endif // ifndef BUILD_NO_RAM_TRACKER
+  #if FEATURE_SETTINGS_DELTA_SAVE
+  const uint64_t saveStart = getMicros64();
+  int firstDiff            = 0;
+  int lastDiff             = datasize;
+
+  settingsSaveStats.bytesRequested += datasize;
+
+  if ((strcmp(mode, "r+") == 0) &&
+      !getChangedRangeInFile(fname, index, memAddress, datasize, firstDiff, lastDiff)) {
+    // Nothing changed, so no need to write to flash.
+    ++settingsSaveStats.savesSkipped;
+    #ifndef BUILD_NO_DEBUG
+
+    if (loglevelActiveFor(LOG_LEVEL_INFO)) {
+      addLogMove(LOG_LEVEL_INFO, strformat(F("FILE : Skip save %s offset: %d size: %d, not changed"), fname, index, datasize));
+    }
+    #endif // ifndef BUILD_NO_DEBUG
+    STOP_TIMER(SAVEFILE_STATS);
+    return EMPTY_STRING;
+  }
+  #endif // if FEATURE_SETTINGS_DELTA_SAVE
   FLASH_GUARD();
 
   #ifndef BUILD_NO_DEBUG
@@ -2002,16 +2081,50 @@ String doSaveToFile(const char *fname, int index, const uint8_t *memAddress, int
   }
   #endif // ifndef BUILD_NO_DEBUG
   delay(1);
-  unsigned long timer = millis() + 50;
-  fs::File f          = tryOpenFile(fname, mode);
+  fs::File f = tryOpenFile(fname, mode);
 
   if (f) {
     clearAllButTaskCaches();
     SPIFFS_CHECK(f,                          fname);
+    #if FEATURE_SETTINGS_DELTA_SAVE
+
+    if ((index + firstDiff) > 0) {
+      SPIFFS_CHECK(f.seek(index + firstDiff, fs::SeekSet), fname);
+    }
+
+    for (int x = firstDiff; x < lastDiff; x += SETTINGS_SAVE_CHUNK_SIZE) {
+      // Copy to RAM first, memAddress may point to flash.
+      // See https://github.com/esp8266/Arduino/commit/b1da9eda467cc935307d553692fdde2e670db258#r32622483
+      uint8_t buffer[SETTINGS_SAVE_CHUNK_SIZE];
+      const int length = std::min(SETTINGS_SAVE_CHUNK_SIZE, lastDiff - x);
+      memcpy_P(buffer, memAddress + x, length);
+      SPIFFS_CHECK(f.write(buffer, length) == static_cast<size_t>(length), fname);
+      delay(0);
+    }
+    f.close();
+
+    const uint32_t duration = usecPassedSince(saveStart);
+    ++settingsSaveStats.saves;
+    settingsSaveStats.bytesWritten  += lastDiff - firstDiff;
+    settingsSaveStats.duration_usec += duration;
+
+    if (duration > settingsSaveStats.maxDuration_usec) {
+      settingsSaveStats.maxDuration_usec = duration;
+    }
+    #ifndef BUILD_NO_DEBUG
+
+    if (loglevelActiveFor(LOG_LEVEL_INFO)) {
+      addLogMove(LOG_LEVEL_INFO, strformat(F("FILE : Saved %s offset: %d size: %d (changed: %d)"),
+                                           fname, index, datasize, lastDiff - firstDiff));
+    }
+    #endif // ifndef BUILD_NO_DEBUG
+    #else // if FEATURE_SETTINGS_DELTA_SAVE
+
     if (index > 0) {
       SPIFFS_CHECK(f.seek(index, fs::SeekSet), fname);
     }
     const uint8_t *pointerToByteToSave = memAddress;
+    unsigned long  timer               = millis() + 50;
 
     for (int x = 0; x < datasize; x++)
     {
@@ -2038,6 +2151,7 @@ String doSaveToFile(const char *fname, int index, const uint8_t *memAddress, int
       addLogMove(LOG_LEVEL_INFO, strformat(F("FILE : Saved %s offset: %d size: %d"), fname, index, datasize));
     }
     #endif // ifndef BUILD_NO_DEBUG
+    #endif // if FEATURE_SETTINGS_DELTA_SAVE
   } else {
     #ifndef BUILD_NO_DEBUG
     const String log = strformat(F("SaveToFile: %s ERROR, Cannot save to file"), fname);
@@ -2107,6 +2221,83 @@ String ClearInFile(const char *fname, int index, int datasize)
   return EMPTY_STRING;
 }
 
+#if FEATURE_SETTINGS_READ_BATCH
+uint8_t  settingsReadBatchLevel = 0;
+uint32_t settingsReadBatchStart = 0;
+String   settingsReadBatchFileName;
+fs::File settingsReadBatchFile;
+SettingsReadBatchStats settingsReadBatchStats;
+SettingsReadBatchStats settingsReadBatchBootStats;
+
+void beginSettingsReadBatch()
+{
+  if (settingsReadBatchLevel == 0) {
+    settingsReadBatchStats = SettingsReadBatchStats();
+    settingsReadBatchStart = millis();
+  }
+  ++settingsReadBatchLevel;
+}
+
+void endSettingsReadBatch()
+{
+  if (settingsReadBatchLevel == 0) { return; }
+  --settingsReadBatchLevel;
+
+  if (settingsReadBatchLevel == 0) {
+    closeSettingsReadBatchFile();
+    settingsReadBatchStats.duration_msec = timePassedSince(settingsReadBatchStart);
+
+    if (settingsReadBatchBootStats.duration_msec == 0) {
+      settingsReadBatchBootStats = settingsReadBatchStats;
+    }
+    # ifndef BUILD_NO_DEBUG
+
+    if (loglevelActiveFor(LOG_LEVEL_INFO)) {
+      addLogMove(LOG_LEVEL_INFO, strformat(
+                   F("Settings: Loaded %u blocks, %u file opens in %u ms"),
+                   settingsReadBatchStats.reads,
+                   settingsReadBatchStats.fileOpens,
+                   settingsReadBatchStats.duration_msec));
+    }
+    # endif // ifndef BUILD_NO_DEBUG
+  }
+}
+
+void closeSettingsReadBatchFile()
+{
+  if (settingsReadBatchFile) {
+    settingsReadBatchFile.close();
+  }
+  settingsReadBatchFile = fs::File();
+  settingsReadBatchFileName.clear();
+}
+
+const SettingsReadBatchStats& getBootSettingsReadBatchStats()
+{
+  return settingsReadBatchBootStats;
+}
+
+fs::File openSettingsFileForRead(const char *fname)
+{
+  if (settingsReadBatchLevel == 0) {
+    return tryOpenFile(fname, "r");
+  }
+  ++settingsReadBatchStats.reads;
+
+  if (!settingsReadBatchFile || !settingsReadBatchFileName.equals(fname)) {
+    closeSettingsReadBatchFile();
+    settingsReadBatchFile = tryOpenFile(fname, "r");
+
+    if (settingsReadBatchFile) {
+      settingsReadBatchFileName = fname;
+      ++settingsReadBatchStats.fileOpens;
+    }
+  }
+  return settingsReadBatchFile;
+}
+
+#endif // if FEATURE_SETTINGS_READ_BATCH
+
 /********************************************************************************************\
    Load data from config file on file system
  \*********************************************************************************************/
@@ -2127,12 +2318,23 @@ String LoadFromFile(const char *fname, int offset, uint8_t *memAddress, int data
   checkRAM(F("LoadFromFile"));
   #endif // ifndef BUILD_NO_RAM_TRACKER
 
+  #if FEATURE_SETTINGS_READ_BATCH
+  fs::File f = openSettingsFileForRead(fname);
+  #else // if FEATURE_SETTINGS_READ_BATCH
   fs::File f = tryOpenFile(fname, "r");
+  #endif // if FEATURE_SETTINGS_READ_BATCH
   SPIFFS_CHECK(f, fname);
   const int fileSize = f.size();
 
   if (fileSize > offset) {
-    SPIFFS_CHECK(f.seek(offset, fs::SeekSet), fname);
+    #if FEATURE_SETTINGS_READ_BATCH
+
+    // Sequential reads of the same file don't need a seek
+    if (static_cast<int>(f.position()) != offset)
+    #endif // if FEATURE_SETTINGS_READ_BATCH
+    {
+      SPIFFS_CHECK(f.seek(offset, fs::SeekSet), fname);
+    }
 
     if (fileSize < (offset + datasize)) {
       const int newdatasize = datasize + offset - fileSize;
@@ -2144,7 +2346,13 @@ String LoadFromFile(const char *fname, int offset, uint8_t *memAddress, int data
     }
     SPIFFS_CHECK(f.read(memAddress, datasize), fname);
   }
-  f.close();
+  #if FEATURE_SETTINGS_READ_BATCH
+
+  if (settingsReadBatchLevel == 0)
+  #endif // if FEATURE_SETTINGS_READ_BATCH
+  {
+    f.close();
+  }
 
   STOP_TIMER(LOADFILE_STATS);
   delay(0);
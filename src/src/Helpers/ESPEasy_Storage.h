@@ -319,6 +319,25 @@ String SaveToFile_trunc(const char *fname, int index, const uint8_t *memAddress,
 // See for mode description: https://github.com/esp8266/Arduino/blob/master/doc/filesystem.rst
 String doSaveToFile(const char *fname, int index, const uint8_t *memAddress, int datasize, const char *mode);
 
+#if FEATURE_SETTINGS_DELTA_SAVE
+/********************************************************************************************\
+   When saving to an existing file, the data is first compared with the file content.
+   Only the changed chunks are written and nothing is written when the data is unchanged.
+ \*********************************************************************************************/
+# define SETTINGS_SAVE_CHUNK_SIZE  64
+
+struct SettingsSaveStats {
+  uint32_t saves{};
+  uint32_t savesSkipped{};
+  uint32_t bytesRequested{};
+  uint32_t bytesWritten{};
+  uint32_t maxDuration_usec{};
+  uint64_t duration_usec{};
+};
+
+const SettingsSaveStats& getSettingsSaveStats();
+#endif // if FEATURE_SETTINGS_DELTA_SAVE
+
 
 /********************************************************************************************\
    Clear a certain area in a file (set to 0)
@@ -332,6 +351,27 @@ String LoadFromFile(const char *fname, int offset, uint8_t *memAddress, int data
 
 String LoadFromFile(const char *fname, String& data, int offset = 0);
 
+#if FEATURE_SETTINGS_READ_BATCH
+/********************************************************************************************\
+   Batch of settings reads, e.g. during boot.
+   The last used settings file is kept open, so consecutive loads from the same file
+   don't need to open the file and seek again.
+   The file is closed when the batch ends or when any file is opened for writing.
+ \*********************************************************************************************/
+struct SettingsReadBatchStats {
+  uint32_t reads{};
+  uint32_t fileOpens{};
+  uint32_t duration_msec{};
+};
+
+void beginSettingsReadBatch();
+void endSettingsReadBatch();
+void closeSettingsReadBatchFile();
+
+// Stats of the first batch after boot
+const SettingsReadBatchStats& getBootSettingsReadBatchStats();
+#endif // if FEATURE_SETTINGS_READ_BATCH
+
 /********************************************************************************************\
    Wrapper functions to handle errors in accessing settings
  \*********************************************************************************************/
@@ -4,6 +4,8 @@
 
 # include "../Commands/ExecuteCommand.h"
 
+# include <algorithm>
+
 tTouchObjects::tTouchObjects() :
   flags(0u),
   SurfaceAreas(0u),
@@ -172,6 +174,7 @@ void ESPEasy_TouchHandler::loadTouchObjects(struct EventStruct *event) {
   _deduplicate = bitRead(Touch_Settings.flags, TOUCH_FLAGS_DEDUPLICATE);
 
   TouchObjects.clear();
+  invalidateTouchIndex();
 
   if (objectCount > 0) {
     TouchObjects.reserve(objectCount);
@@ -266,6 +269,7 @@ void ESPEasy_TouchHandler::init(struct EventStruct *event) {
       displayButtonGroup(event, _buttonGroup, -3); // Clear all displayed groups
     }
     _buttonGroup = get8BitFromUL(Touch_Settings.flags, TOUCH_FLAGS_INITIAL_GROUP);
+    invalidateTouchIndex();
     #  ifdef TOUCH_DEBUG
 
     if (loglevelActiveFor(LOG_LEVEL_INFO)) {
@@ -309,20 +313,11 @@ bool ESPEasy_TouchHandler::isCalibrationActive() {
 }
 
 /**
- * Check within the list of defined objects if we touched one of them.
- * Must be in the current button group or in button group 0.
- * The smallest matching surface is selected if multiple objects overlap.
- * Returns state, sets selectedObjectName to the best matching object name
- * and selectedObjectIndex to the index into the TouchObjects vector.
+ * Build the list of objects that can be touched, must be in the current button group or in button group 0.
+ * The list is sorted by surface area, so the first object that fits the coordinates is the smallest matching surface.
  */
-bool ESPEasy_TouchHandler::isValidAndTouchedTouchObject(const int16_t& x,
-                                                        const int16_t& y,
-                                                        String       & selectedObjectName,
-                                                        int8_t       & selectedObjectIndex) {
-  uint32_t lastObjectArea = 0u;
-  bool     selected       = false;
-  const uint16_t _x       = static_cast<uint16_t>(x);
-  const uint16_t _y       = static_cast<uint16_t>(y);
+void ESPEasy_TouchHandler::updateTouchIndex() {
+  _touchIndex.clear();
 
   for (size_t objectNr = 0; objectNr < TouchObjects.size(); ++objectNr) {
     const uint8_t group = get8BitFromUL(TouchObjects[objectNr].flags, TOUCH_OBJECT_FLAG_GROUP);
@@ -335,39 +330,67 @@ bool ESPEasy_TouchHandler::isValidAndTouchedTouchObject(const int16_t& x,
       if (TouchObjects[objectNr].SurfaceAreas == 0) {   // Need to calculate the surface area
         TouchObjects[objectNr].SurfaceAreas = TouchObjects[objectNr].width_height.x * TouchObjects[objectNr].width_height.y;
       }
+      _touchIndex.push_back(objectNr);
+    }
+  }
 
-      if ((TouchObjects[objectNr].top_left.x <= _x)
-          && (TouchObjects[objectNr].top_left.y <= _y)
-          && ((TouchObjects[objectNr].width_height.x + TouchObjects[objectNr].top_left.x) >= _x)
-          && ((TouchObjects[objectNr].width_height.y + TouchObjects[objectNr].top_left.y) >= _y)
-          && ((lastObjectArea == 0) ||
-              (TouchObjects[objectNr].SurfaceAreas < lastObjectArea))) { // Select smallest area that fits the coordinates
-        selectedObjectName  = TouchObjects[objectNr].objectName;
-        selectedObjectIndex = objectNr;
-        lastObjectArea      = TouchObjects[objectNr].SurfaceAreas;
-        selected            = true;
-      }
-      # ifdef TOUCH_DEBUG
-
-      if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
-        addLog(LOG_LEVEL_DEBUG,
-               strformat(F("TOUCH DEBUG Touched: obj: %s,%d,%d,%d,%d surface:%d x,y:%d,%d sel:%s/%d/%c"),
-                         TouchObjects[objectNr].objectName.c_str(),
-                         TouchObjects[objectNr].top_left.x,
-                         TouchObjects[objectNr].top_left.y,
-                         TouchObjects[objectNr].width_height.x,
-                         TouchObjects[objectNr].width_height.y,
-                         TouchObjects[objectNr].SurfaceAreas,
-                         x,
-                         y,
-                         selectedObjectName.c_str(),
-                         selectedObjectIndex,
-                         selected ? 'T' : 'f'));
-      }
-      # endif // ifdef TOUCH_DEBUG
+  // Keep the object order for equal surface areas, the first defined object is selected
+  std::stable_sort(_touchIndex.begin(), _touchIndex.end(),
+                   [this](const uint8_t& a, const uint8_t& b) {
+    return TouchObjects[a].SurfaceAreas < TouchObjects[b].SurfaceAreas;
+  });
+  _touchIndexValid = true;
+}
+
+/**
+ * Check within the list of defined objects if we touched one of them.
+ * Must be in the current button group or in button group 0.
+ * The smallest matching surface is selected if multiple objects overlap.
+ * Returns state, sets selectedObjectName to the best matching object name
+ * and selectedObjectIndex to the index into the TouchObjects vector.
+ */
+bool ESPEasy_TouchHandler::isValidAndTouchedTouchObject(const int16_t& x,
+                                                        const int16_t& y,
+                                                        String       & selectedObjectName,
+                                                        int8_t       & selectedObjectIndex) {
+  const uint16_t _x = static_cast<uint16_t>(x);
+  const uint16_t _y = static_cast<uint16_t>(y);
+
+  if (!_touchIndexValid) {
+    updateTouchIndex();
+  }
+
+  for (const uint8_t objectNr : _touchIndex) {
+    const tTouchObjects& touchObject = TouchObjects[objectNr];
+    const bool selected              = (touchObject.top_left.x <= _x)
+                                       && (touchObject.top_left.y <= _y)
+                                       && ((touchObject.width_height.x + touchObject.top_left.x) >= _x)
+                                       && ((touchObject.width_height.y + touchObject.top_left.y) >= _y);
+    # ifdef TOUCH_DEBUG
+
+    if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
+      addLog(LOG_LEVEL_DEBUG,
+             strformat(F("TOUCH DEBUG Touched: obj: %s,%d,%d,%d,%d surface:%d x,y:%d,%d sel:%d/%c"),
+                       touchObject.objectName.c_str(),
+                       touchObject.top_left.x,
+                       touchObject.top_left.y,
+                       touchObject.width_height.x,
+                       touchObject.width_height.y,
+                       touchObject.SurfaceAreas,
+                       x,
+                       y,
+                       objectNr,
+                       selected ? 'T' : 'f'));
+    }
+    # endif // ifdef TOUCH_DEBUG
+
+    if (selected) { // First match is the smallest area that fits the coordinates
+      selectedObjectName  = touchObject.objectName;
+      selectedObjectIndex = objectNr;
+      return true;
     }
   }
-  return selected;
+  return false;
 }
 
 /**
@@ -448,6 +471,7 @@ bool ESPEasy_TouchHandler::setTouchObjectState(struct EventStruct *event,
 
     if (state != bitRead(TouchObjects[objectNr].flags, TOUCH_OBJECT_FLAG_ENABLED)) {
       bitWrite(TouchObjects[objectNr].flags, TOUCH_OBJECT_FLAG_ENABLED, state); // Store in settings, no save
+      invalidateTouchIndex();
 
       // Event when enabling/disabling
       if (bitRead(Touch_Settings.flags, TOUCH_FLAGS_SEND_OBJECTNAME) &&
@@ -717,6 +741,7 @@ bool ESPEasy_TouchHandler::displayButton(struct EventStruct *event,
       if (action == Touch_action_e::IncrementPage) {  // Up arrow or Down arrow
         bitWrite(TouchObjects[buttonNr].flags, TOUCH_OBJECT_FLAG_ENABLED, validButtonGroup(buttonGroup + (pgupInvert ? -10 : 10), true));
       }
+      invalidateTouchIndex();
     }
     #  endif // if TOUCH_FEATURE_EXTENDED_TOUCH
 
@@ -811,6 +836,7 @@ bool ESPEasy_TouchHandler::setButtonGroup(struct EventStruct *event,
     if (buttonGroup != _buttonGroup) {
       displayButtonGroup(event, _buttonGroup, -2);
       _buttonGroup = buttonGroup;
+      invalidateTouchIndex();
       displayButtonGroup(event, _buttonGroup, -1);
     }
     return true;
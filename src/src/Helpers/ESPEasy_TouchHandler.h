@@ -378,6 +378,11 @@ private:
   bool parseRangeToInt16(const String& range,
                          int16_t     & lowRange,
                          int16_t     & highRange);
+  void updateTouchIndex();
+
+  void invalidateTouchIndex() {
+    _touchIndexValid = false;
+  }
 
   bool _deduplicate            = false;
   taskIndex_t _displayTask     = INVALID_TASK_INDEX;
@@ -386,6 +391,11 @@ private:
 
   std::set<int16_t>_buttonGroups{};
 
+  // Indices into TouchObjects of the objects that can be touched in the current button group,
+  // ordered by surface area, smallest first
+  std::vector<uint8_t>_touchIndex{};
+  bool _touchIndexValid = false;
+
   bool _settingsLoaded = false;
   bool _stillTouching  = false;
   bool _touchIgnored   = false;
@@ -76,6 +76,11 @@ void ESPEasy_time::restoreFromRTC()
 {
   static bool firstCall = true;
 
+  if (firstCall) {
+    // Clock drift estimate is kept in RTC memory, also during deep sleep
+    clockDiscipline.setDrift_ppm(RTC.clockDrift / 100.0f);
+  }
+
 #if FEATURE_EXT_RTC
   uint32_t unixtime = 0;
 
@@ -240,6 +245,11 @@ unsigned long ESPEasy_time::getLocalUnixTime(uint32_t& unix_time_frac) const
 unsigned long ESPEasy_time::now_() {
   bool timeSynced = false;
 
+  if (statusNTPInitialized) {
+    // Compensate for the estimated clock drift and slew in pending time corrections
+    unixTime_usec_uptime_offset += clockDiscipline.getCorrection(getMicros64());
+  }
+
   if (nextSyncTime <= getUptime_in_sec()) {
     // nextSyncTime is in seconds
     double unixTime_d = -1.0;
@@ -322,7 +332,27 @@ unsigned long ESPEasy_time::now_() {
 
     if (updatedTime) {
       START_TIMER;
-      unixTime_usec_uptime_offset += externalUnixTime_offset_usec;
+
+      // Only GPS and NTP are accurate enough to estimate the clock drift
+      const bool driftReference = (_timeSource < timeSource_t::Manual_set);
+      const uint64_t sysMicros  = getMicros64();
+
+      // Small corrections from a time source which is regularly synced are slewed in,
+      // so the time does not jump. e.g. to not disturb per second computations.
+      const bool slewed =
+        statusNTPInitialized &&
+        (_timeSource != timeSource_t::Manual_set) &&
+        (_timeSource < timeSource_t::External_RTC_time_source) &&
+        !clockDiscipline.processOffset(externalUnixTime_offset_usec, sysMicros, driftReference);
+
+      if (!slewed) {
+        unixTime_usec_uptime_offset += externalUnixTime_offset_usec;
+        clockDiscipline.timeStepped(sysMicros, driftReference);
+      }
+
+      if (driftReference) {
+        RTC.clockDrift = static_cast<int16_t>(clockDiscipline.getDrift_ppm() * 100.0f);
+      }
 
       constexpr int64_t ten_sec_in_usec = 10 * 1000000ll;
 
@@ -416,9 +446,11 @@ unsigned long ESPEasy_time::now_() {
         if (std::abs(externalUnixTime_offset_usec / 1000000ll) < 86400ll) {
           // Only useful to show adjustment if it is less than a day.
           log += strformat(
-            F(" Time adjusted by %d msec. Wander: %.3f ppm Source: "),
+            F(" Time %s by %d msec. Wander: %.3f ppm Drift: %.2f ppm Source: "),
+            slewed ? "slewed" : "adjusted",
             static_cast<int32_t>(externalUnixTime_offset_usec / 1000ll),
-            timeWander);
+            timeWander,
+            clockDiscipline.getDrift_ppm());
           log += toString(_timeSource);
         }
         addLogMove(LOG_LEVEL_INFO, log);
@@ -439,7 +471,12 @@ unsigned long ESPEasy_time::now_() {
   }
   RTC.lastSysTime = getUnixTime();
   uint32_t localSystime = time_zone.toLocal(RTC.lastSysTime);
-  breakTime(localSystime, local_tm);
+
+  if (localSystime != local_tm_systime) {
+    // Only needed once per second, as sysvars like %syshour% use local_tm
+    breakTime(localSystime, local_tm);
+    local_tm_systime = localSystime;
+  }
 
   calcSunRiseAndSet(timeSynced);
 
@@ -507,6 +544,16 @@ bool ESPEasy_time::systemTimePresent() const {
   return getUnixTime() > get_build_unixtime();
 }
 
+namespace {
+struct NTP_query_struct {
+  IPAddress ip;
+  uint64_t  txMicros{};
+  int64_t   offset_usec{};
+  int64_t   roundtripDelay_usec{};
+  bool      replied{};
+};
+} // namespace
+
 bool ESPEasy_time::getNtpTime(double& unixTime_d)
 {
   if (!Settings.UseNTP() || !ESPEasy::net::NetworkConnected()) {
@@ -520,38 +567,70 @@ bool ESPEasy_time::getNtpTime(double& unixTime_d)
     }
   }
   START_TIMER;
-  IPAddress timeServerIP;
-  String    log = F("NTP  : NTP host ");
 
-  bool useNTPpool = false;
+  // When using the NTP pool, multiple servers are queried at once.
+  // The reply with the shortest round-trip delay is used, as it is least affected by asymmetric network delays.
+  NTP_query_struct queries[NTP_MAX_CANDIDATES];
+  uint8_t nrQueries = 0;
+  String  log       = F("NTP  : NTP host ");
 
-  if (Settings.NTPHost[0] != 0) {
-    if (!resolveHostByName(Settings.NTPHost, timeServerIP)) return false;
+  const bool useNTPpool = Settings.NTPHost[0] == 0;
+
+  if (!useNTPpool) {
+    if (!resolveHostByName(Settings.NTPHost, queries[0].ip)) { return false; }
     log += Settings.NTPHost;
+    log += F(" (");
+    log += formatIP(queries[0].ip);
+    log += ')';
 
     // When single set host fails, retry again in 20 seconds
     nextSyncTime = getUptime_in_sec() + HwRandom(20, 60);
+
+    if (!hostReachable(queries[0].ip)) {
+      log += F(" unreachable");
+      addLogMove(LOG_LEVEL_INFO, log);
+      STOP_TIMER(NTP_FAIL);
+      return false;
+    }
+    nrQueries = 1;
   } else  {
-    // Have to do a lookup each time, since the NTP pool always returns another IP
-    const String ntpServerName = strformat(
-      F("%d.pool.ntp.org"), HwRandom(0, 3));
-    if (!resolveHostByName(ntpServerName.c_str(), timeServerIP)) return false;
-    log += ntpServerName;
+    const long firstPoolHost = HwRandom(0, 4);
+
+    for (uint8_t i = 0; i < NTP_MAX_CANDIDATES && i < 4; ++i) {
+      // Have to do a lookup each time, since the NTP pool always returns another IP
+      const String ntpServerName = strformat(
+        F("%d.pool.ntp.org"), static_cast<int>((firstPoolHost + i) % 4));
+      IPAddress ip;
+
+      if (resolveHostByName(ntpServerName.c_str(), ip) && hostReachable(ip)) {
+        bool duplicate = false;
+
+        for (uint8_t q = 0; q < nrQueries; ++q) {
+          if (queries[q].ip == ip) { duplicate = true; }
+        }
+
+        if (!duplicate) {
+          queries[nrQueries].ip = ip;
+          ++nrQueries;
+
+          if (nrQueries > 1) {
+            log += F(", ");
+          }
+          log += ntpServerName;
+          log += F(" (");
+          log += formatIP(ip);
+          log += ')';
+        }
+      }
+    }
 
     // When pool host fails, retry can be much sooner
     nextSyncTime = getUptime_in_sec() + HwRandom(5, 20);
-    useNTPpool   = true;
-  }
-
-  log += F(" (");
-  log += formatIP(timeServerIP);
-  log += ')';
 
-  if (!hostReachable(timeServerIP)) {
-    log += F(" unreachable");
-    addLogMove(LOG_LEVEL_INFO, log);
-    STOP_TIMER(NTP_FAIL);
-    return false;
+    if (nrQueries == 0) {
+      STOP_TIMER(NTP_FAIL);
+      return false;
+    }
   }
 
   WiFiUDP udp;
@@ -560,7 +639,7 @@ bool ESPEasy_time::getNtpTime(double& unixTime_d)
     return false;
   }
 
-  NTP_packet ntp_packet;
+  constexpr int NTP_packet_size = sizeof(NTP_packet);
 
   log += F(" queried");
 #ifndef BUILD_NO_DEBUG
@@ -570,152 +649,190 @@ bool ESPEasy_time::getNtpTime(double& unixTime_d)
   while (udp.parsePacket() > 0) { // discard any previously received packets
   }
 
-  FeedSW_watchdog();
+  uint8_t nrSent = 0;
 
-  if (udp.beginPacket(timeServerIP, 123) == 0) { // NTP requests are to port 123
+  for (uint8_t i = 0; i < nrQueries; ++i) {
+    FeedSW_watchdog();
+
+    if (udp.beginPacket(queries[i].ip, 123) == 0) { // NTP requests are to port 123
+      continue;
+    }
+    NTP_packet ntp_packet;
+    queries[i].txMicros = getMicros64() + unixTime_usec_uptime_offset;
+    ntp_packet.setTxTimestamp(queries[i].txMicros);
+    udp.write(ntp_packet.data, NTP_packet_size);
+    udp.endPacket();
+    ++nrSent;
+
+#ifndef BUILD_NO_DEBUG
+    addLog(LOG_LEVEL_DEBUG, concat(F("NTP  : before\n"), ntp_packet.toDebugString()));
+#endif // ifndef BUILD_NO_DEBUG
+  }
+
+  if (nrSent == 0) {
     FeedSW_watchdog();
     udp.stop();
     STOP_TIMER(NTP_FAIL);
     return false;
   }
-  constexpr int  NTP_packet_size = sizeof(NTP_packet);
-  const uint64_t txMicros        = getMicros64() + unixTime_usec_uptime_offset;
-  ntp_packet.setTxTimestamp(txMicros);
-  udp.write(ntp_packet.data, NTP_packet_size);
-  udp.endPacket();
 
   const uint32_t beginWait = millis();
+  uint8_t  nrReplies       = 0;
+  int8_t   best            = -1;
+  uint32_t retryDelay_sec  = useNTPpool ? 0 : 60;
 
-#ifndef BUILD_NO_DEBUG
-  addLog(LOG_LEVEL_DEBUG, concat(F("NTP  : before\n"), ntp_packet.toDebugString()));
-#endif // ifndef BUILD_NO_DEBUG
+  while (nrReplies < nrSent && !timeOutReached(beginWait + 1000)) {
+    const int size = udp.parsePacket();
+
+    if (size < NTP_packet_size) {
+      delay(1);
+      continue;
+    }
 
-  while (!timeOutReached(beginWait + 1000)) {
-    const int size       = udp.parsePacket();
-    const int remotePort = udp.remotePort();
+    const int remotePort     = udp.remotePort();
+    const IPAddress remoteIP = udp.remoteIP();
+    NTP_packet ntp_packet;
 
-    if (size >= NTP_packet_size) {
-      if (remotePort != 123) {
-#ifndef BUILD_NO_DEBUG
-        addLog(LOG_LEVEL_DEBUG_MORE, concat(F("NTP  : Reply from wrong port: "), remotePort));
-#endif // ifndef BUILD_NO_DEBUG
-        udp.stop();
-        STOP_TIMER(NTP_FAIL);
-        return false;
-      }
-      udp.read(ntp_packet.data, NTP_packet_size); // read packet into the buffer
-      const uint64_t receivedMicros = getMicros64();
+    udp.read(ntp_packet.data, NTP_packet_size); // read packet into the buffer
+    const uint64_t receivedMicros = getMicros64();
 
-      udp.stop();
+    int8_t index = -1;
 
+    for (uint8_t i = 0; i < nrQueries; ++i) {
+      if ((queries[i].txMicros != 0) && !queries[i].replied && (queries[i].ip == remoteIP)) {
+        index = i;
+      }
+    }
+
+    if ((remotePort != 123) || (index < 0)) {
 #ifndef BUILD_NO_DEBUG
-      addLog(LOG_LEVEL_DEBUG, concat(F("NTP  : after\n"), ntp_packet.toDebugString()));
+      addLog(LOG_LEVEL_DEBUG_MORE, strformat(
+               F("NTP  : Unexpected reply from %s port: %d"),
+               formatIP(remoteIP).c_str(),
+               remotePort));
 #endif // ifndef BUILD_NO_DEBUG
+      continue;
+    }
+    NTP_query_struct& query = queries[index];
+    query.replied = true;
+    ++nrReplies;
 
-      if (ntp_packet.isUnsynchronized()) {
-        // Leap-Indicator: unknown (clock unsynchronized)
-        // See: https://github.com/letscontrolit/ESPEasy/issues/2886#issuecomment-586656384
-        if (loglevelActiveFor(LOG_LEVEL_ERROR)) {
-          addLog(LOG_LEVEL_ERROR, strformat(
-                   F("NTP  : NTP host (%s) unsynchronized"),
-                   formatIP(timeServerIP).c_str()));
-        }
+#ifndef BUILD_NO_DEBUG
+    addLog(LOG_LEVEL_DEBUG, concat(F("NTP  : after\n"), ntp_packet.toDebugString()));
+#endif // ifndef BUILD_NO_DEBUG
 
-        if (!useNTPpool) {
-          // Does not make sense to try it very often if a single host is used which is not synchronized.
-          nextSyncTime = getUptime_in_sec() + 120;
-        }
-        STOP_TIMER(NTP_FAIL);
-        return false;
+    if (ntp_packet.isUnsynchronized()) {
+      // Leap-Indicator: unknown (clock unsynchronized)
+      // See: https://github.com/letscontrolit/ESPEasy/issues/2886#issuecomment-586656384
+      if (loglevelActiveFor(LOG_LEVEL_ERROR)) {
+        addLog(LOG_LEVEL_ERROR, strformat(
+                 F("NTP  : NTP host (%s) unsynchronized"),
+                 formatIP(remoteIP).c_str()));
       }
 
-      // For more detailed info on improving accuracy, see:
-      // https://github.com/lettier/ntpclient/issues/4#issuecomment-360703503
+      if (!useNTPpool) {
+        // Does not make sense to try it very often if a single host is used which is not synchronized.
+        retryDelay_sec = 120;
+      }
+      continue;
+    }
 
-      int64_t offset_usec{};
-      int64_t roundtripDelay_usec{};
+    // For more detailed info on improving accuracy, see:
+    // https://github.com/lettier/ntpclient/issues/4#issuecomment-360703503
 
-      if (!ntp_packet.compute_usec(
-            txMicros,
-            receivedMicros + unixTime_usec_uptime_offset,
-            offset_usec, roundtripDelay_usec))
-      {
+    if (!ntp_packet.compute_usec(
+          query.txMicros,
+          receivedMicros + unixTime_usec_uptime_offset,
+          query.offset_usec, query.roundtripDelay_usec))
+    {
 #ifndef BUILD_NO_DEBUG
-        addLogMove(LOG_LEVEL_ERROR, strformat(
-                     F("NTP  : NTP error: round-trip delay: %d [ms] offset: %s,\n  t0: %s,\n  t1: %s,\n  t2: %s,\n  t3: %s"),
-                     static_cast<int32_t>(roundtripDelay_usec / 1000),
-                     secondsToDayHourMinuteSecond_ms(offset_usec).c_str(),
-                     doubleToString(ntp_packet.getReferenceTimestamp_usec() / 1000000.0, 3).c_str(),
-                     doubleToString(ntp_packet.getOriginTimestamp_usec() / 1000000.0,    3).c_str(),
-                     doubleToString(ntp_packet.getReceiveTimestamp_usec() / 1000000.0,   3).c_str(),
-                     doubleToString(ntp_packet.getTransmitTimestamp_usec() / 1000000.0,  3).c_str()
-                     ));
+      addLogMove(LOG_LEVEL_ERROR, strformat(
+                   F("NTP  : NTP error: round-trip delay: %d [ms] offset: %s,\n  t0: %s,\n  t1: %s,\n  t2: %s,\n  t3: %s"),
+                   static_cast<int32_t>(query.roundtripDelay_usec / 1000),
+                   secondsToDayHourMinuteSecond_ms(query.offset_usec).c_str(),
+                   doubleToString(ntp_packet.getReferenceTimestamp_usec() / 1000000.0, 3).c_str(),
+                   doubleToString(ntp_packet.getOriginTimestamp_usec() / 1000000.0,    3).c_str(),
+                   doubleToString(ntp_packet.getReceiveTimestamp_usec() / 1000000.0,   3).c_str(),
+                   doubleToString(ntp_packet.getTransmitTimestamp_usec() / 1000000.0,  3).c_str()
+                   ));
 #else // ifndef BUILD_NO_DEBUG
-        addLogMove(LOG_LEVEL_ERROR, strformat(
-                     F("NTP  : NTP error: round-trip delay: %d [ms] offset: %s"),
-                     static_cast<int32_t>(roundtripDelay_usec / 1000),
-                     secondsToDayHourMinuteSecond_ms(offset_usec).c_str()
-                     ));
+      addLogMove(LOG_LEVEL_ERROR, strformat(
+                   F("NTP  : NTP error: round-trip delay: %d [ms] offset: %s"),
+                   static_cast<int32_t>(query.roundtripDelay_usec / 1000),
+                   secondsToDayHourMinuteSecond_ms(query.offset_usec).c_str()
+                   ));
 
 #endif // ifndef BUILD_NO_DEBUG
 
-        // Apparently this is not a valid packet
-        // as the received timestamp is before the origin timestamp
-        // or no valid timestamps from the NTP server.
-        nextSyncTime = getUptime_in_sec() + 60;
-        STOP_TIMER(NTP_FAIL);
-        return false;
+      // Apparently this is not a valid packet
+      // as the received timestamp is before the origin timestamp
+      // or no valid timestamps from the NTP server.
+      if (retryDelay_sec < 60) {
+        retryDelay_sec = 60;
       }
+      continue;
+    }
 
-      externalUnixTime_offset_usec = offset_usec;
-      _timeSource                  = timeSource_t::NTP_time_source;
-      lastSyncTime_ms              = millis();
-      lastNTPSyncTime_ms           = lastSyncTime_ms;
-      unixTime_d                   = getMicros64() +
-                                     unixTime_usec_uptime_offset +
-                                     externalUnixTime_offset_usec;
-      unixTime_d /= 1000000.0;
-
-      if (loglevelActiveFor(LOG_LEVEL_INFO)) {
+    if (loglevelActiveFor(LOG_LEVEL_INFO)) {
 #ifndef BUILD_NO_DEBUG
-        addLogMove(LOG_LEVEL_INFO, strformat(
-                     F("NTP  : NTP replied: delay %d ms round-trip delay: %u ms offset: %s,\n  t0: %s,\n  t1: %s,\n  t2: %s,\n  t3: %s"),
-                     timePassedSince(beginWait),
-                     static_cast<uint32_t>(roundtripDelay_usec / 1000),
-                     secondsToDayHourMinuteSecond_ms(offset_usec).c_str(),
-                     doubleToString(ntp_packet.getReferenceTimestamp_usec() / 1000000.0, 3).c_str(),
-                     doubleToString(ntp_packet.getOriginTimestamp_usec() / 1000000.0,    3).c_str(),
-                     doubleToString(ntp_packet.getReceiveTimestamp_usec() / 1000000.0,   3).c_str(),
-                     doubleToString(ntp_packet.getTransmitTimestamp_usec() / 1000000.0,  3).c_str()
-                     ));
+      addLogMove(LOG_LEVEL_INFO, strformat(
+                   F("NTP  : NTP replied: delay %d ms round-trip delay: %u ms offset: %s,\n  t0: %s,\n  t1: %s,\n  t2: %s,\n  t3: %s"),
+                   timePassedSince(beginWait),
+                   static_cast<uint32_t>(query.roundtripDelay_usec / 1000),
+                   secondsToDayHourMinuteSecond_ms(query.offset_usec).c_str(),
+                   doubleToString(ntp_packet.getReferenceTimestamp_usec() / 1000000.0, 3).c_str(),
+                   doubleToString(ntp_packet.getOriginTimestamp_usec() / 1000000.0,    3).c_str(),
+                   doubleToString(ntp_packet.getReceiveTimestamp_usec() / 1000000.0,   3).c_str(),
+                   doubleToString(ntp_packet.getTransmitTimestamp_usec() / 1000000.0,  3).c_str()
+                   ));
 #else // ifndef BUILD_NO_DEBUG
-        addLogMove(LOG_LEVEL_INFO, strformat(
-                     F("NTP  : NTP replied: delay %d ms round-trip delay: %u ms offset: %s"),
-                     timePassedSince(beginWait),
-                     static_cast<uint32_t>(roundtripDelay_usec / 1000),
-                     secondsToDayHourMinuteSecond_ms(offset_usec).c_str()
-                     ));
+      addLogMove(LOG_LEVEL_INFO, strformat(
+                   F("NTP  : NTP replied: delay %d ms round-trip delay: %u ms offset: %s"),
+                   timePassedSince(beginWait),
+                   static_cast<uint32_t>(query.roundtripDelay_usec / 1000),
+                   secondsToDayHourMinuteSecond_ms(query.offset_usec).c_str()
+                   ));
 #endif // ifndef BUILD_NO_DEBUG
-      }
-      ESPEasy::net::CheckRunningServices(); // FIXME TD-er: Sometimes services can only be started after NTP is successful
-      STOP_TIMER(NTP_SUCCESS);
-      return true;
     }
-    delay(1);
-  }
 
-  // Timeout.
-  if (!useNTPpool) {
-    // Retry again in a minute.
-    nextSyncTime = getUptime_in_sec() + 60;
+    if ((best < 0) || (query.roundtripDelay_usec < queries[best].roundtripDelay_usec)) {
+      best = index;
+    }
   }
+  udp.stop();
 
+  if (best < 0) {
+    if (retryDelay_sec != 0) {
+      nextSyncTime = getUptime_in_sec() + retryDelay_sec;
+    }
 #ifndef BUILD_NO_DEBUG
-  addLog(LOG_LEVEL_DEBUG_MORE, F("NTP  : No reply"));
+
+    if (nrReplies == 0) {
+      addLog(LOG_LEVEL_DEBUG_MORE, F("NTP  : No reply"));
+    }
 #endif // ifndef BUILD_NO_DEBUG
-  udp.stop();
-  STOP_TIMER(NTP_FAIL);
-  return false;
+    STOP_TIMER(NTP_FAIL);
+    return false;
+  }
+
+  externalUnixTime_offset_usec = queries[best].offset_usec;
+  _timeSource                  = timeSource_t::NTP_time_source;
+  lastSyncTime_ms              = millis();
+  lastNTPSyncTime_ms           = lastSyncTime_ms;
+  unixTime_d                   = getMicros64() +
+                                 unixTime_usec_uptime_offset +
+                                 externalUnixTime_offset_usec;
+  unixTime_d /= 1000000.0;
+
+  if ((nrReplies > 1) && loglevelActiveFor(LOG_LEVEL_INFO)) {
+    addLog(LOG_LEVEL_INFO, strformat(
+             F("NTP  : Using reply from %s, round-trip delay: %u ms"),
+             formatIP(queries[best].ip).c_str(),
+             static_cast<uint32_t>(queries[best].roundtripDelay_usec / 1000)));
+  }
+  ESPEasy::net::CheckRunningServices(); // FIXME TD-er: Sometimes services can only be started after NTP is successful
+  STOP_TIMER(NTP_SUCCESS);
+  return true;
 }
 
 /**************************************************
@@ -3,10 +3,17 @@
 
 #include "../../ESPEasy_common.h"
 
+#include "../DataStructs/ClockDiscipline.h"
 #include "../DataTypes/ESPEasyTimeSource.h"
 
 #include <time.h>
 
+#ifndef NTP_MAX_CANDIDATES
+
+// Nr of NTP pool servers queried at once
+# define NTP_MAX_CANDIDATES  3
+#endif // ifndef NTP_MAX_CANDIDATES
+
 
 class ESPEasy_time {
 public:
@@ -234,6 +241,7 @@ public:
   
 
   struct tm local_tm;                         // local time
+  uint32_t local_tm_systime = 0;              // local Unix time of local_tm
   uint32_t syncInterval = 3600;               // time sync will be attempted after this many seconds
 
   uint64_t unixTime_usec_uptime_offset = 0.0; // Use usec resolution to get better sync between nodes when using NTP
@@ -249,6 +257,7 @@ private:
   timeSource_t extTimeSource            = timeSource_t::No_time_source;
 public:
   float timeWander                      = 0.0f; // Clock instability in ppm
+  ClockDiscipline clockDiscipline;              // Slew small time corrections and compensate clock drift
   uint32_t lastTimeWanderCalculation_ms = 0;
 
   uint8_t PrevMinutes         = 0;
@@ -14,6 +14,53 @@
 #define SECS_PER_HOUR (3600UL)
 #define SECS_PER_DAY  (SECS_PER_HOUR * 24UL)
 
+namespace {
+// Start of the year in seconds since 1970, computed without makeTime()
+uint32_t startOfYear(int yr)
+{
+  const int y        = yr - 1;
+  const int leapDays = (y / 4 - y / 100 + y / 400) - (1969 / 4 - 1969 / 100 + 1969 / 400);
+
+  return static_cast<uint32_t>((yr - 1970) * 365 + leapDays) * SECS_PER_DAY;
+}
+
+// Same as utcIsDST() and locIsDST(), for time change points given in the same time base as t
+bool isDST(uint32_t t, uint32_t dstStart, uint32_t stdStart, bool observed)
+{
+  if (!observed) {                // daylight time not observed in this tz
+    return false;
+  }
+  else if (stdStart > dstStart) { // northern hemisphere
+    return t >= dstStart && t < stdStart;
+  }
+  else {                          // southern hemisphere
+    return !(t >= stdStart && t < dstStart);
+  }
+}
+} // namespace
+
+void ESPEasy_time_zone::TimeZoneYear::set(uint32_t yearStart,
+                                          uint32_t yearEnd,
+                                          uint32_t dstStart,
+                                          uint32_t stdStart,
+                                          bool     observed,
+                                          int32_t  dstOffset,
+                                          int32_t  stdOffset)
+{
+  // Time change points may lie outside the year, e.g. in UTC for a change on January 1st
+  const uint32_t first = std::min(dstStart, stdStart);
+  const uint32_t last  = std::max(dstStart, stdStart);
+
+  point[0] = yearStart;
+  point[1] = std::min(std::max(first, yearStart), yearEnd);
+  point[2] = std::min(std::max(last, yearStart), yearEnd);
+  point[3] = yearEnd;
+
+  // The DST state only changes at the time change points, so it is constant from point[i] up to point[i + 1]
+  for (int i = 0; i < 3; ++i) {
+    offset[i] = (isDST(point[i], dstStart, stdStart, observed) ? dstOffset : stdOffset) * static_cast<int32_t>(SECS_PER_MIN);
+  }
+}
 
 
 void ESPEasy_time_zone::getDefaultDst_flash_values(uint16_t& start, uint16_t& end) {
@@ -138,6 +185,14 @@ bool ESPEasy_time_zone::calcTimeChanges(int yr)
   m_stdLoc = stdLoc;
   m_dstUTC = m_dstLoc - m_std.offset * SECS_PER_MIN;
   m_stdUTC = m_stdLoc - m_dst.offset * SECS_PER_MIN;
+  m_year   = yr;
+
+  const uint32_t yearStart = startOfYear(yr);
+  const uint32_t yearEnd   = startOfYear(yr + 1);
+  const bool     observed  = m_stdUTC != m_dstUTC;
+
+  m_utcYear.set(yearStart, yearEnd, m_dstUTC, m_stdUTC, observed, m_dst.offset, m_std.offset);
+  m_locYear.set(yearStart, yearEnd, m_dstLoc, m_stdLoc, observed, m_dst.offset, m_std.offset);
   return changed;
 }
 
@@ -147,15 +202,9 @@ bool ESPEasy_time_zone::calcTimeChanges(int yr)
 *----------------------------------------------------------------------*/
 uint32_t ESPEasy_time_zone::toLocal(uint32_t utc)
 {
-  // recalculate the time change points if needed
-  if (ESPEasy_time::year(utc) != ESPEasy_time::year(m_dstUTC)) { calcTimeChanges(ESPEasy_time::year(utc)); }
+  if (!m_utcYear.contains(utc)) { calcTimeChanges(ESPEasy_time::year(utc)); }
 
-  if (utcIsDST(utc)) {
-    return utc + m_dst.offset * SECS_PER_MIN;
-  }
-  else {
-    return utc + m_std.offset * SECS_PER_MIN;
-  }
+  return utc + m_utcYear.offsetAt(utc);
 }
 
 /*----------------------------------------------------------------------*
@@ -164,15 +213,9 @@ uint32_t ESPEasy_time_zone::toLocal(uint32_t utc)
 *-----------------------------------------------------------------------*/
 uint32_t ESPEasy_time_zone::fromLocal(uint32_t local)
 {
-  // recalculate the time change points if needed
-  if (ESPEasy_time::year(local) != ESPEasy_time::year(m_dstUTC)) { calcTimeChanges(ESPEasy_time::year(local)); }
+  if (!m_locYear.contains(local)) { calcTimeChanges(ESPEasy_time::year(local)); }
 
-  if (locIsDST(local)) {
-    return local - m_dst.offset * SECS_PER_MIN;
-  }
-  else {
-    return local - m_std.offset * SECS_PER_MIN;
-  }
+  return local - m_locYear.offsetAt(local);
 }
 
 
@@ -185,17 +228,11 @@ uint32_t ESPEasy_time_zone::fromLocal(uint32_t local)
 bool ESPEasy_time_zone::utcIsDST(uint32_t utc)
 {
   // recalculate the time change points if needed
-  if (ESPEasy_time::year(utc) != ESPEasy_time::year(m_dstUTC)) { calcTimeChanges(ESPEasy_time::year(utc)); }
+  const int yr = ESPEasy_time::year(utc);
 
-  if (m_stdUTC == m_dstUTC) {     // daylight time not observed in this tz
-    return false;
-  }
-  else if (m_stdUTC > m_dstUTC) { // northern hemisphere
-    return utc >= m_dstUTC && utc < m_stdUTC;
-  }
-  else {                          // southern hemisphere
-    return !(utc >= m_stdUTC && utc < m_dstUTC);
-  }
+  if (yr != m_year) { calcTimeChanges(yr); }
+
+  return isDST(utc, m_dstUTC, m_stdUTC, m_stdUTC != m_dstUTC);
 }
 
 /*----------------------------------------------------------------------*
@@ -205,17 +242,11 @@ bool ESPEasy_time_zone::utcIsDST(uint32_t utc)
 bool ESPEasy_time_zone::locIsDST(uint32_t local)
 {
   // recalculate the time change points if needed
-  if (ESPEasy_time::year(local) != ESPEasy_time::year(m_dstLoc)) { calcTimeChanges(ESPEasy_time::year(local)); }
+  const int yr = ESPEasy_time::year(local);
 
-  if (m_stdUTC == m_dstUTC) {     // daylight time not observed in this tz
-    return false;
-  }
-  else if (m_stdLoc > m_dstLoc) { // northern hemisphere
-    return local >= m_dstLoc && local < m_stdLoc;
-  }
-  else {                          // southern hemisphere
-    return !(local >= m_stdLoc && local < m_dstLoc);
-  }
+  if (yr != m_year) { calcTimeChanges(yr); }
+
+  return isDST(local, m_dstLoc, m_stdLoc, m_stdUTC != m_dstUTC);
 }
 
 
@@ -116,7 +116,40 @@ uint32_t m_dstUTC = 0; // dst start for given/current year, given in UTC
 uint32_t m_stdUTC = 0; // std time start for given/current year, given in UTC
 uint32_t m_dstLoc = 0; // dst start for given/current year, given in local time
 uint32_t m_stdLoc = 0; // std time start for given/current year, given in local time
+int      m_year   = 0; // year for which the time change points were calculated
+
+private:
+
+// Start of the year, both time change points in order and start of the next year.
+// The offset to UTC is constant between 2 consecutive points.
+// Conversions within the year are just a lookup and an addition,
+// without computing the year and the time change points.
+struct TimeZoneYear {
+  bool contains(uint32_t t) const {
+    return t >= point[0] && t < point[3];
+  }
+
+  int32_t offsetAt(uint32_t t) const {
+    if (t < point[1]) { return offset[0]; }
+
+    if (t < point[2]) { return offset[1]; }
+    return offset[2];
+  }
+
+  void set(uint32_t yearStart,
+           uint32_t yearEnd,
+           uint32_t dstStart,
+           uint32_t stdStart,
+           bool     observed,
+           int32_t  dstOffset,
+           int32_t  stdOffset);
+
+  uint32_t point[4]  = {};
+  int32_t  offset[3] = {}; // seconds
+};
 
+TimeZoneYear m_utcYear; // time change points of m_year, given in UTC
+TimeZoneYear m_locYear; // time change points of m_year, given in local time
 
 };
 
@@ -0,0 +1,230 @@
+#include "../Helpers/Hardware_ADC_continuous.h"
+
+#if FEATURE_ADC_CONTINUOUS
+
+# include "../ESPEasyCore/ESPEasy_Log.h"
+# include "../Helpers/Hardware_GPIO.h"
+# include "../Helpers/StringConverter.h"
+
+# if CONFIG_IDF_TARGET_ESP32 || CONFIG_IDF_TARGET_ESP32S2
+#  define ADC_CONTINUOUS_OUTPUT_TYPE          ADC_DIGI_OUTPUT_FORMAT_TYPE1
+#  define ADC_CONTINUOUS_GET_CHANNEL(p_data)  ((p_data)->type1.channel)
+#  define ADC_CONTINUOUS_GET_DATA(p_data)     ((p_data)->type1.data)
+# else // if CONFIG_IDF_TARGET_ESP32 || CONFIG_IDF_TARGET_ESP32S2
+#  define ADC_CONTINUOUS_OUTPUT_TYPE          ADC_DIGI_OUTPUT_FORMAT_TYPE2
+#  define ADC_CONTINUOUS_GET_CHANNEL(p_data)  ((p_data)->type2.channel)
+#  define ADC_CONTINUOUS_GET_DATA(p_data)     ((p_data)->type2.data)
+# endif // if CONFIG_IDF_TARGET_ESP32 || CONFIG_IDF_TARGET_ESP32S2
+
+# define ADC_CONTINUOUS_NR_CHANNELS  SOC_ADC_CHANNEL_NUM(0)
+
+
+struct ADC_continuous_channel_t {
+  ADC_reduce_t samples;
+  int          pin = -1;
+  adc_atten_t  attenuation{};
+
+  // Nr of times the pin was registered
+  uint8_t refCount{};
+};
+
+ADC_continuous_channel_t ADC_continuous_channels[ADC_CONTINUOUS_NR_CHANNELS];
+adc_continuous_handle_t  ADC_continuous_handle = nullptr;
+
+
+void ADC_continuous_stop()
+{
+  if (ADC_continuous_handle == nullptr) { return; }
+  adc_continuous_stop(ADC_continuous_handle);
+  adc_continuous_deinit(ADC_continuous_handle);
+  ADC_continuous_handle = nullptr;
+}
+
+bool ADC_continuous_start()
+{
+  ADC_continuous_stop();
+
+  adc_digi_pattern_config_t pattern[SOC_ADC_PATT_LEN_MAX]{};
+  uint32_t pattern_num = 0;
+
+  for (int ch = 0; ch < ADC_CONTINUOUS_NR_CHANNELS && pattern_num < SOC_ADC_PATT_LEN_MAX; ++ch) {
+    if (ADC_continuous_channels[ch].refCount > 0) {
+      pattern[pattern_num].atten     = ADC_continuous_channels[ch].attenuation;
+      pattern[pattern_num].channel   = ch;
+      pattern[pattern_num].unit      = ADC_UNIT_1;
+      pattern[pattern_num].bit_width = SOC_ADC_DIGI_MAX_BITWIDTH;
+      ++pattern_num;
+    }
+  }
+
+  if (pattern_num == 0) {
+    return true;
+  }
+
+  adc_continuous_handle_cfg_t handle_config{};
+  handle_config.max_store_buf_size = ADC_CONTINUOUS_BUFFER_SIZE;
+  handle_config.conv_frame_size    = ADC_CONTINUOUS_FRAME_SIZE;
+
+  // Drop the oldest results when the buffer is full, not the newest
+  handle_config.flags.flush_pool = 1;
+
+  if (ESP_OK != adc_continuous_new_handle(&handle_config, &ADC_continuous_handle)) {
+    ADC_continuous_handle = nullptr;
+    return false;
+  }
+
+  uint32_t sample_freq = ADC_CONTINUOUS_SAMPLE_FREQ;
+
+  if (sample_freq < SOC_ADC_SAMPLE_FREQ_THRES_LOW) { sample_freq = SOC_ADC_SAMPLE_FREQ_THRES_LOW; }
+
+  if (sample_freq > SOC_ADC_SAMPLE_FREQ_THRES_HIGH) { sample_freq = SOC_ADC_SAMPLE_FREQ_THRES_HIGH; }
+
+  adc_continuous_config_t config{};
+  config.pattern_num    = pattern_num;
+  config.adc_pattern    = pattern;
+  config.sample_freq_hz = sample_freq;
+  config.conv_mode      = ADC_CONV_SINGLE_UNIT_1;
+  config.format         = ADC_CONTINUOUS_OUTPUT_TYPE;
+
+  if ((ESP_OK != adc_continuous_config(ADC_continuous_handle, &config)) ||
+      (ESP_OK != adc_continuous_start(ADC_continuous_handle))) {
+    adc_continuous_deinit(ADC_continuous_handle);
+    ADC_continuous_handle = nullptr;
+    return false;
+  }
+  return true;
+}
+
+bool ADC_continuous_addPin(int pin, adc_atten_t attenuation)
+{
+  int adc{};
+  int ch{};
+  int t = -1;
+
+  if (!getADC_gpio_info(pin, adc, ch, t) || (adc != 1) ||
+      (ch < 0) || (ch >= ADC_CONTINUOUS_NR_CHANNELS)) {
+    return false;
+  }
+  ADC_continuous_channel_t& channel = ADC_continuous_channels[ch];
+
+  const bool mustRestart = (channel.refCount == 0) || (channel.attenuation != attenuation);
+
+  const int         prevPin         = channel.pin;
+  const adc_atten_t prevAttenuation = channel.attenuation;
+
+  channel.pin         = pin;
+  channel.attenuation = attenuation;
+  ++channel.refCount;
+
+  if (!mustRestart && (ADC_continuous_handle != nullptr)) {
+    return true;
+  }
+
+  if (!ADC_continuous_start()) {
+    addLog(LOG_LEVEL_ERROR, concat(F("ADC  : Could not start continuous mode on GPIO-"), pin));
+
+    // Undo the registration and try to resume sampling the other pins.
+    --channel.refCount;
+    channel.pin         = prevPin;
+    channel.attenuation = prevAttenuation;
+    ADC_continuous_start();
+    return false;
+  }
+  return true;
+}
+
+void ADC_continuous_removePin(int pin)
+{
+  for (int ch = 0; ch < ADC_CONTINUOUS_NR_CHANNELS; ++ch) {
+    ADC_continuous_channel_t& channel = ADC_continuous_channels[ch];
+
+    if ((channel.pin == pin) && (channel.refCount > 0)) {
+      --channel.refCount;
+
+      if (channel.refCount == 0) {
+        channel.samples.clear();
+        channel.pin = -1;
+        ADC_continuous_start();
+      }
+      return;
+    }
+  }
+}
+
+void ADC_continuous_poll()
+{
+  if (ADC_continuous_handle == nullptr) { return; }
+
+  constexpr size_t maxResults = ADC_CONTINUOUS_FRAME_SIZE / SOC_ADC_DIGI_RESULT_BYTES;
+
+  uint8_t  frame[ADC_CONTINUOUS_FRAME_SIZE];
+  uint16_t values[maxResults];
+
+  // Limit the nr of frames per call, in case the DMA fills the buffer faster than we read it.
+  // Allows to read a full buffer plus the frames converted while reading it.
+  constexpr int maxFrames = 2 * (ADC_CONTINUOUS_BUFFER_SIZE / ADC_CONTINUOUS_FRAME_SIZE);
+
+  for (int i = 0; i < maxFrames; ++i) {
+    uint32_t length{};
+
+    if ((ESP_OK != adc_continuous_read(ADC_continuous_handle, frame, sizeof(frame), &length, 0)) ||
+        (length == 0)) {
+      return;
+    }
+    const size_t nrResults = length / SOC_ADC_DIGI_RESULT_BYTES;
+
+    // Collect the samples per channel in a contiguous array,
+    // so each channel can be reduced as a single block.
+    for (int ch = 0; ch < ADC_CONTINUOUS_NR_CHANNELS; ++ch) {
+      if (ADC_continuous_channels[ch].refCount == 0) { continue; }
+      size_t nrValues = 0;
+
+      for (size_t r = 0; r < nrResults; ++r) {
+        const adc_digi_output_data_t *p = reinterpret_cast<const adc_digi_output_data_t *>(&frame[r * SOC_ADC_DIGI_RESULT_BYTES]);
+
+        if (ADC_CONTINUOUS_GET_CHANNEL(p) == static_cast<uint32_t>(ch)) {
+          values[nrValues] = ADC_CONTINUOUS_GET_DATA(p);
+          ++nrValues;
+        }
+      }
+      ADC_continuous_channels[ch].samples.add(values, nrValues);
+    }
+  }
+}
+
+ADC_continuous_channel_t* ADC_continuous_getChannel(int pin)
+{
+  for (int ch = 0; ch < ADC_CONTINUOUS_NR_CHANNELS; ++ch) {
+    ADC_continuous_channel_t& channel = ADC_continuous_channels[ch];
+
+    if ((channel.pin == pin) && (channel.refCount > 0)) {
+      return &channel;
+    }
+  }
+  return nullptr;
+}
+
+bool ADC_continuous_take(int pin, ADC_reduce_t& result)
+{
+  ADC_continuous_channel_t *channel = ADC_continuous_getChannel(pin);
+
+  if ((channel == nullptr) || (channel->samples.count == 0)) {
+    return false;
+  }
+  result = channel->samples;
+  channel->samples.clear();
+  return true;
+}
+
+bool ADC_continuous_peek(int pin, ADC_reduce_t& result)
+{
+  const ADC_continuous_channel_t *channel = ADC_continuous_getChannel(pin);
+
+  if ((channel == nullptr) || (channel->samples.count == 0)) {
+    return false;
+  }
+  result = channel->samples;
+  return true;
+}
+
+#endif // if FEATURE_ADC_CONTINUOUS
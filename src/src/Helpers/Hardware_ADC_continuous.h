@@ -0,0 +1,65 @@
+#ifndef HELPERS_HARDWARE_ADC_CONTINUOUS_H
+#define HELPERS_HARDWARE_ADC_CONTINUOUS_H
+
+#include "../../ESPEasy_common.h"
+
+#if FEATURE_ADC_CONTINUOUS
+
+# include "../Helpers/ADC_reduce.h"
+
+# include <esp_adc/adc_continuous.h>
+
+/********************************************************************************************\
+   ADC continuous mode (DMA)
+
+   ADC1 is sampled continuously by the hardware and conversion results are collected
+   in a DMA buffer. All registered pins share the ADC unit and the sample rate.
+   poll() reduces all available conversion results per pin, so the DMA buffer only needs
+   to hold the results between 2 calls to poll().
+   The buffer is sized for 200 msec, i.e. 2 periods of PLUGIN_TEN_PER_SECOND.
+   When the DMA buffer overflows anyway, the oldest results are dropped (flush_pool).
+
+   N.B. Pins of the same ADC unit can not be read in one-shot mode (analogRead)
+   while continuous mode is active.
+ \*********************************************************************************************/
+
+// Total conversion rate of all pins in Hz
+# ifndef ADC_CONTINUOUS_SAMPLE_FREQ
+#  define ADC_CONTINUOUS_SAMPLE_FREQ   20000
+# endif // ifndef ADC_CONTINUOUS_SAMPLE_FREQ
+
+# define ADC_CONTINUOUS_FRAME_SIZE     256
+
+// Size of the DMA buffer in bytes, must be a multiple of ADC_CONTINUOUS_FRAME_SIZE.
+// Default: 200 msec of conversion results, rounded up to whole frames.
+# ifndef ADC_CONTINUOUS_BUFFER_SIZE
+#  define ADC_CONTINUOUS_BUFFER_SIZE \
+  ((((ADC_CONTINUOUS_SAMPLE_FREQ * SOC_ADC_DIGI_RESULT_BYTES / 5) + ADC_CONTINUOUS_FRAME_SIZE - 1) / \
+    ADC_CONTINUOUS_FRAME_SIZE) * ADC_CONTINUOUS_FRAME_SIZE)
+# endif // ifndef ADC_CONTINUOUS_BUFFER_SIZE
+
+
+// Start sampling the pin. Pins can be registered multiple times.
+// @retval false when the pin is not on ADC1 or continuous mode could not be started.
+bool ADC_continuous_addPin(int         pin,
+                           adc_atten_t attenuation);
+
+void ADC_continuous_removePin(int pin);
+
+// Reduce all conversion results available in the DMA buffer.
+void ADC_continuous_poll();
+
+// Get the samples collected for this pin since the last call and clear them.
+// When the pin is used in several tasks, each task only gets the samples collected since another task took them.
+// @retval false when no samples were collected.
+bool ADC_continuous_take(int           pin,
+                         ADC_reduce_t& result);
+
+// Get the samples collected for this pin since the last call to take(), without clearing them.
+// @retval false when no samples were collected.
+bool ADC_continuous_peek(int           pin,
+                         ADC_reduce_t& result);
+
+#endif // if FEATURE_ADC_CONTINUOUS
+
+#endif // ifndef HELPERS_HARDWARE_ADC_CONTINUOUS_H
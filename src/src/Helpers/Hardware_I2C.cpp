@@ -4,6 +4,7 @@
 #include "../Globals/Statistics.h"
 #include "../Helpers/Hardware_defines.h"
 #include "../Helpers/Hardware_GPIO.h"
+#include "../Helpers/I2C_BusScheduler.h"
 #include "../Helpers/I2C_access.h"
 #include "../Helpers/StringConverter.h"
 
@@ -13,6 +14,15 @@
 
 void initI2C() {
   // configure hardware pins according to eeprom settings.
+  #if FEATURE_I2C_BUS_SCHEDULER
+
+  // Bus or multiplexer configuration may have changed
+  for (uint8_t i2cBus = 0; i2cBus < I2C_BUS_SCHEDULER_MAX_BUS; ++i2cBus) {
+    I2C_muxStateInvalidate(i2cBus);
+  }
+  I2C_clearBusStats();
+  #endif // if FEATURE_I2C_BUS_SCHEDULER
+
   if (Settings.getNrConfiguredI2C_buses() == 0)
   {
     return;
@@ -107,7 +117,11 @@ void I2CSelectClockSpeed(uint8_t i2cBus, uint32_t clockFreq) {
   const int8_t   i2c_scl           = Settings.getI2CSclPin(i2cBus);
   const uint32_t ClockStretchLimit = Settings.getI2CClockStretch(i2cBus);
 
+  #if FEATURE_I2C_BUS_SCHEDULER
+  I2C_clockSelected(i2cBus, I2CBegin(i2c_sda, i2c_scl, clockFreq, ClockStretchLimit));
+  #else // if FEATURE_I2C_BUS_SCHEDULER
   I2CBegin(i2c_sda, i2c_scl, clockFreq, ClockStretchLimit);
+  #endif // if FEATURE_I2C_BUS_SCHEDULER
 }
 
 void I2CForceResetBus_swap_pins(uint8_t i2cBus, uint8_t address) {
@@ -129,7 +143,7 @@ void I2CForceResetBus_swap_pins(uint8_t i2cBus, uint8_t address) {
   I2CSelectClockSpeed(i2cBus, 100000);
 }
 
-void I2CBegin(int8_t sda, int8_t scl, uint32_t clockFreq, uint32_t clockStretch) {
+bool I2CBegin(int8_t sda, int8_t scl, uint32_t clockFreq, uint32_t clockStretch) {
   #ifdef ESP32
   uint32_t lastI2CClockSpeed = Wire.getClock();
   #else // ifdef ESP32
@@ -141,7 +155,7 @@ void I2CBegin(int8_t sda, int8_t scl, uint32_t clockFreq, uint32_t clockStretch)
 
   if ((clockFreq == lastI2CClockSpeed) && (sda == last_sda) && (scl == last_scl) && (clockStretch == last_stretch)) {
     // No need to change the clock speed.
-    return;
+    return false;
   }
   if (sda == -1 || scl == -1) {
 #ifdef ESP32
@@ -149,7 +163,7 @@ void I2CBegin(int8_t sda, int8_t scl, uint32_t clockFreq, uint32_t clockStretch)
 #endif
     last_sda = sda;
     last_scl = scl;
-    return;
+    return true;
   }
 
 
@@ -197,6 +211,7 @@ void I2CBegin(int8_t sda, int8_t scl, uint32_t clockFreq, uint32_t clockStretch)
     #endif // ifdef ESP32
     last_stretch = clockStretch;
   }
+  return true;
 }
 
 #if FEATURE_I2CMULTIPLEXER
@@ -215,6 +230,9 @@ void I2CMultiplexerReset(uint8_t i2cBus) {
     digitalWrite(Multiplexer_ResetPin, LOW);
     delay(1); // minimum requirement of low for a proper reset seems to be about 6 nsec, so 1 msec should be more than sufficient
     digitalWrite(Multiplexer_ResetPin, HIGH);
+    # if FEATURE_I2C_BUS_SCHEDULER
+    I2C_muxStateInvalidate(i2cBus);
+    # endif // if FEATURE_I2C_BUS_SCHEDULER
   }
 }
 
@@ -284,7 +302,15 @@ void SetI2CMultiplexer(uint8_t i2cBus, uint8_t toWrite) {
   if (isI2CMultiplexerEnabled(i2cBus)) {
     const int8_t Multiplexer_Addr = Settings.getI2CMultiplexerAddr(i2cBus);
 
+    # if FEATURE_I2C_BUS_SCHEDULER
+
+    if (!I2C_muxWriteNeeded(i2cBus, toWrite)) {
+      return; // Already selected
+    }
+    I2C_muxWritten(i2cBus, toWrite, I2C_write8(Multiplexer_Addr, toWrite));
+    # else // if FEATURE_I2C_BUS_SCHEDULER
     I2C_write8(Multiplexer_Addr, toWrite);
+    # endif // if FEATURE_I2C_BUS_SCHEDULER
 
     // FIXME TD-er: We must check if the chip needs some time to set the output. (delay?)
   }
@@ -14,7 +14,9 @@ void I2CSelectClockSpeed(uint8_t  i2cBus,
                          uint32_t clockFreq);
 void I2CForceResetBus_swap_pins(uint8_t i2cBus,
                                 uint8_t address);
-void I2CBegin(int8_t   sda,
+
+// @retval true when the bus was (re)configured
+bool I2CBegin(int8_t   sda,
               int8_t   scl,
               uint32_t clockFreq,
               uint32_t clockStretch);
@@ -0,0 +1,175 @@
+#include "../Helpers/I2C_BusScheduler.h"
+
+#if FEATURE_I2C_BUS_SCHEDULER
+
+# include "../Helpers/ESPEasy_time_calc.h"
+# include "../Helpers/Hardware_I2C.h"
+
+
+I2C_bus_stats_t I2C_bus_stats[I2C_BUS_SCHEDULER_MAX_BUS];
+
+// Last written multiplexer value per bus, -1 = unknown
+int16_t  I2C_muxState[I2C_BUS_SCHEDULER_MAX_BUS] = { -1, -1, -1 };
+
+uint64_t I2C_transactionStart[I2C_BUS_SCHEDULER_MAX_BUS]{};
+
+uint8_t I2C_batchLevel = 0;
+int8_t  I2C_deferredBus = -1;
+
+
+void I2C_bus_stats_t::clear()
+{
+  *this      = I2C_bus_stats_t();
+  statsStart = millis();
+}
+
+uint32_t I2C_bus_stats_t::getUtilisation() const
+{
+  const int32_t elapsed_msec = timePassedSince(statsStart);
+
+  if (elapsed_msec <= 0) { return 0; }
+
+  // busy usec / (elapsed msec * 1000) in 0.1% units
+  return static_cast<uint32_t>(busyTime_usec / static_cast<uint64_t>(elapsed_msec));
+}
+
+uint32_t I2C_bus_stats_t::getAvgLatency() const
+{
+  if (transactions == 0) { return 0; }
+  return static_cast<uint32_t>(busyTime_usec / transactions);
+}
+
+const I2C_bus_stats_t& I2C_getBusStats(uint8_t i2cBus)
+{
+  if (i2cBus >= I2C_BUS_SCHEDULER_MAX_BUS) {
+    i2cBus = 0;
+  }
+  return I2C_bus_stats[i2cBus];
+}
+
+void I2C_clearBusStats()
+{
+  for (uint8_t i2cBus = 0; i2cBus < I2C_BUS_SCHEDULER_MAX_BUS; ++i2cBus) {
+    I2C_bus_stats[i2cBus].clear();
+  }
+}
+
+/********************************************************************************************\
+   Bus state cache
+ \*********************************************************************************************/
+bool I2C_muxWriteNeeded(uint8_t i2cBus, uint8_t toWrite)
+{
+  if (i2cBus >= I2C_BUS_SCHEDULER_MAX_BUS) { return true; }
+
+  if (I2C_muxState[i2cBus] == toWrite) {
+    ++I2C_bus_stats[i2cBus].muxWritesSkipped;
+    return false;
+  }
+  return true;
+}
+
+void I2C_muxWritten(uint8_t i2cBus, uint8_t toWrite, bool success)
+{
+  if (i2cBus >= I2C_BUS_SCHEDULER_MAX_BUS) { return; }
+
+  ++I2C_bus_stats[i2cBus].muxWrites;
+  I2C_muxState[i2cBus] = success ? toWrite : -1;
+}
+
+void I2C_muxStateInvalidate(uint8_t i2cBus)
+{
+  if (i2cBus >= I2C_BUS_SCHEDULER_MAX_BUS) { return; }
+  I2C_muxState[i2cBus] = -1;
+}
+
+void I2C_clockSelected(uint8_t i2cBus, bool changed)
+{
+  if (i2cBus >= I2C_BUS_SCHEDULER_MAX_BUS) { return; }
+
+  if (changed) {
+    ++I2C_bus_stats[i2cBus].clockChanges;
+  } else {
+    ++I2C_bus_stats[i2cBus].clockChangesSkipped;
+  }
+}
+
+/********************************************************************************************\
+   Task call transactions
+ \*********************************************************************************************/
+void I2C_startTransaction(uint8_t i2cBus)
+{
+  if (i2cBus >= I2C_BUS_SCHEDULER_MAX_BUS) { return; }
+  I2C_transactionStart[i2cBus] = getMicros64();
+}
+
+void I2C_endTransaction(uint8_t i2cBus)
+{
+  if (i2cBus >= I2C_BUS_SCHEDULER_MAX_BUS) { return; }
+
+  if (I2C_transactionStart[i2cBus] == 0) { return; }
+
+  const uint32_t duration = usecPassedSince(I2C_transactionStart[i2cBus]);
+
+  I2C_transactionStart[i2cBus] = 0;
+
+  I2C_bus_stats_t& stats = I2C_bus_stats[i2cBus];
+
+  ++stats.transactions;
+  stats.busyTime_usec += duration;
+
+  if (duration > stats.maxLatency_usec) {
+    stats.maxLatency_usec = duration;
+  }
+}
+
+/********************************************************************************************\
+   Batched task calls
+ \*********************************************************************************************/
+void I2C_beginBatch()
+{
+  ++I2C_batchLevel;
+}
+
+void I2C_endBatch()
+{
+  if (I2C_batchLevel == 0) { return; }
+  --I2C_batchLevel;
+
+  if (I2C_batchLevel == 0) {
+    I2C_flushDeferredPostTask();
+  }
+}
+
+bool I2C_deferPostTask(uint8_t i2cBus)
+{
+  if (I2C_batchLevel == 0) {
+    return false;
+  }
+  I2C_deferredBus = i2cBus;
+  return true;
+}
+
+void I2C_flushDeferredPostTask()
+{
+  if (I2C_deferredBus < 0) { return; }
+
+  const uint8_t lastBus = I2C_deferredBus;
+
+  I2C_deferredBus = -1;
+
+  // Same as post_I2C_by_taskIndex()
+  # if FEATURE_I2CMULTIPLEXER
+  I2CMultiplexerOff(lastBus);
+  # endif // if FEATURE_I2CMULTIPLEXER
+
+  I2CSelectHighClockSpeed(lastBus); // Reset, stay on last used bus
+}
+
+void I2C_flushDeferredPostTaskOnOtherBus(uint8_t i2cBus)
+{
+  if ((I2C_deferredBus >= 0) && (I2C_deferredBus != i2cBus)) {
+    I2C_flushDeferredPostTask();
+  }
+}
+
+#endif // if FEATURE_I2C_BUS_SCHEDULER
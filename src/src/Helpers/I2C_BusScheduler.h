@@ -0,0 +1,96 @@
+#ifndef HELPERS_I2C_BUSSCHEDULER_H
+#define HELPERS_I2C_BUSSCHEDULER_H
+
+#include "../../ESPEasy_common.h"
+
+#if FEATURE_I2C_BUS_SCHEDULER
+
+# include "../Helpers/Hardware_device_info.h"
+
+/********************************************************************************************\
+   I2C bus scheduler
+
+   Before each call to an I2C task, the bus clock speed is set and the multiplexer channel
+   of the task is selected. After the call, the multiplexer is switched off again.
+
+   - The last written multiplexer channel is kept per bus, so writing the same value
+     again is skipped.
+   - Periodic calls to all tasks (e.g. PLUGIN_TEN_PER_SECOND) and task reads which
+     are due at the same moment are done in a batch, in the usual order.
+     The reset of the bus state is then deferred until a task which is not using
+     the same bus state is called, or the batch ends.
+ \*********************************************************************************************/
+
+struct I2C_bus_stats_t {
+  void     clear();
+
+  // Time spent in I2C task calls, in 0.1% of the time since last clear()
+  uint32_t getUtilisation() const;
+
+  // Average duration of an I2C task call in usec
+  uint32_t getAvgLatency() const;
+
+  uint64_t busyTime_usec{};
+  uint32_t statsStart{};
+  uint32_t transactions{};
+  uint32_t maxLatency_usec{};
+  uint32_t muxWrites{};
+  uint32_t muxWritesSkipped{};
+  uint32_t clockChanges{};
+  uint32_t clockChangesSkipped{};
+};
+
+// Nr of supported buses, may exceed the nr of buses enabled in the build.
+constexpr uint8_t I2C_BUS_SCHEDULER_MAX_BUS = 3;
+
+const I2C_bus_stats_t& I2C_getBusStats(uint8_t i2cBus);
+
+// Called when the I2C buses are (re)initialized and by the command I2CStatsReset.
+void                   I2C_clearBusStats();
+
+/********************************************************************************************\
+   Bus state cache
+ \*********************************************************************************************/
+
+// Check whether the multiplexer must be written, or already has this value set.
+bool I2C_muxWriteNeeded(uint8_t i2cBus,
+                        uint8_t toWrite);
+
+// Keep track of the written value.
+// When the write failed, the multiplexer state is considered unknown.
+void I2C_muxWritten(uint8_t i2cBus,
+                    uint8_t toWrite,
+                    bool    success);
+
+// Mark the multiplexer state as unknown, e.g. after a reset of the multiplexer
+void I2C_muxStateInvalidate(uint8_t i2cBus);
+
+void I2C_clockSelected(uint8_t i2cBus,
+                       bool    changed);
+
+/********************************************************************************************\
+   Task call transactions
+ \*********************************************************************************************/
+void I2C_startTransaction(uint8_t i2cBus);
+void I2C_endTransaction(uint8_t i2cBus);
+
+/********************************************************************************************\
+   Batched task calls
+ \*********************************************************************************************/
+void I2C_beginBatch();
+void I2C_endBatch();
+
+// @retval true when resetting the bus state must be deferred as a batch is active.
+bool I2C_deferPostTask(uint8_t i2cBus);
+
+// Perform the deferred reset of the bus state, if any.
+// The bus of the deferred reset must still be selected, as the multiplexer is written on the current bus.
+void I2C_flushDeferredPostTask();
+
+// Perform the deferred reset when it is for another bus, before switching to the given bus.
+// Thus at most one bus is not in its default state.
+void I2C_flushDeferredPostTaskOnOtherBus(uint8_t i2cBus);
+
+#endif // if FEATURE_I2C_BUS_SCHEDULER
+
+#endif // ifndef HELPERS_I2C_BUSSCHEDULER_H
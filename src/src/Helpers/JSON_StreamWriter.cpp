@@ -0,0 +1,219 @@
+#include "../Helpers/JSON_StreamWriter.h"
+
+#include "../Globals/Settings.h"
+#include "../Helpers/Numerical.h"
+
+#include "../WebServer/HTML_wrappers.h"
+
+
+JSON_StreamWriter::~JSON_StreamWriter()
+{
+  while (_level > 0) {
+    end();
+  }
+}
+
+bool JSON_StreamWriter::beginObject()
+{
+  return begin(false);
+}
+
+bool JSON_StreamWriter::beginArray()
+{
+  return begin(true);
+}
+
+bool JSON_StreamWriter::beginObject(const __FlashStringHelper *key)
+{
+  if (_level >= JSON_STREAM_MAX_LEVEL - 1) { return false; }
+  writeKey(key);
+  return begin(false);
+}
+
+bool JSON_StreamWriter::beginArray(const __FlashStringHelper *key)
+{
+  if (_level >= JSON_STREAM_MAX_LEVEL - 1) { return false; }
+  writeKey(key);
+  return begin(true);
+}
+
+bool JSON_StreamWriter::begin(bool isArray)
+{
+  if (_level >= JSON_STREAM_MAX_LEVEL - 1) {
+    _afterKey = false;
+    return false;
+  }
+  beginValue();
+  addHtml(isArray ? '[' : '{');
+  ++_level;
+  bitWrite(_isArray,     _level, isArray);
+  bitWrite(_hasElements, _level, false);
+  return true;
+}
+
+void JSON_StreamWriter::end()
+{
+  if (_level == 0) { return; }
+
+  if (bitRead(_isArray, _level)) {
+    addHtml(']', '\n');
+  } else {
+    addHtml('}');
+  }
+  --_level;
+  _afterKey = false;
+}
+
+void JSON_StreamWriter::key(const __FlashStringHelper *key)
+{
+  writeKey(key);
+}
+
+void JSON_StreamWriter::key(const String& key)
+{
+  nextElement();
+  writeQuoted(key);
+  addHtml(':');
+  _afterKey = true;
+}
+
+void JSON_StreamWriter::writeKey(const __FlashStringHelper *key)
+{
+  nextElement();
+  addHtml('"');
+  addHtml(key);
+  addHtml('"', ':');
+  _afterKey = true;
+}
+
+void JSON_StreamWriter::value(bool val)
+{
+  beginValue();
+  const bool quoted = !Settings.JSONBoolWithoutQuotes();
+
+  if (quoted) { addHtml('"'); }
+  addHtml(val ? F("true") : F("false"));
+
+  if (quoted) { addHtml('"'); }
+}
+
+void JSON_StreamWriter::value(int val)
+{
+  beginValue();
+  addHtmlInt(val);
+}
+
+#if defined(ESP32) && !defined(__riscv)
+void JSON_StreamWriter::value(int32_t val)
+{
+  beginValue();
+  addHtmlInt(val);
+}
+
+#endif // if defined(ESP32) && !defined(__riscv)
+
+void JSON_StreamWriter::value(uint32_t val)
+{
+  beginValue();
+  addHtmlInt(val);
+}
+
+#if defined(ESP32) && !defined(__riscv)
+void JSON_StreamWriter::value(size_t val)
+{
+  beginValue();
+  addHtmlInt(static_cast<uint32_t>(val));
+}
+
+#endif // if defined(ESP32) && !defined(__riscv)
+
+void JSON_StreamWriter::value(const __FlashStringHelper *val)
+{
+  value(String(val));
+}
+
+void JSON_StreamWriter::value(const String& val)
+{
+  beginValue();
+
+  // Same as to_json_value(), without creating a copy of the string
+  const size_t val_length = val.length();
+
+  if (val_length == 0) {
+    addHtml('"', '"');
+    return;
+  }
+
+  if (val_length > 2) {
+    // JSON objects or arrays are written as-is
+    const char firstchar = val[0];
+    const char lastchar  = val[val_length - 1];
+
+    if (((firstchar == '[') && (lastchar == ']')) ||
+        ((firstchar == '{') && (lastchar == '}')))
+    {
+      addHtml(val);
+      return;
+    }
+  }
+
+  if (mustConsiderAsJSONString(val)) {
+    writeQuoted(val);
+  } else {
+    // It is a numerical
+    addHtml(val);
+  }
+}
+
+void JSON_StreamWriter::nextElement()
+{
+  if (_level == 0) { return; }
+
+  if (bitRead(_hasElements, _level)) {
+    addHtml(',');
+  } else {
+    bitSet(_hasElements, _level);
+  }
+}
+
+void JSON_StreamWriter::beginValue()
+{
+  if (_afterKey) {
+    _afterKey = false;
+  } else {
+    nextElement();
+  }
+}
+
+void JSON_StreamWriter::writeQuoted(const String& val)
+{
+  addHtml('"');
+
+  const size_t val_length = val.length();
+
+  for (size_t i = 0; i < val_length; ++i) {
+    const char c = val[i];
+
+    switch (c) {
+      case '"':  addHtml('\\', '"');  break;
+      case '\\': addHtml('\\', '\\'); break;
+      case '\b': addHtml('\\', 'b');  break;
+      case '\f': addHtml('\\', 'f');  break;
+      case '\n': addHtml('\\', 'n');  break;
+      case '\r': addHtml('\\', 'r');  break;
+      case '\t': addHtml('\\', 't');  break;
+      default:
+
+        if (static_cast<uint8_t>(c) < 0x20) {
+          // Other control characters
+          const char hexDigits[] = "0123456789abcdef";
+          addHtml(F("\\u00"));
+          addHtml(hexDigits[c >> 4], hexDigits[c & 0x0F]);
+        } else {
+          addHtml(c);
+        }
+        break;
+    }
+  }
+  addHtml('"');
+}
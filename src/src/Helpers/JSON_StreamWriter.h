@@ -0,0 +1,96 @@
+#ifndef HELPERS_JSON_STREAMWRITER_H
+#define HELPERS_JSON_STREAMWRITER_H
+
+#include "../../ESPEasy_common.h"
+
+/********************************************************************************************\
+   JSON stream writer
+
+   Writes JSON directly to the web server TXBuffer, without allocating a writer object
+   per nesting level like KeyValueWriter_JSON does.
+   The state of each nesting level (object/array, has elements) is kept in a fixed size
+   bit stack, so no heap allocations are needed for nesting.
+
+   Level 0 is the context of the caller, e.g. an object already opened by a KeyValueWriter.
+   Separating commas on level 0 must be handled by the caller.
+
+   Values are formatted the same as KeyValueWriter_JSON does:
+   - String values which are numerical are not wrapped in quotes
+   - Bool values are wrapped in quotes, unless "JSON bool output without quotes" is set.
+   Unlike to_json_value(), quotes, backslashes and control characters in strings are
+   escaped (e.g. \" and \n), instead of being replaced by other characters.
+ \*********************************************************************************************/
+
+# define JSON_STREAM_MAX_LEVEL  32
+
+class JSON_StreamWriter
+{
+public:
+
+  JSON_StreamWriter() = default;
+
+  // Close all levels still open
+  ~JSON_StreamWriter();
+
+  // Open an object or array as array element, or on level 0.
+  // @retval false when the max. nesting level is reached, end() must not be called then.
+  bool beginObject();
+  bool beginArray();
+
+  // Open an object or array as member of the current object
+  bool beginObject(const __FlashStringHelper *key);
+  bool beginArray(const __FlashStringHelper *key);
+
+  // Close the last opened object or array
+  void end();
+
+  // Write the key of an object member, to be followed by a single value.
+  // May also be used to add a value with some other function, e.g. a complete JSON object.
+  void key(const __FlashStringHelper *key);
+  void key(const String& key);
+
+  // Write a value, either following a key, or as array element
+  void value(bool val);
+  void value(int val);
+# if defined(ESP32) && !defined(__riscv)
+  void value(int32_t val);
+# endif // if defined(ESP32) && !defined(__riscv)
+  void value(uint32_t val);
+# if defined(ESP32) && !defined(__riscv)
+  void value(size_t val);
+# endif // if defined(ESP32) && !defined(__riscv)
+  void value(const __FlashStringHelper *val);
+  void value(const String& val);
+
+  template<typename K, typename V>
+  void write(const K& k, const V& v) {
+    key(k);
+    value(v);
+  }
+
+  uint8_t getLevel() const {
+    return _level;
+  }
+
+private:
+
+  // Write the separating comma when needed
+  void nextElement();
+
+  // Prepare for writing a value or opening an object or array
+  void beginValue();
+
+  bool begin(bool isArray);
+
+  void writeKey(const __FlashStringHelper *key);
+
+  // Write String wrapped in quotes, with JSON escape sequences for characters not allowed in JSON strings
+  void writeQuoted(const String& val);
+
+  uint32_t _isArray{};
+  uint32_t _hasElements{};
+  uint8_t  _level{};
+  bool     _afterKey{};
+};
+
+#endif // ifndef HELPERS_JSON_STREAMWRITER_H
@@ -65,6 +65,11 @@ uint32_t LogHelper::getNrMessages(LogDestination logDestination) const
   return _logBuffer.getNrMessages(logDestination);
 }
 
+uint32_t LogHelper::getNrDropped(LogDestination logDestination) const
+{
+  return _logBuffer.getNrDropped(logDestination);
+}
+
 void LogHelper::loop()
 {
 #if FEATURE_SD
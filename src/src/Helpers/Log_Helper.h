@@ -21,6 +21,8 @@ public:
 
   uint32_t getNrMessages(LogDestination logDestination) const;
 
+  uint32_t getNrDropped(LogDestination logDestination) const;
+
   void     loop();
 
   bool     logActiveRead(LogDestination logDestination);
@@ -16,7 +16,7 @@
 #include "../Helpers/StringParser.h"
 
 #if FEATURE_SD
-# include <SD.h>
+# include "../Helpers/SD_ValueLogger.h"
 #endif // if FEATURE_SD
 
 
@@ -351,11 +351,22 @@ void SendValueLogger(taskIndex_t TaskIndex)
 {
 #if !defined(BUILD_NO_DEBUG) || FEATURE_SD
   bool   featureSD = false;
+  bool   binarySD  = false;
   String logger;
   # if FEATURE_SD
   featureSD = true;
+  binarySD  = Settings.ValueLoggerBinary();
   # endif // if FEATURE_SD
 
+  // CSV lines are only needed for the CSV value log and the debug log
+  bool csvLines = !binarySD;
+  # ifndef BUILD_NO_DEBUG
+
+  if (loglevelActiveFor(LOG_LEVEL_DEBUG)) {
+    csvLines = true;
+  }
+  # endif // ifndef BUILD_NO_DEBUG
+
   if (featureSD
       # ifndef BUILD_NO_DEBUG
       || loglevelActiveFor(LOG_LEVEL_DEBUG)
@@ -367,22 +378,32 @@ void SendValueLogger(taskIndex_t TaskIndex)
       const uint8_t valueCount = getValueCountForTask(TaskIndex);
       String taskName          = getTaskDeviceName(TaskIndex);
 
-      const String logline_prefix =
-        strformat(F("%s %s,%d,%s")
-                  , node_time.getDateString('-').c_str()
-                  , node_time.getTimeString(':').c_str()
-                  , Settings.Unit
-                  , taskName.c_str()
-                  );
+      String logline_prefix;
+
+      if (csvLines) {
+        logline_prefix =
+          strformat(F("%s %s,%d,%s")
+                    , node_time.getDateString('-').c_str()
+                    , node_time.getTimeString(':').c_str()
+                    , Settings.Unit
+                    , taskName.c_str()
+                    );
+
+        for (uint8_t varNr = 0; varNr < valueCount; varNr++)
+        {
+          logger += strformat(F("%s,%s,%s\r\n")
+                              , logline_prefix.c_str()
+                              , Cache.getTaskDeviceValueName(TaskIndex, varNr).c_str()
+                              , formatUserVarNoCheck(TaskIndex, varNr).c_str()
+                              );
+        }
+      }
+      # if FEATURE_SD
 
-      for (uint8_t varNr = 0; varNr < valueCount; varNr++)
-      {
-        logger += strformat(F("%s,%s,%s\r\n")
-                            , logline_prefix.c_str()
-                            , Cache.getTaskDeviceValueName(TaskIndex, varNr).c_str()
-                            , formatUserVarNoCheck(TaskIndex, varNr).c_str()
-                            );
+      if (binarySD) {
+        SD_ValueLogger_addValues(TaskIndex);
       }
+      # endif // if FEATURE_SD
       # if FEATURE_STRING_VARIABLES
 
       if (Settings.EventAndLogDerivedTaskValues(TaskIndex)) {
@@ -403,12 +424,21 @@ void SendValueLogger(taskIndex_t TaskIndex)
 
             if (!it->second.isEmpty()) {
               String value(it->second);
-              value   = parseTemplateAndCalculate(value);
-              logger += strformat(F("%s,%s,%s\r\n")
-                                  , logline_prefix.c_str()
-                                  , valueName.c_str()
-                                  , value.c_str()
-                                  );
+              value = parseTemplateAndCalculate(value);
+
+              if (csvLines) {
+                logger += strformat(F("%s,%s,%s\r\n")
+                                    , logline_prefix.c_str()
+                                    , valueName.c_str()
+                                    , value.c_str()
+                                    );
+              }
+              # if FEATURE_SD
+
+              if (binarySD) {
+                SD_ValueLogger_addStringValue(TaskIndex, valueName, value);
+              }
+              # endif // if FEATURE_SD
             }
           }
           else if (it->first.substring(0, search.length()).compareTo(search) > 0) {
@@ -427,14 +457,8 @@ void SendValueLogger(taskIndex_t TaskIndex)
 
 #if FEATURE_SD
 
-  if (!logger.isEmpty()) {
-    String   filename = patch_fname(F("VALUES.CSV"));
-    fs::File logFile  = SD.open(filename, "a+");
-
-    if (logFile) {
-      logFile.print(logger);
-    }
-    logFile.close();
+  if (!binarySD) {
+    SD_ValueLogger_add(logger);
   }
 #endif // if FEATURE_SD
 }
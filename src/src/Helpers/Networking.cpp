@@ -2013,10 +2013,7 @@ bool downloadFirmware(const String& url, String& file_save, String& user, String
         break;
       }
 
-      if (!UseRTOSMultitasking) {
-        // On ESP32 the schedule is executed on the 2nd core.
-        Scheduler.handle_schedule();
-      }
+      Scheduler.handle_schedule();
       backgroundtasks();
     }
   }
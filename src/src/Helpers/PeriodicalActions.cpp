@@ -29,6 +29,7 @@
 #include "../Helpers/Memory.h"
 #include "../Helpers/Misc.h"
 #include "../Helpers/Networking.h"
+#include "../Helpers/SD_ValueLogger.h"
 #include "../Helpers/StringGenerator_System.h"
 #include "../Helpers/StringGenerator_WiFi.h"
 #include "../Helpers/StringProvider.h"
@@ -233,6 +234,10 @@ void runOncePerSecond()
   getInternalTemperature(); // Just read the value every second to hopefully get a valid next reading on original ESP32
   #endif // if FEATURE_INTERNAL_TEMPERATURE && defined(ESP32_CLASSIC)
 
+  #if FEATURE_SD
+  SD_ValueLogger_loop();
+  #endif // if FEATURE_SD
+
   checkResetFactoryPin();
   STOP_TIMER(PLUGIN_CALL_1PS);
 }
@@ -571,6 +576,9 @@ void prepareShutdown(IntendedRebootReason_e reason)
   process_serialWriteBuffer();
   flushAndDisconnectAllClients();
   saveUserVarToRTC();
+#if FEATURE_SD
+  SD_ValueLogger_close();
+#endif // if FEATURE_SD
   CPluginCall(CPlugin::Function::CPLUGIN_EXIT_ALL, 0);
   ESPEasy::net::NWPluginCall(NWPlugin::Function::NWPLUGIN_EXIT_ALL, 0);
 //  ESPEasy::net::wifi::setWifiMode(WIFI_OFF);
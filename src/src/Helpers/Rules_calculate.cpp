@@ -90,6 +90,15 @@ bool RulesCalculate_t::is_quinary_operator(char c)
   return op == UnaryOperator::Map || op == UnaryOperator::MapC;
 }
 
+bool RulesCalculate_t::is_rpn_operator(char c)
+{
+  return is_operator(c) || is_unary_operator(c) ||
+         #if !defined(LIMIT_BUILD_SIZE) && FEATURE_TRIGONOMETRIC_FUNCTIONS_RULES
+         is_binary_operator(c) ||
+         #endif // if !defined(LIMIT_BUILD_SIZE) && FEATURE_TRIGONOMETRIC_FUNCTIONS_RULES
+         is_quinary_operator(c);
+}
+
 CalculateReturnCode RulesCalculate_t::push(ESPEASY_RULES_FLOAT_TYPE value)
 {
   if (sp != sp_max) // Full
@@ -339,42 +348,65 @@ ESPEASY_RULES_FLOAT_TYPE RulesCalculate_t::apply_quinary_operator(char op,
  */
 CalculateReturnCode RulesCalculate_t::RPNCalculate(char *token)
 {
-  CalculateReturnCode ret = CalculateReturnCode::OK;
-
   if (token[0] == 0) {
-    return ret; // Don't bother for an empty string
+    return CalculateReturnCode::OK; // Don't bother for an empty string
   }
 
-  if (is_operator(token[0]) && (token[1] == 0))
+  if (is_rpn_operator(token[0]) && (token[1] == 0))
+  {
+    #ifndef LIMIT_BUILD_SIZE
+    if (_program != nullptr) {
+      RPNRecord(token, 0);
+    }
+    #endif // ifndef LIMIT_BUILD_SIZE
+    return RPNApplyOperator(token[0]);
+  }
+
+  // Fetch next if there is any
+  ESPEASY_RULES_FLOAT_TYPE value{};
+  if (validDoubleFromString(token, value)) {
+
+  //   addLog(LOG_LEVEL_INFO, strformat(F("RPNCalculate push value: %.4f token: %s"), value, token));
+  // } else {
+  //   addLog(LOG_LEVEL_INFO, strformat(F("RPNCalculate unknown token: %s"), token));
+  }
+  #ifndef LIMIT_BUILD_SIZE
+  if (_program != nullptr) {
+    RPNRecord(token, value);
+  }
+  #endif // ifndef LIMIT_BUILD_SIZE
+
+  return push(value); // If it is a value, push to the stack
+}
+
+CalculateReturnCode RulesCalculate_t::RPNApplyOperator(char op)
+{
+  if (is_operator(op))
   {
     ESPEASY_RULES_FLOAT_TYPE second = pop();
     ESPEASY_RULES_FLOAT_TYPE first  = pop();
 
-    ret = push(apply_operator(token[0], first, second));
-    // addLog(LOG_LEVEL_INFO, strformat(F("RPNCalculate operator %c: 1: %.4f 2: %.4f"), token[0], first, second));
-
-// FIXME TD-er: Regardless whether it is an error, all code paths return ret;
-//    if (isError(ret)) { return ret; }
-  } else if (is_unary_operator(token[0]) && (token[1] == 0))
+    // addLog(LOG_LEVEL_INFO, strformat(F("RPNCalculate operator %c: 1: %.4f 2: %.4f"), op, first, second));
+    return push(apply_operator(op, first, second));
+  }
+  if (is_unary_operator(op))
   {
     ESPEASY_RULES_FLOAT_TYPE first = pop();
 
-    ret = push(apply_unary_operator(token[0], first));
-    // addLog(LOG_LEVEL_INFO, strformat(F("RPNCalculate unary %d: 1: %.4f"), token[0], first));
-
-// FIXME TD-er: Regardless whether it is an error, all code paths return ret;
-//    if (isError(ret)) { return ret; }
+    // addLog(LOG_LEVEL_INFO, strformat(F("RPNCalculate unary %d: 1: %.4f"), op, first));
+    return push(apply_unary_operator(op, first));
+  }
   #if !defined(LIMIT_BUILD_SIZE) && FEATURE_TRIGONOMETRIC_FUNCTIONS_RULES
-  } else if (is_binary_operator(token[0]) && (token[1] == 0))
+  if (is_binary_operator(op))
   {
     const ESPEASY_RULES_FLOAT_TYPE second = pop();
     const ESPEASY_RULES_FLOAT_TYPE first  = pop();
     
-    ret = push(apply_binary_operator(token[0], first, second));
-    // addLog(LOG_LEVEL_INFO, strformat(F("RPNCalculate binary %d: 1: %.4f 2: %.4f"), token[0], first, second));
-  
+    // addLog(LOG_LEVEL_INFO, strformat(F("RPNCalculate binary %d: 1: %.4f 2: %.4f"), op, first, second));
+    return push(apply_binary_operator(op, first, second));
+  }
   #endif // if !defined(LIMIT_BUILD_SIZE) && FEATURE_TRIGONOMETRIC_FUNCTIONS_RULES
-  } else if (is_quinary_operator(token[0]) && (token[1] == 0))
+  if (is_quinary_operator(op))
   {
     ESPEASY_RULES_FLOAT_TYPE fifth  = pop();
     ESPEASY_RULES_FLOAT_TYPE fourth = pop();
@@ -382,27 +414,42 @@ CalculateReturnCode RulesCalculate_t::RPNCalculate(char *token)
     ESPEASY_RULES_FLOAT_TYPE second = pop();
     ESPEASY_RULES_FLOAT_TYPE first  = pop();
 
-    ret = push(apply_quinary_operator(token[0], first, second, third, fourth, fifth));
-    // addLog(LOG_LEVEL_INFO, strformat(F("RPNCalculate quinary %d: 1: %.4f 2: %.4f 3: %.4f 4: %.4f 5: %.4f"), token[0], first, second, third, fourth, fifth));
+    // addLog(LOG_LEVEL_INFO, strformat(F("RPNCalculate quinary %d: 1: %.4f 2: %.4f 3: %.4f 4: %.4f 5: %.4f"), op, first, second, third, fourth, fifth));
+    return push(apply_quinary_operator(op, first, second, third, fourth, fifth));
+  }
+  return CalculateReturnCode::ERROR_BAD_OPERATOR;
+}
 
-  } else {
-    // Fetch next if there is any
-    ESPEASY_RULES_FLOAT_TYPE value{};
-    if (validDoubleFromString(token, value)) {
+#ifndef LIMIT_BUILD_SIZE
+void RulesCalculate_t::RPNRecord(const char *token, ESPEASY_RULES_FLOAT_TYPE value)
+{
+  RulesCalculate_instruction_t instruction;
 
-    //   addLog(LOG_LEVEL_INFO, strformat(F("RPNCalculate push value: %.4f token: %s"), value, token));
-    // } else {
-    //   addLog(LOG_LEVEL_INFO, strformat(F("RPNCalculate unknown token: %s"), token));
+  if (is_rpn_operator(token[0]) && (token[1] == 0)) {
+    instruction.type = RulesCalculate_instruction_t::Type::Operator;
+    instruction.op   = token[0];
+  } else {
+    const bool negative = token[0] == '-';
+
+    if (negative) { ++token; }
+
+    if (strcmp_P(token, PSTR(RULES_CALCULATE_VALUE_TOKEN)) == 0) {
+      instruction.type = negative
+        ? RulesCalculate_instruction_t::Type::NegValue
+        : RulesCalculate_instruction_t::Type::Value;
+    } else if (strcmp_P(token, PSTR(RULES_CALCULATE_PVALUE_TOKEN)) == 0) {
+      instruction.type = negative
+        ? RulesCalculate_instruction_t::Type::NegPrevValue
+        : RulesCalculate_instruction_t::Type::PrevValue;
+    } else {
+      instruction.constant = value;
     }
-    ret = push(value); // If it is a value, push to the stack
-
-// FIXME TD-er: Regardless whether it is an error, all code paths return ret;
-//    if (isError(ret)) { return ret; }
   }
-
-  return ret;
+  _program->push_back(instruction);
 }
 
+#endif // ifndef LIMIT_BUILD_SIZE
+
 // operators
 // precedence   operators         associativity
 // 4            !                 right to left
@@ -709,6 +756,66 @@ CalculateReturnCode RulesCalculate_t::doCalculate(const char *input, ESPEASY_RUL
   return CalculateReturnCode::OK;
 }
 
+#ifndef LIMIT_BUILD_SIZE
+bool RulesCalculate_t::compile(const String& preprocessed_formula, RulesCalculate_program_t& program)
+{
+  program.clear();
+
+  String input(preprocessed_formula);
+
+  input.replace(F("%value%"),  F(RULES_CALCULATE_VALUE_TOKEN));
+  input.replace(F("%pvalue%"), F(RULES_CALCULATE_PVALUE_TOKEN));
+
+  // Anything else needs parseTemplate() or string handling
+  for (const char c : { '%', '[', '{', '"', '$', '\\' }) {
+    if (input.indexOf(c) != -1) {
+      return false;
+    }
+  }
+
+  ESPEASY_RULES_FLOAT_TYPE result{};
+
+  _program = &program;
+  const CalculateReturnCode returnCode = doCalculate(input.c_str(), &result);
+  _program = nullptr;
+
+  if (isError(returnCode) || (sp == (globalstack - 1))) {
+    program.clear();
+    return false;
+  }
+  program.shrink_to_fit();
+  return true;
+}
+
+CalculateReturnCode RulesCalculate_t::evaluate(const RulesCalculate_program_t& program,
+                                               ESPEASY_RULES_FLOAT_TYPE        value,
+                                               ESPEASY_RULES_FLOAT_TYPE        pvalue,
+                                               ESPEASY_RULES_FLOAT_TYPE      & result)
+{
+  sp = globalstack - 1;
+
+  // Stack usage does not depend on the values, so any error would already have been seen while compiling.
+  for (auto it = program.begin(); it != program.end(); ++it) {
+    switch (it->type) {
+      case RulesCalculate_instruction_t::Type::Constant:     push(it->constant); break;
+      case RulesCalculate_instruction_t::Type::Value:        push(value);        break;
+      case RulesCalculate_instruction_t::Type::NegValue:     push(-value);       break;
+      case RulesCalculate_instruction_t::Type::PrevValue:    push(pvalue);       break;
+      case RulesCalculate_instruction_t::Type::NegPrevValue: push(-pvalue);      break;
+      case RulesCalculate_instruction_t::Type::Operator:     RPNApplyOperator(it->op); break;
+    }
+  }
+
+  if (sp == (globalstack - 1)) {
+    result = 0;
+    return CalculateReturnCode::ERROR_STACK_OVERFLOW;
+  }
+  result = *sp;
+  return CalculateReturnCode::OK;
+}
+
+#endif // ifndef LIMIT_BUILD_SIZE
+
 void preProcessReplace(String& input, UnaryOperator op) {
   String find = toString(op);
 
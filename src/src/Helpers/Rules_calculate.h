@@ -4,6 +4,8 @@
 
 #include "../../ESPEasy_common.h"
 
+#include <vector>
+
 /********************************************************************************************\
    Calculate function for simple expressions
  \*********************************************************************************************/
@@ -76,6 +78,37 @@ bool   angleDegree(BinaryOperator op);
 const __FlashStringHelper* toString(BinaryOperator op);
 #endif // if !defined(LIMIT_BUILD_SIZE) && FEATURE_TRIGONOMETRIC_FUNCTIONS_RULES
 
+#ifndef LIMIT_BUILD_SIZE
+
+/********************************************************************************************\
+   Compiled formula
+   The sequence of RPN tokens as processed by doCalculate(), with %value% and %pvalue%
+   kept as references. Evaluating it does not need any string formatting or parsing.
+ \*********************************************************************************************/
+
+// Placeholders for %value% and %pvalue% while compiling.
+// Parsed as a single (hex) number token by doCalculate()
+# define RULES_CALCULATE_VALUE_TOKEN  "0x7FFFFF01"
+# define RULES_CALCULATE_PVALUE_TOKEN "0x7FFFFF02"
+
+struct RulesCalculate_instruction_t {
+  enum class Type : uint8_t {
+    Constant,
+    Value,
+    NegValue,
+    PrevValue,
+    NegPrevValue,
+    Operator
+  };
+
+  ESPEASY_RULES_FLOAT_TYPE constant{};
+  Type                     type = Type::Constant;
+  char                     op{};
+};
+
+typedef std::vector<RulesCalculate_instruction_t> RulesCalculate_program_t;
+#endif // ifndef LIMIT_BUILD_SIZE
+
 class RulesCalculate_t {
 private:
 
@@ -100,6 +133,9 @@ private:
 
   bool                is_quinary_operator(char c);
 
+  // Any operator which can be processed as a single character RPN token
+  bool                is_rpn_operator(char c);
+
   CalculateReturnCode push(ESPEASY_RULES_FLOAT_TYPE value);
 
   ESPEASY_RULES_FLOAT_TYPE              pop();
@@ -128,6 +164,17 @@ private:
 
   CalculateReturnCode RPNCalculate(char *token);
 
+  CalculateReturnCode RPNApplyOperator(char op);
+
+  #ifndef LIMIT_BUILD_SIZE
+
+  // Append processed token to the program being compiled
+  void RPNRecord(const char *token,
+                 ESPEASY_RULES_FLOAT_TYPE value);
+
+  RulesCalculate_program_t *_program = nullptr;
+  #endif // ifndef LIMIT_BUILD_SIZE
+
   // operators
   // precedence   operators         associativity
   // 4            !                 right to left
@@ -150,6 +197,21 @@ public:
   // Try to replace multi byte operators with single character ones.
   // For example log, sin, cos, tan.
   static String preProces(const String& input);
+
+  #ifndef LIMIT_BUILD_SIZE
+
+  // Compile a preprocessed formula which may contain %value% and %pvalue%.
+  // @retval false when the formula needs parseTemplate(), e.g. it refers to variables or other task values,
+  //               or uses the modulo operator.
+  bool compile(const String            & preprocessed_formula,
+               RulesCalculate_program_t& program);
+
+  // Evaluate a compiled formula, yields the same result as doCalculate() on the formula with values filled in.
+  CalculateReturnCode evaluate(const RulesCalculate_program_t& program,
+                               ESPEASY_RULES_FLOAT_TYPE        value,
+                               ESPEASY_RULES_FLOAT_TYPE        pvalue,
+                               ESPEASY_RULES_FLOAT_TYPE      & result);
+  #endif // ifndef LIMIT_BUILD_SIZE
 };
 
 
@@ -0,0 +1,409 @@
+#include "../Helpers/SD_ValueLogger.h"
+
+#if FEATURE_SD
+
+# include "../../_Plugin_Helper.h"
+# include "../DataStructs/TimingStats.h"
+# include "../ESPEasyCore/ESPEasy_Log.h"
+# include "../Globals/Cache.h"
+# include "../Globals/ESPEasy_time.h"
+# include "../Globals/RuntimeData.h"
+# include "../Globals/Settings.h"
+# include "../Helpers/ESPEasy_Storage.h"
+# include "../Helpers/ESPEasy_time_calc.h"
+# include "../Helpers/Misc.h"
+# include "../Helpers/StringConverter.h"
+
+# include <SD.h>
+
+String   SD_ValueLogger_buffer;
+fs::File SD_ValueLogger_file;
+uint32_t SD_ValueLogger_firstBuffered = 0;
+
+// Format of the buffered data and the open file
+bool SD_ValueLogger_binary = false;
+
+// Checksum of the task definition written to the current binary file, 0 = not yet written
+uint32_t SD_ValueLogger_taskDef[TASKS_MAX]{};
+
+# ifdef ESP32
+
+// Date and time the current file was started, as used in the name of the rotated file
+String  SD_ValueLogger_fileStart;
+uint8_t SD_ValueLogger_fileDay = 0;
+
+// Last nr used in the name of a rotated file without start time
+uint32_t SD_ValueLogger_fileNr = 0;
+# endif // ifdef ESP32
+
+const __FlashStringHelper* SD_ValueLogger_extension()
+{
+  return SD_ValueLogger_binary ? F(".BIN") : F(".CSV");
+}
+
+bool SD_ValueLogger_open()
+{
+  if (SD_ValueLogger_file) {
+    return true;
+  }
+  SD_ValueLogger_file = SD.open(patch_fname(concat(F("VALUES"), SD_ValueLogger_extension())), "a+");
+
+  if (!SD_ValueLogger_file) {
+    return false;
+  }
+
+  if (SD_ValueLogger_binary && (SD_ValueLogger_file.size() == 0)) {
+    const uint8_t header[] = { 'E', 'S', 'P', 'V', 'L', 1, 0, 0 };
+    SD_ValueLogger_file.write(header, sizeof(header));
+  }
+
+  # ifdef ESP32
+
+  if (node_time.systemTimePresent()) {
+    SD_ValueLogger_fileStart = strformat(
+      F("%04d%02d%02d_%02d%02d%02d"),
+      node_time.year(), node_time.month(), node_time.day(),
+      node_time.hour(), node_time.minute(), node_time.second());
+    SD_ValueLogger_fileDay = node_time.day();
+  } else {
+    // Not the start of a previous file
+    SD_ValueLogger_fileStart.clear();
+  }
+  # endif // ifdef ESP32
+  return true;
+}
+
+void SD_ValueLogger_closeFile()
+{
+  if (SD_ValueLogger_file) {
+    SD_ValueLogger_file.close();
+  }
+
+  // The next file needs the task definitions again
+  memset(SD_ValueLogger_taskDef, 0, sizeof(SD_ValueLogger_taskDef));
+}
+
+# ifdef ESP32
+
+// VALUES_<yyyymmdd>_<hhmmss>, or VALUES_N<nr> when the start time of the file is not known
+// (system time not set) or a file with that name already exists.
+String SD_ValueLogger_rotatedName()
+{
+  String fname;
+
+  if (!SD_ValueLogger_fileStart.isEmpty()) {
+    fname = patch_fname(concat(F("VALUES_"), SD_ValueLogger_fileStart) + SD_ValueLogger_extension());
+
+    if (!SD.exists(fname)) {
+      return fname;
+    }
+  }
+
+  do {
+    ++SD_ValueLogger_fileNr;
+    fname = patch_fname(strformat(F("VALUES_N%u%s"), SD_ValueLogger_fileNr, String(SD_ValueLogger_extension()).c_str()));
+  } while (SD.exists(fname));
+  return fname;
+}
+
+void SD_ValueLogger_rotate()
+{
+  SD_ValueLogger_closeFile();
+
+  const String fname   = patch_fname(concat(F("VALUES"), SD_ValueLogger_extension()));
+  const String rotated = SD_ValueLogger_rotatedName();
+
+  if (!SD.rename(fname, rotated)) {
+    addLog(LOG_LEVEL_ERROR, strformat(F("SD   : Could not rename %s to %s"), fname.c_str(), rotated.c_str()));
+  }
+  SD_ValueLogger_fileStart.clear();
+}
+
+# endif // ifdef ESP32
+
+void SD_ValueLogger_setFormat(bool binary)
+{
+  if (binary != SD_ValueLogger_binary) {
+    // Buffered data must be written in the file of its own format
+    SD_ValueLogger_flush();
+    SD_ValueLogger_closeFile();
+    SD_ValueLogger_binary = binary;
+  }
+}
+
+void SD_ValueLogger_addToBuffer(const char *data, size_t length)
+{
+  if (length == 0) { return; }
+
+  if (SD_ValueLogger_buffer.isEmpty()) {
+    SD_ValueLogger_firstBuffered = millis();
+    SD_ValueLogger_buffer.reserve(SD_VALUELOGGER_BUFFER_SIZE + 256);
+  }
+  SD_ValueLogger_buffer.concat(data, length);
+}
+
+void SD_ValueLogger_flushWhenFull()
+{
+  if (SD_ValueLogger_buffer.length() >= SD_VALUELOGGER_BUFFER_SIZE) {
+    SD_ValueLogger_flush();
+  }
+}
+
+void SD_ValueLogger_add(const String& lines)
+{
+  if (lines.isEmpty()) { return; }
+  SD_ValueLogger_setFormat(false);
+  SD_ValueLogger_addToBuffer(lines.c_str(), lines.length());
+  SD_ValueLogger_flushWhenFull();
+}
+
+/********************************************************************************************\
+   Binary format
+   Numbers are written in the byte order of the ESP, which is little endian.
+ \*********************************************************************************************/
+void SD_ValueLogger_append(String& str, const void *data, size_t size)
+{
+  str.concat(reinterpret_cast<const char *>(data), size);
+}
+
+void SD_ValueLogger_appendByte(String& str, uint8_t value)
+{
+  SD_ValueLogger_append(str, &value, sizeof(value));
+}
+
+void SD_ValueLogger_appendString(String& str, const String& value)
+{
+  const uint8_t length = value.length() > 255 ? 255 : value.length();
+
+  SD_ValueLogger_appendByte(str, length);
+  SD_ValueLogger_append(str, value.c_str(), length);
+}
+
+// Task nr and time of the record
+void SD_ValueLogger_appendTaskAndTime(String& str, taskIndex_t TaskIndex)
+{
+  uint32_t unix_time_frac{};
+  const uint32_t unix_time = node_time.getUnixTime(unix_time_frac);
+  const uint16_t msec      = unix_time_frac_to_millis(unix_time_frac);
+
+  SD_ValueLogger_appendByte(str, TaskIndex + 1);
+  SD_ValueLogger_append(str, &unix_time, sizeof(unix_time));
+  SD_ValueLogger_append(str, &msec,      sizeof(msec));
+}
+
+void SD_ValueLogger_addRecord(char type, const String& payload)
+{
+  const uint16_t length = payload.length();
+  char header[3];
+
+  header[0] = type;
+  memcpy(&header[1], &length, sizeof(length));
+
+  SD_ValueLogger_addToBuffer(header, sizeof(header));
+  SD_ValueLogger_addToBuffer(payload.c_str(), length);
+}
+
+char SD_ValueLogger_valueType(Sensor_VType sensorType)
+{
+  if ((sensorType == Sensor_VType::SENSOR_TYPE_ULONG) || isUInt32OutputDataType(sensorType)) { return 'u'; }
+
+  if (isFloatOutputDataType(sensorType)) { return 'f'; }
+# if FEATURE_EXTENDED_TASK_VALUE_TYPES
+
+  if (isInt32OutputDataType(sensorType)) { return 'i'; }
+
+  if (isUInt64OutputDataType(sensorType)) { return 'q'; }
+
+  if (isInt64OutputDataType(sensorType)) { return 'l'; }
+#  if FEATURE_USE_DOUBLE_AS_ESPEASY_RULES_FLOAT_TYPE
+
+  if (isDoubleOutputDataType(sensorType)) { return 'd'; }
+#  endif // if FEATURE_USE_DOUBLE_AS_ESPEASY_RULES_FLOAT_TYPE
+# endif  // if FEATURE_EXTENDED_TASK_VALUE_TYPES
+  return 'n';
+}
+
+void SD_ValueLogger_appendValue(String& str, taskIndex_t TaskIndex, taskVarIndex_t varNr, Sensor_VType sensorType, char valueType)
+{
+  switch (valueType) {
+    case 'u':
+    {
+      const uint32_t value = (sensorType == Sensor_VType::SENSOR_TYPE_ULONG)
+                             ? UserVar.getSensorTypeLong(TaskIndex)
+                             : UserVar.getUint32(TaskIndex, varNr);
+      SD_ValueLogger_append(str, &value, sizeof(value));
+      break;
+    }
+    case 'f':
+    {
+      const float value = UserVar.getFloat(TaskIndex, varNr);
+      SD_ValueLogger_append(str, &value, sizeof(value));
+      break;
+    }
+# if FEATURE_EXTENDED_TASK_VALUE_TYPES
+    case 'i':
+    {
+      const int32_t value = UserVar.getInt32(TaskIndex, varNr);
+      SD_ValueLogger_append(str, &value, sizeof(value));
+      break;
+    }
+    case 'q':
+    {
+      const uint64_t value = UserVar.getUint64(TaskIndex, varNr);
+      SD_ValueLogger_append(str, &value, sizeof(value));
+      break;
+    }
+    case 'l':
+    {
+      const int64_t value = UserVar.getInt64(TaskIndex, varNr);
+      SD_ValueLogger_append(str, &value, sizeof(value));
+      break;
+    }
+#  if FEATURE_USE_DOUBLE_AS_ESPEASY_RULES_FLOAT_TYPE
+    case 'd':
+    {
+      const double value = UserVar.getDouble(TaskIndex, varNr);
+      SD_ValueLogger_append(str, &value, sizeof(value));
+      break;
+    }
+#  endif // if FEATURE_USE_DOUBLE_AS_ESPEASY_RULES_FLOAT_TYPE
+# endif  // if FEATURE_EXTENDED_TASK_VALUE_TYPES
+  }
+}
+
+// FNV-1a, never 0
+uint32_t SD_ValueLogger_checksum(const String& str)
+{
+  uint32_t hash = 2166136261u;
+
+  for (size_t i = 0; i < str.length(); ++i) {
+    hash ^= static_cast<uint8_t>(str[i]);
+    hash *= 16777619u;
+  }
+  return hash | 1;
+}
+
+void SD_ValueLogger_addValues(taskIndex_t TaskIndex)
+{
+  if (!validTaskIndex(TaskIndex)) { return; }
+  SD_ValueLogger_setFormat(true);
+
+  struct EventStruct TempEvent(TaskIndex);
+  const Sensor_VType sensorType = TempEvent.getSensorType();
+  const uint8_t valueCount      = getValueCountForTask(TaskIndex);
+  const char    valueType       = SD_ValueLogger_valueType(sensorType);
+
+  String definition;
+
+  SD_ValueLogger_appendByte(definition, TaskIndex + 1);
+  SD_ValueLogger_appendByte(definition, Settings.Unit);
+  SD_ValueLogger_appendByte(definition, valueCount);
+  SD_ValueLogger_appendString(definition, getTaskDeviceName(TaskIndex));
+
+  for (uint8_t varNr = 0; varNr < valueCount; ++varNr) {
+    SD_ValueLogger_appendByte(definition, valueType);
+    SD_ValueLogger_appendByte(definition, Cache.getTaskDeviceValueDecimals(TaskIndex, varNr));
+    SD_ValueLogger_appendString(definition, Cache.getTaskDeviceValueName(TaskIndex, varNr));
+  }
+  const uint32_t checksum = SD_ValueLogger_checksum(definition);
+
+  if (SD_ValueLogger_taskDef[TaskIndex] != checksum) {
+    SD_ValueLogger_addRecord('D', definition);
+    SD_ValueLogger_taskDef[TaskIndex] = checksum;
+  }
+
+  String values;
+
+  SD_ValueLogger_appendTaskAndTime(values, TaskIndex);
+
+  for (uint8_t varNr = 0; varNr < valueCount; ++varNr) {
+    SD_ValueLogger_appendValue(values, TaskIndex, varNr, sensorType, valueType);
+  }
+  SD_ValueLogger_addRecord('V', values);
+  SD_ValueLogger_flushWhenFull();
+}
+
+void SD_ValueLogger_addStringValue(taskIndex_t TaskIndex, const String& valueName, const String& value)
+{
+  // Only log after the task definition, as it holds the task name
+  if (!validTaskIndex(TaskIndex) || !SD_ValueLogger_binary || (SD_ValueLogger_taskDef[TaskIndex] == 0)) { return; }
+
+  String record;
+
+  SD_ValueLogger_appendTaskAndTime(record, TaskIndex);
+  SD_ValueLogger_appendString(record, valueName);
+
+  const uint16_t length = value.length();
+
+  SD_ValueLogger_append(record, &length, sizeof(length));
+  SD_ValueLogger_append(record, value.c_str(), length);
+
+  SD_ValueLogger_addRecord('S', record);
+  SD_ValueLogger_flushWhenFull();
+}
+
+void SD_ValueLogger_loop()
+{
+  if (!SD_ValueLogger_buffer.isEmpty() &&
+      (timePassedSince(SD_ValueLogger_firstBuffered) >= SD_VALUELOGGER_FLUSH_INTERVAL)) {
+    SD_ValueLogger_flush();
+  }
+
+  # ifdef ESP32
+
+  if (SD_ValueLogger_file && node_time.systemTimePresent()) {
+    if (SD_ValueLogger_fileStart.isEmpty()) {
+      // Time was not yet set when the file was opened, thus the file start is unknown.
+      SD_ValueLogger_closeFile();
+    } else if (SD_ValueLogger_fileDay != node_time.day()) {
+      SD_ValueLogger_flush();
+      SD_ValueLogger_rotate();
+    }
+  }
+  # endif // ifdef ESP32
+}
+
+void SD_ValueLogger_flush()
+{
+  if (SD_ValueLogger_buffer.isEmpty()) { return; }
+  START_TIMER;
+
+  if (SD_ValueLogger_open()) {
+    SD_ValueLogger_file.write(
+      reinterpret_cast<const uint8_t *>(SD_ValueLogger_buffer.c_str()),
+      SD_ValueLogger_buffer.length());
+    SD_ValueLogger_file.flush();
+  } else {
+    addLog(LOG_LEVEL_ERROR, strformat(
+             F("SD   : Could not open VALUES%s, lost bytes: %u"),
+             String(SD_ValueLogger_extension()).c_str(),
+             SD_ValueLogger_buffer.length()));
+
+    // Task definitions may have been lost
+    SD_ValueLogger_closeFile();
+  }
+
+  // Keep the allocated buffer
+  SD_ValueLogger_buffer.clear();
+  STOP_TIMER(SD_VALUELOGGER_FLUSH);
+
+  # ifdef ESP32
+
+  if (SD_ValueLogger_file && (SD_ValueLogger_file.size() >= SD_VALUELOGGER_MAX_FILE_SIZE)) {
+    SD_ValueLogger_rotate();
+  }
+  # endif // ifdef ESP32
+}
+
+void SD_ValueLogger_close()
+{
+  SD_ValueLogger_flush();
+  SD_ValueLogger_closeFile();
+}
+
+size_t SD_ValueLogger_bufferedBytes()
+{
+  return SD_ValueLogger_buffer.length();
+}
+
+#endif // if FEATURE_SD
@@ -0,0 +1,77 @@
+#ifndef HELPERS_SD_VALUELOGGER_H
+#define HELPERS_SD_VALUELOGGER_H
+
+#include "../../ESPEasy_common.h"
+
+#if FEATURE_SD
+
+# include "../DataTypes/TaskIndex.h"
+
+/********************************************************************************************\
+   SD card value logger
+
+   Log lines of sendData() are collected in RAM and written to VALUES.CSV on the SD card
+   when enough data is buffered, or the oldest line has been buffered for some time.
+   The file is kept open between writes.
+
+   On ESP32, VALUES.CSV is renamed to VALUES_<yyyymmdd>_<hhmmss>.CSV (time the file was started)
+   when the date changes or the file size exceeds SD_VALUELOGGER_MAX_FILE_SIZE.
+   When the system time was not set at the start of the file, it is renamed to VALUES_N<nr>.CSV
+   when it exceeds the max. size, using the first free nr.
+
+   Binary format, written to VALUES.BIN (and rotated like VALUES.CSV)
+   Use tools/espeasyvaluelog to convert to CSV.
+   All numbers are little endian.
+   - File header: "ESPVL", format version (1), 2 reserved bytes.
+   - Records: type (1 byte), payload length (uint16), payload.
+     Unknown record types can be skipped using the payload length.
+     'D' Task definition, written before the first values of a task in each file and when it changed:
+         task nr, unit nr, nr of values, task name, per value: value type, nr of decimals, value name
+     'V' Task values:
+         task nr, unix time (uint32, UTC), msec (uint16), the values of the types in the task definition
+     'S' String value (derived task values):
+         task nr, unix time (uint32, UTC), msec (uint16), value name, value (with uint16 length)
+     Strings are prefixed by their length (uint8), unless stated otherwise.
+     Value types: 'f' float, 'd' double, 'i' int32, 'u' uint32, 'l' int64, 'q' uint64, 'n' no value.
+ \*********************************************************************************************/
+
+// Write buffered lines when at least this nr of bytes is buffered.
+# ifndef SD_VALUELOGGER_BUFFER_SIZE
+#  define SD_VALUELOGGER_BUFFER_SIZE     2048
+# endif // ifndef SD_VALUELOGGER_BUFFER_SIZE
+
+// Max. time in msec a line is kept in the buffer.
+# ifndef SD_VALUELOGGER_FLUSH_INTERVAL
+#  define SD_VALUELOGGER_FLUSH_INTERVAL  10000
+# endif // ifndef SD_VALUELOGGER_FLUSH_INTERVAL
+
+// Start a new file when the current file exceeds this size.
+# ifndef SD_VALUELOGGER_MAX_FILE_SIZE
+#  define SD_VALUELOGGER_MAX_FILE_SIZE   (1024 * 1024)
+# endif // ifndef SD_VALUELOGGER_MAX_FILE_SIZE
+
+// Add CSV lines
+void   SD_ValueLogger_add(const String& lines);
+
+// Add the task values in binary format
+void   SD_ValueLogger_addValues(taskIndex_t TaskIndex);
+
+// Add a derived task value in binary format
+void   SD_ValueLogger_addStringValue(taskIndex_t   TaskIndex,
+                                     const String& valueName,
+                                     const String& value);
+
+// Flush the buffer when it is too old and check whether the file must be rotated.
+// To be called once per second.
+void   SD_ValueLogger_loop();
+
+void   SD_ValueLogger_flush();
+
+// Flush the buffer and close the file, e.g. before reboot.
+void   SD_ValueLogger_close();
+
+size_t SD_ValueLogger_bufferedBytes();
+
+#endif // if FEATURE_SD
+
+#endif // ifndef HELPERS_SD_VALUELOGGER_H
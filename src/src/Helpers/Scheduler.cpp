@@ -79,7 +79,11 @@ void ESPEasy_Scheduler::handle_schedule() {
       process_rules_timer(timerID, timer);
       break;
     case SchedulerTimerType_e::TaskDeviceTimer:
+#if FEATURE_I2C_BUS_SCHEDULER
+      process_task_device_timer_batch(timerID, timer);
+#else // if FEATURE_I2C_BUS_SCHEDULER
       process_task_device_timer(timerID, timer);
+#endif // if FEATURE_I2C_BUS_SCHEDULER
       break;
     case SchedulerTimerType_e::GPIO_timer:
       process_gpio_timer(timerID, timer);
@@ -251,6 +251,14 @@ void                 setPluginTaskTimer(unsigned long msecFromNow,
   void process_task_device_timer(SchedulerTimerID timerID,
                                  unsigned long lasttimer);
 
+#if FEATURE_I2C_BUS_SCHEDULER
+
+  // Process the task device timer and all other task device timers which are due,
+  // in their scheduled order, as a single I2C batch.
+  void process_task_device_timer_batch(SchedulerTimerID timerID,
+                                       unsigned long    lasttimer);
+#endif // if FEATURE_I2C_BUS_SCHEDULER
+
   /*********************************************************************************************\
   * System Event Timer
   * Handling of these events will be asynchronous and being called from the loop().
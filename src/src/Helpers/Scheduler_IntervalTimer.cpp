@@ -160,12 +160,7 @@ void ESPEasy_Scheduler::process_interval_timer(SchedulerTimerID timerID, unsigne
 
   switch (intervalTimer) {
     case SchedulerIntervalTimer_e::TIMER_20MSEC:         run50TimesPerSecond(); break;
-    case SchedulerIntervalTimer_e::TIMER_100MSEC:
-
-      if (!UseRTOSMultitasking) {
-        run10TimesPerSecond();
-      }
-      break;
+    case SchedulerIntervalTimer_e::TIMER_100MSEC:        run10TimesPerSecond(); break;
     case SchedulerIntervalTimer_e::TIMER_1SEC:             runOncePerSecond();      break;
     case SchedulerIntervalTimer_e::TIMER_30SEC:            runEach30Seconds();      break;
     case SchedulerIntervalTimer_e::TIMER_MQTT:
@@ -6,6 +6,8 @@
 #include "../ESPEasyCore/Controller.h"
 #include "../Globals/Settings.h"
 #include "../Helpers/DeepSleep.h"
+#include "../Helpers/ESPEasy_time_calc.h"
+#include "../Helpers/I2C_BusScheduler.h"
 
 /*********************************************************************************************\
 * Task Device Timer
@@ -75,7 +77,19 @@ void ESPEasy_Scheduler::reschedule_task_device_timer(unsigned long task_index, u
   unsigned long newtimer = Settings.TaskDeviceTimer[task_index];
 
   if (newtimer != 0) {
-    newtimer = lasttimer + (newtimer * 1000);
+    const unsigned long interval = newtimer * 1000;
+
+    newtimer = lasttimer + interval;
+
+    if (Settings.AlignTaskReads()) {
+      // Round down to a multiple of the interval, so all tasks with the same interval
+      // (or a multiple of it) are scheduled at the same moment and read back to back.
+      newtimer -= (newtimer % interval);
+
+      if (timeDiff(lasttimer, newtimer) <= 0) {
+        newtimer += interval;
+      }
+    }
     schedule_task_device_timer(task_index, newtimer);
   }
 }
@@ -88,3 +102,27 @@ void ESPEasy_Scheduler::process_task_device_timer(SchedulerTimerID timerID, unsi
   struct EventStruct TempEvent(task_index);
   SensorSendTask(&TempEvent, 0, lasttimer);
 }
+
+#if FEATURE_I2C_BUS_SCHEDULER
+void ESPEasy_Scheduler::process_task_device_timer_batch(SchedulerTimerID timerID, unsigned long lasttimer) {
+  // Tasks are still read in the order they are scheduled, so the order of the events is not changed.
+  // Consecutive I2C tasks using the same bus, multiplexer channel and clock speed
+  // (e.g. when Settings.AlignTaskReads() is set) skip resetting the bus state in between.
+  I2C_beginBatch();
+  process_task_device_timer(timerID, lasttimer);
+
+  // Limit the batch size, as a task may reschedule itself immediately.
+  for (taskIndex_t i = 1; i < TASKS_MAX; ++i) {
+    const SchedulerTimerID nextID(msecTimerHandler.peekNextId());
+
+    if ((nextID.mixed_id == 0) || (nextID.getTimerType() != SchedulerTimerType_e::TaskDeviceTimer)) {
+      break;
+    }
+    unsigned long timer = 0;
+    msecTimerHandler.getNextId(timer);
+    process_task_device_timer(nextID, timer);
+  }
+  I2C_endBatch();
+}
+
+#endif // if FEATURE_I2C_BUS_SCHEDULER
@@ -0,0 +1,286 @@
+#include "../Helpers/SerialFrameReader.h"
+
+#if FEATURE_SERIAL_FRAME_READER
+
+# include "../Helpers/ESPEasy_time_calc.h"
+
+
+SerialFrameReader::SerialFrameReader(uint16_t bufferSize)
+{
+  _buffer = new (std::nothrow) uint8_t[bufferSize];
+
+  if (_buffer != nullptr) {
+    _bufferSize = bufferSize;
+  }
+}
+
+SerialFrameReader::~SerialFrameReader()
+{
+  delete[] _buffer;
+  _buffer = nullptr;
+}
+
+SerialFrameReader * SerialFrameReader::create(uint16_t bufferSize)
+{
+  SerialFrameReader *reader = new (std::nothrow) SerialFrameReader(bufferSize);
+
+  if ((reader != nullptr) && !reader->isInitialized()) {
+    delete reader;
+    reader = nullptr;
+  }
+  return reader;
+}
+
+void SerialFrameReader::setDelimiter(uint8_t delimiter)
+{
+  _framing   = Framing::Delimiter;
+  _delimiter = delimiter;
+  _scanPos   = 0;
+}
+
+void SerialFrameReader::setFixedLength(uint16_t length)
+{
+  _framing     = Framing::FixedLength;
+  _fixedLength = length;
+}
+
+void SerialFrameReader::setLengthPrefixed(uint8_t lengthOffset,
+                                          uint8_t lengthSize,
+                                          int8_t  lengthAdjust,
+                                          bool    bigEndian)
+{
+  _framing         = Framing::LengthPrefixed;
+  _lengthOffset    = lengthOffset;
+  _lengthSize      = (lengthSize == 2) ? 2 : 1;
+  _lengthAdjust    = lengthAdjust;
+  _lengthBigEndian = bigEndian;
+}
+
+void SerialFrameReader::setTimeout(uint16_t timeout_msec)
+{
+  _framing      = Framing::Timeout;
+  _timeout_msec = timeout_msec;
+}
+
+size_t SerialFrameReader::fill(ESPeasySerial& serial)
+{
+  if (!isInitialized()) { return 0; }
+
+  compact();
+
+  size_t total = 0;
+  int    available;
+
+  while ((available = serial.available()) > 0 && _writePos < _bufferSize) {
+    size_t toRead = _bufferSize - _writePos;
+
+    if (static_cast<size_t>(available) < toRead) {
+      toRead = available;
+    }
+    const int bytesRead = serial.read(&_buffer[_writePos], toRead);
+
+    if (bytesRead <= 0) { break; }
+
+    if (_skipByte >= 0) {
+      // Filter in place, only the new data has to be checked
+      const uint8_t *src = &_buffer[_writePos];
+      uint8_t *dst       = &_buffer[_writePos];
+
+      for (int i = 0; i < bytesRead; ++i, ++src) {
+        if (*src != _skipByte) {
+          *dst = *src;
+          ++dst;
+        }
+      }
+      _writePos = dst - _buffer;
+    } else {
+      _writePos += bytesRead;
+    }
+    total += bytesRead;
+  }
+
+  if (total > 0) {
+    _stats.bytesReceived += total;
+    _lastReceived         = millis();
+  }
+  return total;
+}
+
+bool SerialFrameReader::getFrame(const uint8_t *& frame, size_t& length)
+{
+  _frameConsumeLength = 0;
+
+  const uint16_t buffered = bytesBuffered();
+
+  if (buffered == 0) { return false; }
+
+  const uint16_t maxLength = maxFrameLength();
+  const uint8_t *start     = &_buffer[_readPos];
+  uint16_t frameLength     = 0;
+  uint16_t consumeLength   = 0;
+
+  switch (_framing) {
+    case Framing::Delimiter:
+    {
+      for (uint16_t i = _scanPos; i < buffered && consumeLength == 0; ++i) {
+        if (start[i] == _delimiter) {
+          frameLength   = i;
+          consumeLength = i + 1;
+        }
+      }
+
+      if (consumeLength == 0) {
+        _scanPos = buffered;
+      }
+      break;
+    }
+    case Framing::FixedLength:
+    case Framing::LengthPrefixed:
+    {
+      if (_startByte >= 0) {
+        uint16_t skip = 0;
+
+        while (skip < buffered && start[skip] != _startByte) {
+          ++skip;
+        }
+
+        if (skip > 0) {
+          _readPos += skip;
+          return getFrame(frame, length);
+        }
+      }
+      uint32_t expected = _fixedLength;
+
+      if (_framing == Framing::LengthPrefixed) {
+        const uint16_t headerLength = _lengthOffset + _lengthSize;
+
+        if (buffered < headerLength) { return false; }
+        uint16_t value = start[_lengthOffset];
+
+        if (_lengthSize == 2) {
+          if (_lengthBigEndian) {
+            value = (value << 8) | start[_lengthOffset + 1];
+          } else {
+            value |= (start[_lengthOffset + 1] << 8);
+          }
+        }
+        const int32_t frameSize = static_cast<int32_t>(headerLength) + value + _lengthAdjust;
+        expected = frameSize > 0 ? frameSize : headerLength;
+      }
+
+      if (expected > _bufferSize) {
+        // Can never fit in the buffer, drop what we have and resync
+        ++_stats.dropped;
+        clear();
+        return false;
+      }
+
+      if (buffered >= expected) {
+        frameLength   = expected;
+        consumeLength = expected;
+      }
+      break;
+    }
+    case Framing::Timeout:
+    {
+      if ((_timeout_msec == 0) || (timePassedSince(_lastReceived) >= static_cast<int32_t>(_timeout_msec))) {
+        frameLength   = buffered;
+        consumeLength = buffered;
+      }
+      break;
+    }
+  }
+
+  if ((consumeLength == 0) || (frameLength > maxLength)) {
+    if (buffered < maxLength) {
+      return false;
+    }
+
+    // Max. frame length reached, deliver what we have
+    ++_stats.truncated;
+    frameLength   = maxLength;
+    consumeLength = maxLength;
+  }
+
+  ++_stats.framesReceived;
+  frame               = start;
+  length              = frameLength;
+  _frameConsumeLength = consumeLength;
+  return true;
+}
+
+void SerialFrameReader::consumeFrame()
+{
+  if (_frameConsumeLength == 0) { return; }
+
+  _readPos           += _frameConsumeLength;
+  _frameConsumeLength = 0;
+  _scanPos            = 0;
+
+  if (_readPos >= _writePos) {
+    _readPos  = 0;
+    _writePos = 0;
+  }
+}
+
+int SerialFrameReader::available(ESPeasySerial& serial)
+{
+  return bytesBuffered() + serial.available();
+}
+
+int SerialFrameReader::peek(ESPeasySerial& serial)
+{
+  if (bytesBuffered() == 0) {
+    clear();
+    fill(serial);
+
+    if (bytesBuffered() == 0) { return -1; }
+  }
+  return _buffer[_readPos];
+}
+
+int SerialFrameReader::read(ESPeasySerial& serial)
+{
+  const int res = peek(serial);
+
+  if (res >= 0) {
+    ++_readPos;
+
+    if (_readPos >= _writePos) {
+      clear();
+    }
+  }
+  return res;
+}
+
+void SerialFrameReader::clear()
+{
+  _readPos            = 0;
+  _writePos           = 0;
+  _scanPos            = 0;
+  _frameConsumeLength = 0;
+}
+
+void SerialFrameReader::compact()
+{
+  _frameConsumeLength = 0;
+
+  if (_readPos == 0) { return; }
+  const uint16_t buffered = bytesBuffered();
+
+  if (buffered > 0) {
+    memmove(_buffer, &_buffer[_readPos], buffered);
+  }
+  _readPos  = 0;
+  _writePos = buffered;
+}
+
+uint16_t SerialFrameReader::maxFrameLength() const
+{
+  if ((_maxFrameLength == 0) || (_maxFrameLength > _bufferSize)) {
+    return _bufferSize;
+  }
+  return _maxFrameLength;
+}
+
+#endif // if FEATURE_SERIAL_FRAME_READER
@@ -0,0 +1,178 @@
+#ifndef HELPERS_SERIALFRAMEREADER_H
+#define HELPERS_SERIALFRAMEREADER_H
+
+#include "../../ESPEasy_common.h"
+
+#if FEATURE_SERIAL_FRAME_READER
+
+# include <ESPeasySerial.h>
+
+// Buffer size for plugins only using available(), peek() and read()
+# ifndef SERIAL_FRAME_READER_STREAM_BUFFER_SIZE
+#  define SERIAL_FRAME_READER_STREAM_BUFFER_SIZE  64
+# endif // ifndef SERIAL_FRAME_READER_STREAM_BUFFER_SIZE
+
+/********************************************************************************************\
+   Serial frame reader
+
+   Bytes available on a serial port are moved in bulk into a buffer, using
+   ESPeasySerial::read(buffer, size) instead of reading one byte at a time.
+   The UART driver already fills its own RX buffer from the interrupt (or DMA on ESP32),
+   so this buffer only has to hold incomplete frames between calls.
+
+   Complete frames are handed to the plugin as a pointer into the buffer + length,
+   which is valid until consumeFrame() or the next fill() is called.
+
+   Plugins with a byte-by-byte parser can use available(), peek() and read() instead
+   of the same ESPeasySerial functions. These read from the buffer, which is refilled in bulk
+   when empty. Do not mix this with getFrame() on the same reader.
+
+   Framing modes:
+   - Delimiter:      Frame ends with a specific byte (e.g. CR), which is not included in the frame.
+   - FixedLength:    Frame has a fixed number of bytes.
+   - LengthPrefixed: Frame has a 1 or 2 byte length field at some offset in the frame header.
+   - Timeout:        Frame is complete when no data was received for some time.
+                     With a timeout of 0 msec, all received data is a frame.
+ \*********************************************************************************************/
+
+class SerialFrameReader {
+public:
+
+  enum class Framing : uint8_t {
+    Delimiter,
+    FixedLength,
+    LengthPrefixed,
+    Timeout
+  };
+
+  struct Stats {
+    uint32_t bytesReceived{};
+    uint32_t framesReceived{};
+
+    // Frames dropped as the frame did not fit in the buffer.
+    // N.B. this is not the UART RX overflow, which ESPeasySerial does not report.
+    uint32_t dropped{};
+
+    // Frames delivered as they reached the max. frame length
+    uint32_t truncated{};
+  };
+
+  explicit SerialFrameReader(uint16_t bufferSize = 256);
+
+  ~SerialFrameReader();
+
+  // @retval nullptr when the buffer could not be allocated, so the caller can fall back to reading per byte.
+  static SerialFrameReader* create(uint16_t bufferSize = SERIAL_FRAME_READER_STREAM_BUFFER_SIZE);
+
+  bool isInitialized() const {
+    return _buffer != nullptr;
+  }
+
+  void setDelimiter(uint8_t delimiter);
+
+  // Byte to ignore in the received data, e.g. LF when using CR as delimiter.
+  // Use -1 to disable.
+  void setSkipByte(int16_t skipByte) {
+    _skipByte = skipByte;
+  }
+
+  void setFixedLength(uint16_t length);
+
+  // Byte every frame starts with, for FixedLength and LengthPrefixed framing.
+  // Bytes received before the start byte are discarded. Use -1 to disable.
+  void setStartByte(int16_t startByte) {
+    _startByte = startByte;
+  }
+
+  // Total frame length = lengthOffset + lengthSize + value of length field + lengthAdjust
+  // @param lengthSize  1 or 2 bytes, little endian unless bigEndian is set
+  void setLengthPrefixed(uint8_t lengthOffset,
+                         uint8_t lengthSize,
+                         int8_t  lengthAdjust,
+                         bool    bigEndian);
+
+  void setTimeout(uint16_t timeout_msec);
+
+  // Frame is delivered when it reaches this length. 0 = limited by buffer size.
+  void setMaxFrameLength(uint16_t maxLength) {
+    _maxFrameLength = maxLength;
+  }
+
+  Framing getFraming() const {
+    return _framing;
+  }
+
+  // Move all available data from the serial port into the buffer.
+  // @retval Nr of bytes read
+  size_t fill(ESPeasySerial& serial);
+
+  // Check for a complete frame in the buffer.
+  // @param frame   Set to the start of the frame in the buffer.
+  // @param length  Set to the frame length, excluding the delimiter.
+  bool   getFrame(const uint8_t *& frame,
+                  size_t        & length);
+
+  // Remove the frame last returned by getFrame() from the buffer.
+  void   consumeFrame();
+
+  // Nr of bytes buffered + available on the serial port.
+  int    available(ESPeasySerial& serial);
+
+  // Next byte without removing it, -1 if none available.
+  int    peek(ESPeasySerial& serial);
+
+  // Read next byte, -1 if none available.
+  int    read(ESPeasySerial& serial);
+
+  // Discard all buffered data.
+  void   clear();
+
+  size_t bytesBuffered() const {
+    return _writePos - _readPos;
+  }
+
+  const Stats& getStats() const {
+    return _stats;
+  }
+
+  void clearStats() {
+    _stats = Stats();
+  }
+
+private:
+
+  // Move buffered data to the start of the buffer so frames are always contiguous.
+  void     compact();
+
+  uint16_t maxFrameLength() const;
+
+  uint8_t *_buffer{};
+  uint16_t _bufferSize{};
+  uint16_t _readPos{};
+  uint16_t _writePos{};
+
+  // Nr of bytes already scanned for a delimiter
+  uint16_t _scanPos{};
+
+  // Length of frame last returned by getFrame() incl. delimiter, 0 = none
+  uint16_t _frameConsumeLength{};
+
+  Framing  _framing = Framing::Delimiter;
+  uint8_t  _delimiter{ '\n' };
+  int16_t  _skipByte{ -1 };
+  int16_t  _startByte{ -1 };
+  uint16_t _fixedLength{};
+  uint8_t  _lengthOffset{};
+  uint8_t  _lengthSize{ 1 };
+  int8_t   _lengthAdjust{};
+  bool     _lengthBigEndian{};
+  uint16_t _timeout_msec{};
+  uint16_t _maxFrameLength{};
+  uint32_t _lastReceived{};
+
+  Stats _stats;
+};
+
+#endif // if FEATURE_SERIAL_FRAME_READER
+
+#endif // ifndef HELPERS_SERIALFRAMEREADER_H
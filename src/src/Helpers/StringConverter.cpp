@@ -4,6 +4,7 @@
 #include "../../_Plugin_Helper.h"
 
 #include "../DataStructs/ESPEasy_EventStruct.h"
+#include "../DataStructs/SampleRecord.h"
 #include "../DataStructs/TimingStats.h"
 
 #include "../ESPEasyCore/ESPEasy_Log.h"
@@ -317,6 +318,32 @@ void replaceUnicodeByChar(String& line, char replChar) {
 \*********************************************************************************************/
 String doFormatUserVar(struct EventStruct *event, uint8_t rel_index, bool mustCheck, bool& isvalid) {
   if (event == nullptr) return EMPTY_STRING;
+
+  // sendData() only calls the controllers when all task values are valid,
+  // so the formatted value can be shared between calls with and without check.
+  SampleRecord *sampleRecord = SampleRecord::getActive(event);
+
+  if ((sampleRecord != nullptr) && sampleRecord->hasFormatted(rel_index)) {
+    isvalid = true;
+#if FEATURE_TIMING_STATS
+    ++formatUserVar_cacheHits;
+#endif // if FEATURE_TIMING_STATS
+    return sampleRecord->getFormatted(rel_index);
+  }
+
+  String res = doFormatUserVar_noCache(event, rel_index, mustCheck, isvalid);
+
+#if FEATURE_TIMING_STATS
+  formatUserVar_bytes += res.length();
+#endif // if FEATURE_TIMING_STATS
+
+  if ((sampleRecord != nullptr) && isvalid) {
+    sampleRecord->setFormatted(rel_index, res);
+  }
+  return res;
+}
+
+String doFormatUserVar_noCache(struct EventStruct *event, uint8_t rel_index, bool mustCheck, bool& isvalid) {
   START_TIMER;
   isvalid = true;
 
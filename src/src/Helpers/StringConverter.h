@@ -122,6 +122,12 @@ String doFormatUserVar(struct EventStruct *event,
                        bool                mustCheck,
                        bool              & isvalid);
 
+// Format the value without using the active SampleRecord
+String doFormatUserVar_noCache(struct EventStruct *event,
+                               uint8_t                rel_index,
+                               bool                mustCheck,
+                               bool              & isvalid);
+
 String formatUserVarNoCheck(taskIndex_t TaskIndex,
                             uint8_t        rel_index);
 
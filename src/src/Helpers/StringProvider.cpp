@@ -172,6 +172,10 @@ KeyValueStruct getKeyValue(LabelType::Enum label, bool extendedValue)
     {
       return KeyValueStruct(F("CPU Eco Mode"), Settings.EcoPowerMode());
     }
+    case LabelType::ALIGN_TASK_READS:
+    {
+      return KeyValueStruct(F("Align Task Reads"), Settings.AlignTaskReads());
+    }
 #if FEATURE_SET_WIFI_TX_PWR
     case LabelType::WIFI_TX_MAX_PWR:
     {
@@ -1355,6 +1359,10 @@ String getFormNote(LabelType::Enum label)
       flash_str = F("Node may miss receiving packets with Eco mode enabled");
       break;
 
+    case LabelType::ALIGN_TASK_READS:
+      flash_str = F("Tasks with the same interval are read at the same moment");
+      break;
+
     case LabelType::WIFI_AP_CHANNEL:
       flash_str = F("WiFi channel to be used when only WiFi AP is active");
       break;
@@ -26,6 +26,7 @@ struct LabelType {
     LOAD_PCT,            // 15.10
     LOOP_COUNT,          // 400
     CPU_ECO_MODE,        // true
+    ALIGN_TASK_READS,    // false
 #if FEATURE_SET_WIFI_TX_PWR
     WIFI_TX_MAX_PWR,     // Unit: 0.25 dBm, 0 = use default (do not set)
     WIFI_CUR_TX_PWR,     // Unit dBm of current WiFi TX power.
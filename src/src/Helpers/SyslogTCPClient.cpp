@@ -0,0 +1,216 @@
+#include "../Helpers/SyslogTCPClient.h"
+
+#if FEATURE_SYSLOG
+
+# include "../Helpers/ESPEasy_time_calc.h"
+
+# ifdef ESP32
+#  include <lwip/sockets.h>
+# endif // ifdef ESP32
+# ifdef ESP8266
+#  include <lwip/tcp.h>
+# endif // ifdef ESP8266
+
+SyslogTCPClient::~SyslogTCPClient()
+{
+  stop();
+}
+
+# ifdef ESP32
+
+bool SyslogTCPClient::connect(const IPAddress& ip, uint16_t port)
+{
+  stop();
+  _fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+
+  if (_fd < 0) {
+    return false;
+  }
+  fcntl(_fd, F_SETFL, fcntl(_fd, F_GETFL, 0) | O_NONBLOCK);
+
+  struct sockaddr_in addr {};
+
+  addr.sin_family      = AF_INET;
+  addr.sin_port        = htons(port);
+  addr.sin_addr.s_addr = static_cast<uint32_t>(ip);
+
+  if ((::connect(_fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) != 0) &&
+      (errno != EINPROGRESS)) {
+    stop();
+    return false;
+  }
+  _state        = State::Connecting;
+  _connectStart = millis();
+  return true;
+}
+
+SyslogTCPClient::State SyslogTCPClient::state()
+{
+  if (_state == State::Connecting) {
+    fd_set fdset;
+    FD_ZERO(&fdset);
+    FD_SET(_fd, &fdset);
+    struct timeval tv {};
+
+    const int res = select(_fd + 1, nullptr, &fdset, nullptr, &tv);
+
+    if (res > 0) {
+      int error{};
+      socklen_t length = sizeof(error);
+
+      if ((getsockopt(_fd, SOL_SOCKET, SO_ERROR, &error, &length) == 0) && (error == 0)) {
+        _state = State::Connected;
+      } else {
+        stop();
+      }
+    } else if ((res < 0) || (timePassedSince(_connectStart) > SYSLOG_TCP_CONNECT_TIMEOUT)) {
+      stop();
+    }
+  } else if (_state == State::Connected) {
+    // The server is not supposed to send anything, discard it and check for a closed connection
+    uint8_t buf[16];
+    const int res = recv(_fd, buf, sizeof(buf), MSG_DONTWAIT);
+
+    if ((res == 0) || ((res < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK))) {
+      stop();
+    }
+  }
+  return _state;
+}
+
+size_t SyslogTCPClient::write(const uint8_t *data, size_t size)
+{
+  if (_state != State::Connected) {
+    return 0;
+  }
+  const int res = send(_fd, data, size, MSG_DONTWAIT);
+
+  if (res > 0) {
+    return res;
+  }
+
+  if ((res < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK)) {
+    stop();
+  }
+  return 0;
+}
+
+void SyslogTCPClient::stop()
+{
+  if (_fd >= 0) {
+    close(_fd);
+    _fd = -1;
+  }
+  _state = State::Disconnected;
+}
+
+# endif // ifdef ESP32
+
+# ifdef ESP8266
+
+bool SyslogTCPClient::connect(const IPAddress& ip, uint16_t port)
+{
+  stop();
+  _pcb = tcp_new();
+
+  if (_pcb == nullptr) {
+    return false;
+  }
+  tcp_arg(_pcb, this);
+  tcp_err(_pcb, _s_error);
+  tcp_recv(_pcb, _s_recv);
+
+  const ip_addr_t addr = ip;
+
+  if (tcp_connect(_pcb, &addr, port, _s_connected) != ERR_OK) {
+    stop();
+    return false;
+  }
+  _state        = State::Connecting;
+  _connectStart = millis();
+  return true;
+}
+
+SyslogTCPClient::State SyslogTCPClient::state()
+{
+  if ((_state == State::Connecting) && (timePassedSince(_connectStart) > SYSLOG_TCP_CONNECT_TIMEOUT)) {
+    stop();
+  }
+  return _state;
+}
+
+size_t SyslogTCPClient::write(const uint8_t *data, size_t size)
+{
+  if ((_state != State::Connected) || (_pcb == nullptr)) {
+    return 0;
+  }
+  const size_t room = tcp_sndbuf(_pcb);
+
+  if (size > room) {
+    size = room;
+  }
+
+  if ((size == 0) || (tcp_write(_pcb, data, size, TCP_WRITE_FLAG_COPY) != ERR_OK)) {
+    return 0;
+  }
+  tcp_output(_pcb);
+  return size;
+}
+
+void SyslogTCPClient::stop()
+{
+  if (_pcb != nullptr) {
+    tcp_arg(_pcb, nullptr);
+    tcp_err(_pcb, nullptr);
+    tcp_recv(_pcb, nullptr);
+
+    if (tcp_close(_pcb) != ERR_OK) {
+      tcp_abort(_pcb);
+    }
+    _pcb = nullptr;
+  }
+  _state = State::Disconnected;
+}
+
+int8_t SyslogTCPClient::_s_connected(void *arg, struct tcp_pcb *, int8_t)
+{
+  SyslogTCPClient *self = static_cast<SyslogTCPClient *>(arg);
+
+  if (self != nullptr) {
+    self->_state = State::Connected;
+  }
+  return ERR_OK;
+}
+
+int8_t SyslogTCPClient::_s_recv(void *arg, struct tcp_pcb *pcb, struct pbuf *p, int8_t)
+{
+  SyslogTCPClient *self = static_cast<SyslogTCPClient *>(arg);
+
+  if (p == nullptr) {
+    // Closed by the server, the pcb is closed by stop() from the loop
+    if (self != nullptr) {
+      self->_state = State::Disconnected;
+    }
+    return ERR_OK;
+  }
+
+  // The server is not supposed to send anything, discard it
+  tcp_recved(pcb, p->tot_len);
+  pbuf_free(p);
+  return ERR_OK;
+}
+
+void SyslogTCPClient::_s_error(void *arg, int8_t)
+{
+  SyslogTCPClient *self = static_cast<SyslogTCPClient *>(arg);
+
+  if (self != nullptr) {
+    // The pcb is already freed by lwIP
+    self->_pcb   = nullptr;
+    self->_state = State::Disconnected;
+  }
+}
+
+# endif // ifdef ESP8266
+
+#endif // if FEATURE_SYSLOG
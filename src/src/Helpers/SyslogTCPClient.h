@@ -0,0 +1,86 @@
+#pragma once
+
+#include "../../ESPEasy_common.h"
+
+#if FEATURE_SYSLOG
+
+# ifdef ESP8266
+struct tcp_pcb;
+struct pbuf;
+# endif // ifdef ESP8266
+
+
+/*********************************************************************************************\
+   TCP connection for the syslog client, which never blocks.
+
+   The connect is started by connect() and completes in the background,
+   state() must be called to check whether it has completed or timed out.
+   write() only copies what fits in the TCP send buffer.
+
+   - ESP32:   lwIP socket in non-blocking mode.
+   - ESP8266: lwIP raw TCP API, as the WiFiClient connect waits for the connection.
+\*********************************************************************************************/
+
+#ifndef SYSLOG_TCP_CONNECT_TIMEOUT
+
+// Max. time a connect may be pending, in msec.
+# define SYSLOG_TCP_CONNECT_TIMEOUT  2000
+#endif // ifndef SYSLOG_TCP_CONNECT_TIMEOUT
+
+class SyslogTCPClient {
+public:
+
+  enum class State : uint8_t {
+    Disconnected,
+    Connecting,
+    Connected
+  };
+
+  SyslogTCPClient() = default;
+
+  ~SyslogTCPClient();
+
+  SyslogTCPClient(const SyslogTCPClient&)            = delete;
+  SyslogTCPClient& operator=(const SyslogTCPClient&) = delete;
+
+  // Start connecting, any existing connection is closed.
+  // @retval false when the connect could not be started.
+  bool   connect(const IPAddress& ip,
+                 uint16_t         port);
+
+  // Check for a completed connect, connect timeout or closed connection.
+  State  state();
+
+  // @retval Number of bytes accepted, 0 when the send buffer is full or not connected.
+  size_t write(const uint8_t *data,
+               size_t         size);
+
+  void   stop();
+
+private:
+
+# ifdef ESP32
+  int _fd{ -1 };
+# endif // ifdef ESP32
+# ifdef ESP8266
+  // lwIP callbacks, int8_t is err_t
+  static int8_t _s_connected(void          *arg,
+                             struct tcp_pcb *pcb,
+                             int8_t         err);
+
+  static int8_t _s_recv(void          *arg,
+                        struct tcp_pcb *pcb,
+                        struct pbuf    *p,
+                        int8_t         err);
+
+  static void   _s_error(void  *arg,
+                         int8_t err);
+
+  struct tcp_pcb *_pcb{};
+# endif // ifdef ESP8266
+
+  uint32_t _connectStart{};
+  State    _state{ State::Disconnected };
+};
+
+#endif // if FEATURE_SYSLOG
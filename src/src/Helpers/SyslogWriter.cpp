@@ -6,8 +6,10 @@
 #include "../../ESPEasy/net/ESPEasyNetwork.h"
 #include "../../ESPEasy/net/Globals/NetworkState.h"
 #include "../Globals/ESPEasy_time.h"
+#include "../Globals/Logging.h"
 #include "../Globals/Settings.h"
 #include "../Helpers/ESPEasy_time_calc.h"
+#include "../Helpers/Memory.h"
 #include "../Helpers/Networking.h"
 #include "../Helpers/StringConverter.h"
 
@@ -15,45 +17,292 @@
 
 bool SyslogWriter::process()
 {
-  if ((Settings.SyslogLevel == 0) || (getNrMessages() == 0)) {
+  if ((Settings.SyslogLevel == 0) || (Settings.Syslog_IP[0] == 0)) {
+    stopTCP();
     return false;
   }
 
+  if (_transport != Settings.SyslogTransport()) {
+    // Transport changed, any pending message has a prefix in the wrong format
+    stopTCP();
+    clear();
+    _transport = Settings.SyslogTransport();
+  }
+
+  if (((getNrMessages() == 0) && (_timestamp == 0) && (_tcpFramePos >= _tcpFrame.length())) ||
+      !ESPEasy::net::NetworkConnected()) {
+    return false;
+  }
+
+  const IPAddress syslogIP(Settings.Syslog_IP[0], Settings.Syslog_IP[1], Settings.Syslog_IP[2], Settings.Syslog_IP[3]);
+
+  switch (_transport) {
+    case SYSLOG_TRANSPORT_UDP_BATCHED:
+      return process_UDP_batched(syslogIP);
+    case SYSLOG_TRANSPORT_TCP:
+      return process_TCP(syslogIP);
+  }
+  return process_UDP(syslogIP);
+}
+
+uint32_t SyslogWriter::getNrDropped() const
+{
+  return Logging.getNrDropped(_log_destination);
+}
+
+bool SyslogWriter::process_UDP(const IPAddress& syslogIP)
+{
   bool somethingWritten{};
+  WiFiUDP syslogUDP;
+
+  if (!beginWiFiUDP_randomPort(syslogUDP)) {
+    return false;
+  }
 
-  if ((Settings.Syslog_IP[0] != 0) && ESPEasy::net::NetworkConnected())
-  {
-    WiFiUDP syslogUDP;
+  const uint32_t start = millis();
+  bool done            = false;
+
+  // Only try to process syslog messages for a limited amount of time to keep ESPEasy responsive
+  while (!done && timePassedSince(start) < 200) {
+    FeedSW_watchdog();
+
+    if (syslogUDP.beginPacket(syslogIP, Settings.SyslogPort) == 0) {
+      // Could not create socket
+      return somethingWritten;
+    }
+
+    const size_t written = write_single_item(syslogUDP, MAX_LENGTH_SYSLOG_MESSAGE);
+
+    if (written != 0) {
+      somethingWritten = true;
+      ++_stats.messagesSent;
+      ++_stats.packetsSent;
+      _stats.bytesSent += written;
+    } else { done = true; }
+
+    syslogUDP.endPacket();
+    FeedSW_watchdog();
+    delay(0);
+  }
+  return somethingWritten;
+}
+
+bool SyslogWriter::process_UDP_batched(const IPAddress& syslogIP)
+{
+  bool somethingWritten{};
+  WiFiUDP syslogUDP;
+
+  if (!beginWiFiUDP_randomPort(syslogUDP)) {
+    return false;
+  }
 
-    if (!beginWiFiUDP_randomPort(syslogUDP)) {
+  String batch;
+
+  if (!batch.reserve(SYSLOG_BATCH_MAX_SIZE)) {
+    return false;
+  }
+
+  const uint32_t start = millis();
+
+  // Only try to process syslog messages for a limited amount of time to keep ESPEasy responsive
+  while (timePassedSince(start) < 200) {
+    FeedSW_watchdog();
+    batch.clear();
+    uint32_t nrMessages = 0;
+
+    while (rateLimitAllows() && fetch_message()) {
+      if (!batch.isEmpty()) {
+        if ((batch.length() + 1 + _prefix.length() + _message.length()) > SYSLOG_BATCH_MAX_SIZE) {
+          // Keep the message for the next packet
+          break;
+        }
+        batch += '\n';
+      }
+      append_message(batch, SYSLOG_BATCH_MAX_SIZE);
+      ++nrMessages;
+    }
+
+    if (nrMessages == 0) {
+      return somethingWritten;
+    }
+
+    if (syslogUDP.beginPacket(syslogIP, Settings.SyslogPort) == 0) {
+      // Could not create socket
+      return somethingWritten;
+    }
+    syslogUDP.write(reinterpret_cast<const uint8_t *>(batch.c_str()), batch.length());
+
+    if (syslogUDP.endPacket()) {
+      _stats.messagesSent += nrMessages;
+      _stats.bytesSent    += batch.length();
+      ++_stats.packetsSent;
+    }
+    rateLimitConsume(batch.length());
+    somethingWritten = true;
+    FeedSW_watchdog();
+    delay(0);
+  }
+  return somethingWritten;
+}
+
+bool SyslogWriter::process_TCP(const IPAddress& syslogIP)
+{
+  const SyslogTCPClient::State state = _tcpClient.state();
+
+  if (state == SyslogTCPClient::State::Connecting) {
+    // Check again on the next call
+    return false;
+  }
+
+  if (state == SyslogTCPClient::State::Disconnected) {
+    if (_tcpConnecting) {
+      // Connect failed or timed out
+      _tcpConnecting = false;
+      ++_stats.connectFailures;
+    }
+
+    if ((_lastConnectAttempt != 0) &&
+        (timePassedSince(_lastConnectAttempt) < SYSLOG_TCP_RECONNECT_INTERVAL)) {
       return false;
     }
 
-    const IPAddress syslogIP(Settings.Syslog_IP[0], Settings.Syslog_IP[1], Settings.Syslog_IP[2], Settings.Syslog_IP[3]);
-    const uint32_t  start = millis();
-    bool done             = false;
+    // A partially sent frame cannot be continued on a new connection
+    stopTCP();
+    _lastConnectAttempt = millis();
+
+    if (_lastConnectAttempt == 0) { _lastConnectAttempt = 1; }
+
+    if (_tcpClient.connect(syslogIP, Settings.SyslogPort)) {
+      _tcpConnecting = true;
+    } else {
+      ++_stats.connectFailures;
+    }
+    return false;
+  }
+  _tcpConnecting = false;
+
+  bool somethingWritten{};
+  const uint32_t start = millis();
 
-    // Only try to process syslog messages for a limited amount of time to keep ESPEasy responsive
-    while (!done && timePassedSince(start) < 200) {
-      FeedSW_watchdog();
+  // Only try to process syslog messages for a limited amount of time to keep ESPEasy responsive
+  while (timePassedSince(start) < 200) {
+    FeedSW_watchdog();
 
-      if (syslogUDP.beginPacket(syslogIP, Settings.SyslogPort) == 0) {
-        // Could not create socket
-        return somethingWritten;
+    if (_tcpFramePos >= _tcpFrame.length()) {
+      if (!rateLimitAllows() || !fetch_message()) {
+        break;
       }
 
-      if (write_single_item(syslogUDP, MAX_LENGTH_SYSLOG_MESSAGE) != 0) {
-        somethingWritten = true;
-      } else { done = true; }
+      // Octet-counting: "MSG-LEN SP SYSLOG-MSG"
+      String msg;
+      append_message(msg, MAX_LENGTH_SYSLOG_MESSAGE);
+      _tcpFrame    = String(msg.length());
+      _tcpFrame   += ' ';
+      _tcpFrame   += msg;
+      _tcpFramePos = 0;
+    }
+
+    // Does not block when the TCP send buffer is full
+    const size_t written = _tcpClient.write(
+      reinterpret_cast<const uint8_t *>(_tcpFrame.c_str()) + _tcpFramePos,
+      _tcpFrame.length() - _tcpFramePos);
 
-      syslogUDP.endPacket();
-      FeedSW_watchdog();
-      delay(0);
+    if (written == 0) {
+      // Try again later
+      break;
     }
+    _tcpFramePos     += written;
+    _stats.bytesSent += written;
+    rateLimitConsume(written);
+    somethingWritten = true;
+
+    if (_tcpFramePos >= _tcpFrame.length()) {
+      ++_stats.messagesSent;
+      _tcpFrame.clear();
+      _tcpFramePos = 0;
+    }
+    delay(0);
   }
   return somethingWritten;
 }
 
+bool SyslogWriter::fetch_message()
+{
+  if ((_timestamp != 0) && !_message.isEmpty()) {
+    return true;
+  }
+  clear();
+
+  while (Logging.getNext(_log_destination, _timestamp, _message, _loglevel)) {
+    if (loglevelActiveFor(_log_destination, _loglevel)) {
+      prepare_prefix();
+      return true;
+    }
+  }
+  free_string(_message);
+  _timestamp = 0;
+  return false;
+}
+
+void SyslogWriter::append_message(String& str, size_t maxLength)
+{
+  str += _prefix;
+
+  const size_t length = str.length();
+
+  if (length < maxLength) {
+    if ((length + _message.length()) > maxLength) {
+      str += _message.substring(0, maxLength - length);
+    } else {
+      str += _message;
+    }
+  }
+  clear();
+}
+
+bool SyslogWriter::rateLimitAllows()
+{
+# if SYSLOG_RATE_LIMIT_BYTES_PER_SEC > 0
+  const uint32_t now = millis();
+
+  if (_rateLastUpdate == 0) {
+    _rateLastUpdate = now;
+  }
+  const int32_t elapsed = timeDiff(_rateLastUpdate, now);
+
+  if (elapsed > 0) {
+    // Allow for a burst of at most 1 second
+    const int64_t tokens = static_cast<int64_t>(_rateTokens) +
+                           (static_cast<int64_t>(elapsed) * SYSLOG_RATE_LIMIT_BYTES_PER_SEC) / 1000;
+    _rateTokens     = (tokens > SYSLOG_RATE_LIMIT_BYTES_PER_SEC) ? SYSLOG_RATE_LIMIT_BYTES_PER_SEC : tokens;
+    _rateLastUpdate = now;
+  }
+
+  if (_rateTokens <= 0) {
+    ++_stats.rateLimited;
+    return false;
+  }
+# endif // if SYSLOG_RATE_LIMIT_BYTES_PER_SEC > 0
+  return true;
+}
+
+void SyslogWriter::rateLimitConsume(size_t nrBytes)
+{
+# if SYSLOG_RATE_LIMIT_BYTES_PER_SEC > 0
+
+  // May become negative, which is then compensated in the next period
+  _rateTokens -= static_cast<int32_t>(nrBytes);
+# endif // if SYSLOG_RATE_LIMIT_BYTES_PER_SEC > 0
+}
+
+void SyslogWriter::stopTCP()
+{
+  _tcpClient.stop();
+  _tcpConnecting = false;
+  free_string(_tcpFrame);
+  _tcpFramePos = 0;
+}
+
 void SyslogWriter::prepare_prefix()
 {
   unsigned int prio = Settings.SyslogFacility * 8;
@@ -68,6 +317,11 @@ void SyslogWriter::prepare_prefix()
     prio += 7;
   }
 
+  if (_transport != SYSLOG_TRANSPORT_UDP) {
+    prepare_prefix_RFC5424(prio);
+    return;
+  }
+
   // An RFC3164 compliant message must be formated like:
   //   "<PRIO>[TimeStamp ]Hostname TaskName: Message"
 
@@ -136,4 +390,45 @@ void SyslogWriter::prepare_prefix()
     formattedTimestamp.c_str(),
     hostname.c_str());
 }
-#endif
\ No newline at end of file
+
+void SyslogWriter::prepare_prefix_RFC5424(unsigned int prio)
+{
+  // An RFC5424 message is formatted like:
+  //   "<PRIO>1 TIMESTAMP HOSTNAME APP-NAME PROCID MSGID STRUCTURED-DATA MSG"
+  // Unknown fields are represented by "-"
+  // TIMESTAMP is in UTC, e.g. "2026-10-19T13:07:42.123Z"
+
+  // See: https://www.rfc-editor.org/rfc/rfc5424
+
+  String formattedTimestamp('-');
+
+  if (statusNTPInitialized) {
+    struct tm ts;
+    uint32_t  unix_time_frac{};
+    const uint32_t unix_time = node_time.systemMicros_to_Unixtime(
+      node_time.internalTimestamp_to_systemMicros(_timestamp),
+      unix_time_frac);
+    breakTime(unix_time, ts);
+
+    formattedTimestamp = strformat(
+      F("%04d-%02d-%02dT%02d:%02d:%02d.%03uZ"),
+      ts.tm_year + 1900, ts.tm_mon + 1, ts.tm_mday,
+      ts.tm_hour, ts.tm_min, ts.tm_sec,
+      unix_time_frac_to_millis(unix_time_frac));
+  }
+
+  String hostname(ESPEasy::net::NetworkCreateRFCCompliantHostname(true));
+  hostname.replace(' ', '_');
+  hostname.trim();
+
+  if (hostname.isEmpty()) {
+    hostname = '-';
+  }
+
+  _prefix = strformat(
+    F("<%d>1 %s %s EspEasy - - - "),
+    prio,
+    formattedTimestamp.c_str(),
+    hostname.c_str());
+}
+#endif
\ No newline at end of file
@@ -5,23 +5,109 @@
 #if FEATURE_SYSLOG
 
 #include "../Helpers/LogStreamWriter.h"
+#include "../Helpers/SyslogTCPClient.h"
+
+#include <WiFiUdp.h>
 
 
 /*********************************************************************************************\
    Syslog client
+
+   Transports:
+   - UDP:         RFC3164, one message per packet.
+   - UDP batched: RFC5424, messages are packed into packets of at most SYSLOG_BATCH_MAX_SIZE bytes,
+                  separated by a newline.
+   - TCP:         RFC5424 with octet-counting framing (RFC6587), over a persistent connection.
+                  Connect and write do not block (see SyslogTCPClient), so an unreachable or slow server
+                  does not block ESPEasy. Only written when the TCP send buffer has room.
+                  Messages not sent in time will expire in the log buffer and are counted as dropped.
+
+   All transports are processed from the background tasks, as the log buffer is not thread safe.
 \*********************************************************************************************/
 
+#define SYSLOG_TRANSPORT_UDP          0
+#define SYSLOG_TRANSPORT_UDP_BATCHED  1
+#define SYSLOG_TRANSPORT_TCP          2
+
+#ifndef SYSLOG_BATCH_MAX_SIZE
+
+// Fits in a single Ethernet frame, to prevent IP fragmentation
+# define SYSLOG_BATCH_MAX_SIZE  1400
+#endif // ifndef SYSLOG_BATCH_MAX_SIZE
+
+#ifndef SYSLOG_RATE_LIMIT_BYTES_PER_SEC
+
+// Max. average nr of bytes per second sent using the batched UDP and TCP transport. 0 = no limit
+# define SYSLOG_RATE_LIMIT_BYTES_PER_SEC  8192
+#endif // ifndef SYSLOG_RATE_LIMIT_BYTES_PER_SEC
+
+#ifndef SYSLOG_TCP_RECONNECT_INTERVAL
+# define SYSLOG_TCP_RECONNECT_INTERVAL  10000
+#endif // ifndef SYSLOG_TCP_RECONNECT_INTERVAL
+
 class SyslogWriter : public LogStreamWriter {
 public:
 
+  struct Stats {
+    uint32_t messagesSent{};
+    uint32_t bytesSent{};
+    uint32_t packetsSent{};
+
+    // Nr of times sending was postponed due to the rate limit
+    uint32_t rateLimited{};
+    uint32_t connectFailures{};
+  };
+
   SyslogWriter(LogDestination log_destination) : LogStreamWriter(log_destination) {}
 
   virtual bool process() override;
 
+  const Stats& getStats() const {
+    return _stats;
+  }
+
+  // Nr of messages which expired in the log buffer before they could be sent
+  uint32_t getNrDropped() const;
+
 private:
 
+  bool process_UDP(const IPAddress& syslogIP);
+
+  bool process_UDP_batched(const IPAddress& syslogIP);
+
+  bool process_TCP(const IPAddress& syslogIP);
+
+  // Fetch the next message from the log buffer, unless one is still pending.
+  bool fetch_message();
+
+  // Append the pending message including prefix to str, and clear the pending message.
+  void append_message(String& str,
+                      size_t  maxLength);
+
+  bool rateLimitAllows();
+
+  void rateLimitConsume(size_t nrBytes);
+
+  void stopTCP();
+
   void prepare_prefix() override;
 
+  void prepare_prefix_RFC5424(unsigned int prio);
+
+  Stats _stats;
+
+  SyslogTCPClient _tcpClient;
+
+  // Octet-counted frame being written to the TCP connection
+  String   _tcpFrame;
+  size_t   _tcpFramePos{};
+  uint32_t _lastConnectAttempt{};
+  bool     _tcpConnecting{};
+
+  int32_t  _rateTokens{ SYSLOG_RATE_LIMIT_BYTES_PER_SEC };
+  uint32_t _rateLastUpdate{};
+
+  uint8_t _transport{ SYSLOG_TRANSPORT_UDP };
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -55,6 +55,13 @@ Internal_GPIO_pulseHelper::Internal_GPIO_pulseHelper(Internal_GPIO_pulseHelper::
   : config(configuration) {}
 
 Internal_GPIO_pulseHelper::~Internal_GPIO_pulseHelper() {
+#if FEATURE_PULSE_PCNT
+
+  if (usingPCNT()) {
+    deinitPCNT();
+    return;
+  }
+#endif // if FEATURE_PULSE_PCNT
   detachInterrupt(digitalPinToInterrupt(config.gpio));
 }
 
@@ -75,6 +82,21 @@ bool Internal_GPIO_pulseHelper::init()
     pulseModeData.Step3OKcounter = ISRdata.pulseTotalCounter;
     #endif // ifdef PULSE_STATISTIC
 
+#if FEATURE_PULSE_PCNT
+
+    if (config.usePCNT && config.useEdgeMode()) {
+      if (!config.debounceFitsPCNT()) {
+        // Debounce time (msec) is far beyond the glitch filter (usec), use interrupt instead
+        addLog(LOG_LEVEL_INFO, concat(F("Pulse: Debounce time too long for PCNT, using interrupt for GPIO-"), static_cast<int>(config.gpio)));
+      } else if (initPCNT()) {
+        return true;
+      } else {
+        // No PCNT unit available, use interrupt instead
+        addLog(LOG_LEVEL_ERROR, concat(F("Pulse: No PCNT unit available for GPIO-"), static_cast<int>(config.gpio)));
+      }
+    }
+#endif // if FEATURE_PULSE_PCNT
+
     const int intPinMode = static_cast<int>(config.interruptPinMode) & MODE_INTERRUPT_MASK;
     attachInterruptArg(
       digitalPinToInterrupt(config.gpio),
@@ -90,6 +112,9 @@ bool Internal_GPIO_pulseHelper::init()
 
 void Internal_GPIO_pulseHelper::getPulseCounters(unsigned long& pulseCounter, unsigned long& pulseTotalCounter, float& pulseTime_msec)
 {
+#if FEATURE_PULSE_PCNT
+  readPCNT();
+#endif // if FEATURE_PULSE_PCNT
   pulseCounter      = ISRdata.pulseCounter;
   pulseTotalCounter = ISRdata.pulseTotalCounter;
   pulseTime_msec    = static_cast<float>(ISRdata.pulseTime) / 1000.0f;
@@ -112,8 +137,26 @@ void Internal_GPIO_pulseHelper::resetPulseCounter()
   ISRdata.pulseTime    = 0;
 }
 
+bool Internal_GPIO_pulseHelper::usingPCNT() const
+{
+#if FEATURE_PULSE_PCNT
+  return _pcntUnit != nullptr;
+#else // if FEATURE_PULSE_PCNT
+  return false;
+#endif // if FEATURE_PULSE_PCNT
+}
+
 void Internal_GPIO_pulseHelper::doPulseStepProcessing(int pStep)
 {
+#if FEATURE_PULSE_PCNT
+
+  if (usingPCNT()) {
+    // Regular readout, to handle counter overflow and update the pulse time
+    readPCNT();
+    return;
+  }
+#endif // if FEATURE_PULSE_PCNT
+
   switch (pStep)
   {
     case GPIO_PULSE_HELPER_PROCESSING_STEP_0:
@@ -401,6 +444,103 @@ void IRAM_ATTR Internal_GPIO_pulseHelper::ISR_pulseCheck(Internal_GPIO_pulseHelp
   ISR_interrupts();                        // enable interrupts again.
 }
 
+#if FEATURE_PULSE_PCNT
+
+bool Internal_GPIO_pulseHelper::initPCNT()
+{
+  pcnt_unit_config_t unit_config{};
+
+  unit_config.low_limit  = -1;
+  unit_config.high_limit = PULSE_PCNT_HIGH_LIMIT;
+
+  if (ESP_OK != pcnt_new_unit(&unit_config, &_pcntUnit)) {
+    _pcntUnit = nullptr;
+    return false;
+  }
+
+  if (config.debounceTime_micros > 0) {
+    // Checked by debounceFitsPCNT()
+    pcnt_glitch_filter_config_t filter_config{};
+    filter_config.max_glitch_ns = static_cast<uint32_t>(config.debounceTime_micros * 1000);
+    pcnt_unit_set_glitch_filter(_pcntUnit, &filter_config);
+  }
+
+  pcnt_chan_config_t chan_config{};
+
+  chan_config.edge_gpio_num  = config.gpio;
+  chan_config.level_gpio_num = -1;
+
+  if (ESP_OK != pcnt_new_channel(_pcntUnit, &chan_config, &_pcntChannel)) {
+    _pcntChannel = nullptr;
+    deinitPCNT();
+    return false;
+  }
+
+  // Count on the same edges as the interrupt would be triggered
+  const pcnt_channel_edge_action_t rising =
+    (config.interruptPinMode == GPIOtriggerMode::Falling) ? PCNT_CHANNEL_EDGE_ACTION_HOLD : PCNT_CHANNEL_EDGE_ACTION_INCREASE;
+  const pcnt_channel_edge_action_t falling =
+    (config.interruptPinMode == GPIOtriggerMode::Rising) ? PCNT_CHANNEL_EDGE_ACTION_HOLD : PCNT_CHANNEL_EDGE_ACTION_INCREASE;
+
+  if ((ESP_OK != pcnt_channel_set_edge_action(_pcntChannel, rising, falling)) ||
+      (ESP_OK != pcnt_unit_enable(_pcntUnit)) ||
+      (ESP_OK != pcnt_unit_clear_count(_pcntUnit)) ||
+      (ESP_OK != pcnt_unit_start(_pcntUnit))) {
+    deinitPCNT();
+    return false;
+  }
+
+  // Creating the channel may have changed the pull-up/down setting of the pin
+  pinMode(config.gpio, config.pullupPinMode);
+  _pcntLastCount = 0;
+  return true;
+}
+
+void Internal_GPIO_pulseHelper::deinitPCNT()
+{
+  if (_pcntUnit == nullptr) { return; }
+
+  pcnt_unit_stop(_pcntUnit);
+  pcnt_unit_disable(_pcntUnit);
+
+  if (_pcntChannel != nullptr) {
+    pcnt_del_channel(_pcntChannel);
+    _pcntChannel = nullptr;
+  }
+  pcnt_del_unit(_pcntUnit);
+  _pcntUnit = nullptr;
+}
+
+void Internal_GPIO_pulseHelper::readPCNT()
+{
+  if (_pcntUnit == nullptr) { return; }
+
+  int count{};
+
+  if (ESP_OK != pcnt_unit_get_count(_pcntUnit, &count)) { return; }
+
+  int delta = count - _pcntLastCount;
+
+  if (delta < 0) {
+    // Counter was reset to 0 when reaching the high limit
+    delta += PULSE_PCNT_HIGH_LIMIT;
+  }
+
+  if (delta <= 0) { return; }
+  _pcntLastCount = count;
+
+  // Individual edges are not timestamped, so use the average time
+  // between the edges counted since the last readout with new edges.
+  const uint64_t currentTime = getMicros64();
+
+  ISRdata.pulseCounter          += delta;
+  ISRdata.pulseTotalCounter     += delta;
+  ISRdata.pulseTime              = (currentTime - ISRdata.currentStableStartTime) / delta;
+  ISRdata.currentStableStartTime = currentTime;
+}
+
+#endif // if FEATURE_PULSE_PCNT
+
 #ifdef PULSE_STATISTIC
 
 void Internal_GPIO_pulseHelper::updateStatisticalCounters(int par1) {
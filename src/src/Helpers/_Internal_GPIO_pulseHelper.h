@@ -32,6 +32,19 @@
 #define MODE_INTERRUPT_MASK     0x03
 
 
+#if FEATURE_PULSE_PCNT
+# include <driver/pulse_cnt.h>
+
+// PCNT counter is reset to 0 when reaching this value.
+// The counter must be read before it has counted this many edges again.
+# define PULSE_PCNT_HIGH_LIMIT     32767
+
+// Max. glitch filter duration supported by the PCNT peripheral (1023 APB clock cycles)
+# ifndef PULSE_PCNT_MAX_GLITCH_NS
+#  define PULSE_PCNT_MAX_GLITCH_NS  12000
+# endif // ifndef PULSE_PCNT_MAX_GLITCH_NS
+#endif // if FEATURE_PULSE_PCNT
+
 #if ESP_IDF_VERSION_MAJOR >= 5
 #include <atomic>
 
@@ -123,6 +136,16 @@ struct Internal_GPIO_pulseHelper {
     uint8_t         gpio                = -1;
     uint8_t         pullupPinMode       = INPUT_PULLUP;
     GPIOtriggerMode interruptPinMode    = GPIOtriggerMode::Change;
+#if FEATURE_PULSE_PCNT
+
+    // Count edges using the PCNT peripheral instead of an interrupt.
+    // Only for edge modes with a debounce time the PCNT glitch filter can apply.
+    bool usePCNT = false;
+
+    bool debounceFitsPCNT() const {
+      return debounceTime_micros * 1000 <= PULSE_PCNT_MAX_GLITCH_NS;
+    }
+#endif // if FEATURE_PULSE_PCNT
   };
 
 
@@ -150,6 +173,9 @@ struct Internal_GPIO_pulseHelper {
   // Typically from PLUGIN_FIFTY_PER_SECOND or PLUGIN_TASKTIMER_IN
   void doPulseStepProcessing(int pStep);
 
+  // Whether edges are counted by the PCNT peripheral.
+  bool usingPCNT() const;
+
   pulseModeData_t pulseModeData;
 
 private:
@@ -170,6 +196,19 @@ private:
   static void ISR_edgeCheck(Internal_GPIO_pulseHelper *self);
   static void ISR_pulseCheck(Internal_GPIO_pulseHelper *self);
 
+#if FEATURE_PULSE_PCNT
+  bool initPCNT();
+
+  void deinitPCNT();
+
+  // Add the edges counted by the PCNT peripheral since the last call to the counters.
+  void readPCNT();
+
+  pcnt_unit_handle_t    _pcntUnit    = nullptr;
+  pcnt_channel_handle_t _pcntChannel = nullptr;
+  int                   _pcntLastCount{};
+#endif // if FEATURE_PULSE_PCNT
+
 
 
 public:
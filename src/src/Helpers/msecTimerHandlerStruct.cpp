@@ -70,6 +70,12 @@
     return item._id;
   }
 
+  unsigned long msecTimerHandlerStruct::peekNextId() const {
+    if (_timer_ids.empty() || (timePassedSince(_timer_ids.front()._timer) < 0)) {
+      return 0;
+    }
+    return _timer_ids.front()._id;
+  }
 
   bool msecTimerHandlerStruct::getTimerForId(unsigned long id, unsigned long& timer) const {
     for (auto it = _timer_ids.begin(); it != _timer_ids.end(); ++it) {
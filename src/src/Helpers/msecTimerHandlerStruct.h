@@ -22,6 +22,10 @@ struct msecTimerHandlerStruct {
   // Return 0 if no item has reached timeout moment.
   unsigned long getNextId(unsigned long& timer);
 
+  // Return the ID of the first item if its timeout has been reached, without removing it.
+  // Return 0 if no item has reached timeout moment.
+  unsigned long peekNextId() const;
+
   // Check if a give ID is scheduled and if so, return the set timer.
   // N.B. the ID is the mixed ID.
   bool   getTimerForId(unsigned long  id,
@@ -19,6 +19,16 @@
 #   endif // if ESP_IDF_VERSION_MAJOR < 5
 #  endif // ifndef P002_ADC_ATTEN_MAX
 
+P002_data_struct::~P002_data_struct()
+{
+#  if FEATURE_ADC_CONTINUOUS
+
+  if (_continuousPin >= 0) {
+    ADC_continuous_removePin(_continuousPin);
+  }
+#  endif // if FEATURE_ADC_CONTINUOUS
+}
+
 void P002_data_struct::init(struct EventStruct *event)
 {
   _sampleMode = P002_OVERSAMPLING;
@@ -31,9 +41,32 @@ void P002_data_struct::init(struct EventStruct *event)
   _useFactoryCalibration = useFactoryCalibration(event);
   _attenuation           = getAttenuation(event);
 
-  // Initialize attenuation and perform read
-  // This way there is less chance of a big difference between 1st read and any next reads
-  analog_read();
+  bool continuous = false;
+  #   if FEATURE_ADC_CONTINUOUS
+
+  if (_continuousPin >= 0) {
+    ADC_continuous_removePin(_continuousPin);
+    _continuousPin = -1;
+  }
+  _continuousSamples.clear();
+  _continuousMode = P002_CONTINUOUS;
+
+  if (_continuousMode != P002_CONTINUOUS_OFF) {
+    if (ADC_continuous_addPin(_pin_analogRead, _attenuation)) {
+      _continuousPin = _pin_analogRead;
+      continuous     = true;
+    } else {
+      // Fall back to one-shot reads
+      _continuousMode = P002_CONTINUOUS_OFF;
+    }
+  }
+  #   endif // if FEATURE_ADC_CONTINUOUS
+
+  if (!continuous) {
+    // Initialize attenuation and perform read
+    // This way there is less chance of a big difference between 1st read and any next reads
+    analog_read();
+  }
   #  endif // ifdef ESP32
 
   if (P002_CALIBRATION_ENABLED) {
@@ -177,6 +210,25 @@ void P002_data_struct::webformLoad(struct EventStruct *event)
     selector.addFormSelector(F("Oversampling"), F("oversampling"), P002_OVERSAMPLING);
   }
 
+#  if FEATURE_ADC_CONTINUOUS
+  {
+    const __FlashStringHelper *outputOptions[] = {
+      F("Off"),
+      F("Mean"),
+      F("AC RMS")
+    };
+    const int outputOptionValues[] = {
+      P002_CONTINUOUS_OFF,
+      P002_CONTINUOUS_MEAN,
+      P002_CONTINUOUS_RMS_AC
+    };
+    constexpr int nrOptions = NR_ELEMENTS(outputOptionValues);
+    const FormSelectorOptions selector(nrOptions, outputOptions, outputOptionValues);
+    selector.addFormSelector(F("Continuous Sampling"), F("cont"), P002_CONTINUOUS);
+    addFormNote(F("Sample ADC1 pins continuously at kHz rate. Do not mix with one-shot reads of other ADC1 pins"));
+  }
+#  endif // if FEATURE_ADC_CONTINUOUS
+
 #  ifdef ESP32
   addFormSubHeader(F("Factory Calibration"));
   addFormCheckBox(F("Apply Factory Calibration"), F("fac_cal"), P002_APPLY_FACTORY_CALIB, !hasADC_factory_calibration());
@@ -833,6 +885,9 @@ String P002_data_struct::webformSave(struct EventStruct *event)
   #  ifdef ESP32
   P002_APPLY_FACTORY_CALIB = isFormItemChecked(F("fac_cal"));
   P002_ATTENUATION         = getFormItemInt(F("attn"));
+  #   if FEATURE_ADC_CONTINUOUS
+  P002_CONTINUOUS = getFormItemInt(F("cont"), P002_CONTINUOUS_OFF);
+  #   endif // if FEATURE_ADC_CONTINUOUS
   #  endif // ifdef ESP32
 
   // Map the input "point" values to the nearest int.
@@ -882,6 +937,13 @@ String P002_data_struct::webformSave(struct EventStruct *event)
 void P002_data_struct::takeSample()
 {
   if (_sampleMode == P002_USE_CURENT_SAMPLE) { return; }
+#  if FEATURE_ADC_CONTINUOUS
+
+  if (_continuousMode != P002_CONTINUOUS_OFF) {
+    takeContinuousSamples();
+    return;
+  }
+#  endif // if FEATURE_ADC_CONTINUOUS
   const int raw = analog_read();
 
 #  if FEATURE_PLUGIN_STATS
@@ -906,8 +968,16 @@ void P002_data_struct::takeSample()
 }
 
 bool P002_data_struct::getValue(float& float_value,
-                                int  & raw_value) const
+                                int  & raw_value)
 {
+#  if FEATURE_ADC_CONTINUOUS
+
+  if ((_continuousMode != P002_CONTINUOUS_OFF) && (_sampleMode != P002_USE_BINNING)) {
+    // Include the samples collected since the last call to takeSample()
+    takeContinuousSamples();
+    return getContinuousValue(float_value, raw_value);
+  }
+#  endif // if FEATURE_ADC_CONTINUOUS
   bool mustTakeSample = false;
 
   switch (_sampleMode)
@@ -937,7 +1007,23 @@ bool P002_data_struct::getValue(float& float_value,
     return false;
   }
 
+#  if FEATURE_ADC_CONTINUOUS
+
+  if (_continuousMode != P002_CONTINUOUS_OFF) {
+    // Pin cannot be read in one-shot mode while sampled in continuous mode
+    ADC_reduce_t samples;
+    ADC_continuous_poll();
+
+    if (!ADC_continuous_take(_pin_analogRead, samples)) {
+      return false;
+    }
+    raw_value = lround(samples.getMean());
+  } else {
+    raw_value = analog_read();
+  }
+#  else // if FEATURE_ADC_CONTINUOUS
   raw_value = analog_read();
+#  endif // if FEATURE_ADC_CONTINUOUS
 #  if FEATURE_PLUGIN_STATS
 
   PluginStats *stats = getPluginStats(0);
@@ -1000,10 +1086,19 @@ void P002_data_struct::reset()
 #  else // ifndef LIMIT_BUILD_SIZE
   resetOversampling();
 #  endif // ifndef LIMIT_BUILD_SIZE
+#  if FEATURE_ADC_CONTINUOUS
+  _continuousSamples.clear();
+#  endif // if FEATURE_ADC_CONTINUOUS
 }
 
 uint32_t P002_data_struct::getOversamplingCount() const
 {
+#  if FEATURE_ADC_CONTINUOUS
+
+  if (_continuousMode != P002_CONTINUOUS_OFF) {
+    return _continuousSamples.count;
+  }
+#  endif // if FEATURE_ADC_CONTINUOUS
   return OverSampling.getCount();
 }
 
@@ -1033,6 +1128,71 @@ bool P002_data_struct::getOversamplingValue(float& float_value, int& raw_value)
   return false;
 }
 
+#  if FEATURE_ADC_CONTINUOUS
+
+void P002_data_struct::takeContinuousSamples()
+{
+  ADC_reduce_t samples;
+
+  ADC_continuous_poll();
+
+  if (!ADC_continuous_take(_pin_analogRead, samples)) { return; }
+
+#   if FEATURE_PLUGIN_STATS
+  PluginStats *stats = getPluginStats(0);
+
+  if (stats != nullptr) {
+    stats->trackPeak(samples.minValue);
+    stats->trackPeak(samples.maxValue);
+  }
+#   endif // if FEATURE_PLUGIN_STATS
+
+  if (_sampleMode == P002_USE_BINNING) {
+    // Each reduced block counts as a single sample in a bin
+    addBinningValue(lround(samples.getMean()));
+  } else {
+    _continuousSamples.merge(samples);
+  }
+}
+
+bool P002_data_struct::getContinuousValue(float& float_value, int& raw_value) const
+{
+  const ADC_reduce_t& samples = _continuousSamples;
+
+  if (samples.count == 0) {
+    return false;
+  }
+
+  const float mean = samples.getMean();
+
+  if (_continuousMode == P002_CONTINUOUS_RMS_AC) {
+    const float rms = samples.getRMS_AC();
+    raw_value = lround(rms);
+
+    // The conversion has an offset and may not be linear,
+    // so only its slope around the mean is applied to the RMS value.
+    float_value = fabs(convertContinuousValue(mean + rms) - convertContinuousValue(mean));
+  } else {
+    raw_value   = lround(mean);
+    float_value = convertContinuousValue(mean);
+  }
+  return true;
+}
+
+float P002_data_struct::convertContinuousValue(float value) const
+{
+  if (_useFactoryCalibration) {
+    value = applyADCFactoryCalibration(value, _attenuation);
+  }
+  value = applyCalibration(value);
+#   ifndef LIMIT_BUILD_SIZE
+  value = applyMultiPointInterpolation(value);
+#   endif // ifndef LIMIT_BUILD_SIZE
+  return value;
+}
+
+#  endif // if FEATURE_ADC_CONTINUOUS
+
 #  ifndef LIMIT_BUILD_SIZE
 
 int P002_data_struct::getBinIndex(float currentValue) const
@@ -1161,10 +1321,26 @@ float P002_data_struct::getCurrentValue(struct EventStruct *event, int& raw_valu
 
   auto att = getAttenuation(event);
 
-  analogSetPinAttenuation(pin, static_cast<adc_attenuation_t>(att));
-  #  endif // ifdef ESP32
+  #   if FEATURE_ADC_CONTINUOUS
 
+  if (P002_CONTINUOUS != P002_CONTINUOUS_OFF) {
+    // Pin cannot be read in one-shot mode while sampled in continuous mode.
+    // Only peek, so the samples are still collected by the running task.
+    ADC_reduce_t samples;
+    ADC_continuous_poll();
+    ADC_continuous_peek(pin, samples);
+    raw_value = lround(samples.getMean());
+  } else {
+    analogSetPinAttenuation(pin, static_cast<adc_attenuation_t>(att));
+    raw_value = espeasy_analogRead(pin);
+  }
+  #   else // if FEATURE_ADC_CONTINUOUS
+  analogSetPinAttenuation(pin, static_cast<adc_attenuation_t>(att));
+  raw_value = espeasy_analogRead(pin);
+  #   endif // if FEATURE_ADC_CONTINUOUS
+  #  else // ifdef ESP32
   raw_value = espeasy_analogRead(pin);
+  #  endif // ifdef ESP32
 
   #  ifdef ESP32
 
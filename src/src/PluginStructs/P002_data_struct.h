@@ -3,6 +3,7 @@
 
 #include "../../_Plugin_Helper.h"
 
+#include "../Helpers/Hardware_ADC_continuous.h"
 #include "../Helpers/OversamplingHelper.h"
 
 #ifdef USES_P002
@@ -36,11 +37,18 @@
 
 # define P002_MULTIPOINT_ENABLED  PCONFIG(4)
 # define P002_NR_MULTIPOINT_ITEMS PCONFIG(5)
+# if FEATURE_ADC_CONTINUOUS
+#  define P002_CONTINUOUS         PCONFIG(6)
+# endif // if FEATURE_ADC_CONTINUOUS
 
 # define P002_USE_CURENT_SAMPLE   0
 # define P002_USE_OVERSAMPLING    1
 # define P002_USE_BINNING         2
 
+# define P002_CONTINUOUS_OFF      0
+# define P002_CONTINUOUS_MEAN     1
+# define P002_CONTINUOUS_RMS_AC   2
+
 // FIXME TD-er: Must test if HTML POST on ESP8266 will not take too much ram on save
 # define P002_MAX_NR_MP_ITEMS     64
 
@@ -105,7 +113,7 @@ struct P002_binningRange {
 
 struct P002_data_struct : public PluginTaskData_base {
   P002_data_struct()          = default;
-  virtual ~P002_data_struct() = default;
+  virtual ~P002_data_struct();
 
   void init(struct EventStruct *event);
 
@@ -174,8 +182,9 @@ public:
 
   void          takeSample();
 
+  // N.B. In continuous mode this collects the pending samples first.
   bool          getValue(float& float_value,
-                         int  & raw_value) const;
+                         int  & raw_value);
 
   void          reset();
 
@@ -190,6 +199,23 @@ private:
   bool getOversamplingValue(float& float_value,
                             int  & raw_value) const;
 
+# if FEATURE_ADC_CONTINUOUS
+
+  // Collect the samples taken in continuous mode since the last call.
+  void takeContinuousSamples();
+
+  // Only uses the samples already collected by takeContinuousSamples().
+  bool getContinuousValue(float& float_value,
+                          int  & raw_value) const;
+
+private:
+
+  // Factory calibration, 2-point calibration and multipoint processing of a raw ADC value.
+  float convertContinuousValue(float value) const;
+
+public:
+# endif // if FEATURE_ADC_CONTINUOUS
+
 private:
 
 # ifndef LIMIT_BUILD_SIZE
@@ -266,6 +292,14 @@ private:
 
   uint8_t _sampleMode = P002_USE_CURENT_SAMPLE;
 
+# if FEATURE_ADC_CONTINUOUS
+  uint8_t      _continuousMode = P002_CONTINUOUS_OFF;
+
+  // Pin registered for continuous mode, -1 = none
+  int          _continuousPin = -1;
+  ADC_reduce_t _continuousSamples;
+# endif // if FEATURE_ADC_CONTINUOUS
+
   uint8_t _nrDecimals = 0;
 # ifndef LIMIT_BUILD_SIZE
   uint8_t _nrMultiPointItems = 0;
@@ -25,6 +25,9 @@
 # define P003_IDX_COUNTERTYPE    1
 # define P003_IDX_MODETYPE       2
 # define P003_IDX_IGNORE_ZERO    3
+# if FEATURE_PULSE_PCNT
+#  define P003_IDX_USE_PCNT      4
+# endif // if FEATURE_PULSE_PCNT
 
 // values for WEBFORM Counter Types
 # define P003_CT_INDEX_COUNTER              0
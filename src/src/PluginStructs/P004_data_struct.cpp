@@ -7,10 +7,12 @@ P004_data_struct::P004_data_struct(
   int8_t      pin_rx,
   int8_t      pin_tx,
   uint8_t     res,
-  bool        scanOnInit) :
+  bool        scanOnInit,
+  bool        sharedConversion) :
   _taskIndex(taskIndex),
   _gpio_rx(pin_rx), _gpio_tx(pin_tx),
-  _res(res), _scanOnInit(scanOnInit)
+  _res(res), _scanOnInit(scanOnInit),
+  _sharedConversion(sharedConversion)
 {
   _timer            = millis();
   _measurementStart = _timer;
@@ -24,6 +26,14 @@ P004_data_struct::P004_data_struct(
   }
 }
 
+P004_data_struct::~P004_data_struct()
+{
+  if (_sharedConversion) {
+    // The task may be restarted with another resolution, so don't share a conversion started with the old settings.
+    Dallas_bus_invalidate_conversion(_gpio_rx);
+  }
+}
+
 bool P004_data_struct::sensorAddressSet() const
 {
   for (uint8_t i = 0; i < VARS_PER_TASK; ++i) {
@@ -98,20 +108,15 @@ bool P004_data_struct::initiate_read() {
     use_res = max(use_res, _sensors[i].actual_res);
   }
 
+  if (_sharedConversion) {
+    return initiate_shared_read(use_res);
+  }
+
   for (uint8_t i = 0; i < VARS_PER_TASK; ++i) {
     if (_sensors[i].initiate_read(_gpio_rx, _gpio_tx, _res)) {
       if (!measurement_active()) {
         // Set the timer right after initiating the first sensor
-
-
-        /*********************************************************************************************\
-        *  Dallas Start Temperature Conversion, expected max duration:
-        *    9 bits resolution ->  93.75 ms
-        *   10 bits resolution -> 187.5 ms
-        *   11 bits resolution -> 375 ms
-        *   12 bits resolution -> 750 ms
-        \*********************************************************************************************/
-        _timer = millis() + (800 / (1 << (12 - use_res))); // Use actual sensor resolution
+        _timer = millis() + Dallas_conversion_time(use_res); // Use actual sensor resolution
       }
       _sensors[i].measurementActive = true;
     } else {
@@ -130,14 +135,62 @@ bool P004_data_struct::initiate_read() {
   return measurement_active();
 }
 
+bool P004_data_struct::initiate_shared_read(uint8_t use_res) {
+  bool mustInit       = false;
+  bool sensorPrepared = false;
+
+  for (uint8_t i = 0; i < VARS_PER_TASK; ++i) {
+    if (_sensors[i].prepare_read(_gpio_rx, _gpio_tx, _res)) {
+      sensorPrepared = true;
+    } else if (_sensors[i].addr != 0) {
+      ++_sensors[i].start_read_failed;
+
+      if (_scanOnInit && (_sensors[i].start_read_failed > (_sensors[i].reinit_count * 10))) {
+        _sensors[i].reinit_count++;
+        mustInit = true;
+      }
+    }
+  }
+
+  if (mustInit) {
+    Dallas_bus_invalidate_conversion(_gpio_rx);
+    init();
+    return false;
+  }
+
+  unsigned long ready_time = 0;
+
+  if (!sensorPrepared || !Dallas_bus_start_conversion(_gpio_rx, _gpio_tx, use_res, ready_time)) {
+    return false;
+  }
+  _timer = ready_time;
+
+  for (uint8_t i = 0; i < VARS_PER_TASK; ++i) {
+    if ((_sensors[i].addr != 0) && !_sensors[i].lastReadError) {
+      _sensors[i].measurementActive = true;
+    }
+  }
+  return measurement_active();
+}
+
 bool P004_data_struct::collect_values() {
-  bool success = false;
+  bool success   = false;
+  bool readError = false;
 
   for (uint8_t i = 0; i < VARS_PER_TASK; ++i) {
+    const bool active = _sensors[i].measurementActive && (_sensors[i].addr != 0);
+
     if (_sensors[i].collect_value(_gpio_rx, _gpio_tx)) {
       success = true;
+    } else if (active) {
+      readError = true;
     }
   }
+
+  if (_sharedConversion && readError) {
+    // A sensor may have reset or missed the conversion, so let the next task start a new one.
+    Dallas_bus_invalidate_conversion(_gpio_rx);
+  }
   return success;
 }
 
@@ -33,12 +33,15 @@ struct P004_data_struct : public PluginTaskData_base {
 
   // @param pin  The GPIO pin used to communicate to the Dallas sensors in this task
   // @param res  The resolution of the Dallas sensor(s) used in this task
+  // @param sharedConversion  Start conversions for all sensors on the bus at once,
+  //                          shared with other tasks using the same pin.
   P004_data_struct(taskIndex_t taskIndex,
                    int8_t      pin_rx,
                    int8_t      pin_tx,
                    uint8_t     res,
-                   bool        scanOnInit);
-  virtual ~P004_data_struct() = default;
+                   bool        scanOnInit,
+                   bool        sharedConversion = false);
+  virtual ~P004_data_struct();
 
   void init();
 
@@ -89,6 +92,9 @@ struct P004_data_struct : public PluginTaskData_base {
 
 private:
 
+  // Start a single conversion for all sensors on the bus, shared with other tasks on the same pin.
+  bool initiate_shared_read(uint8_t use_res);
+
   // Do not set the _timer to 0, since it may cause issues
   // if this object is created (settings edited or task enabled)
   // while the node is up some time between 24.9 and 49.7 days.
@@ -100,6 +106,7 @@ private:
   int8_t            _gpio_tx;
   uint8_t           _res;
   bool              _scanOnInit;
+  bool              _sharedConversion;
 };
 
 #endif // ifdef USES_P004
@@ -47,6 +47,13 @@ P020_Task::~P020_Task() {
     delete ser2netSerial;
     ser2netSerial = nullptr;
   }
+  # if FEATURE_SERIAL_FRAME_READER
+
+  if (serialReader != nullptr) {
+    delete serialReader;
+    serialReader = nullptr;
+  }
+  # endif // if FEATURE_SERIAL_FRAME_READER
 }
 
 bool P020_Task::serverActive(WiFiServer *server) {
@@ -204,6 +211,9 @@ void P020_Task::serialBegin(const ESPEasySerialPort port, int16_t rxPin, int16_t
       # elif defined(ESP32)
       ser2netSerial->begin(baud, config);
       # endif // if defined(ESP8266)
+      # if FEATURE_SERIAL_FRAME_READER
+      serialReader = SerialFrameReader::create();
+      # endif // if FEATURE_SERIAL_FRAME_READER
       # ifndef BUILD_NO_DEBUG
       addLog(LOG_LEVEL_DEBUG, F("Ser2Net: Serial opened"));
       # endif // ifndef BUILD_NO_DEBUG
@@ -216,6 +226,13 @@ void P020_Task::serialEnd() {
     delete ser2netSerial;
     clearBuffer();
     ser2netSerial = nullptr;
+    # if FEATURE_SERIAL_FRAME_READER
+
+    if (nullptr != serialReader) {
+      delete serialReader;
+      serialReader = nullptr;
+    }
+    # endif // if FEATURE_SERIAL_FRAME_READER
     # ifndef BUILD_NO_DEBUG
     addLog(LOG_LEVEL_DEBUG, F("Ser2Net: Serial closed"));
     # endif // ifndef BUILD_NO_DEBUG
@@ -298,20 +315,20 @@ void P020_Task::handleSerialIn(struct EventStruct *event) {
   char ch;
 
   do {
-    if (ser2netSerial->available()) {
+    if (serialAvailable()) {
       if ((serial_processing != P020_Events::P1WiFiGateway) // P1 handling without this check
           && (serial_buffer.length() > static_cast<size_t>(P020_RX_BUFFER))) {
         # ifndef BUILD_NO_DEBUG
         addLog(LOG_LEVEL_DEBUG, F("Ser2Net: Error: Buffer overflow, discarded input."));
         # endif // ifndef BUILD_NO_DEBUG
-        ser2netSerial->read();
+        serialRead();
       }
       else {
         if (_ledEnabled) {
           digitalWrite(_ledPin, _ledInverted ? 0 : 1);
         }
 
-        ch = static_cast<char>(ser2netSerial->read());
+        ch = static_cast<char>(serialRead());
 
         if (serial_processing == P020_Events::P1WiFiGateway) {
           done = handleP1Char(ch);
@@ -368,12 +385,32 @@ void P020_Task::handleSerialIn(struct EventStruct *event) {
 
 void P020_Task::discardSerialIn() {
   if (nullptr != ser2netSerial) {
-    while (ser2netSerial->available()) {
-      ser2netSerial->read();
+    while (serialAvailable()) {
+      serialRead();
     }
   }
 }
 
+int P020_Task::serialAvailable() {
+  # if FEATURE_SERIAL_FRAME_READER
+
+  if (nullptr != serialReader) {
+    return serialReader->available(*ser2netSerial);
+  }
+  # endif // if FEATURE_SERIAL_FRAME_READER
+  return ser2netSerial->available();
+}
+
+int P020_Task::serialRead() {
+  # if FEATURE_SERIAL_FRAME_READER
+
+  if (nullptr != serialReader) {
+    return serialReader->read(*ser2netSerial);
+  }
+  # endif // if FEATURE_SERIAL_FRAME_READER
+  return ser2netSerial->read();
+}
+
 // We can also use the rules engine for local control!
 void P020_Task::rulesEngine(const String& message) {
   if (!Settings.UseRules || message.isEmpty() || (P020_Events::None == serial_processing)) { return; }
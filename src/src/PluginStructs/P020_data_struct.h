@@ -7,6 +7,10 @@
 
 # include <ESPeasySerial.h>
 
+# if FEATURE_SERIAL_FRAME_READER
+#  include "../Helpers/SerialFrameReader.h"
+# endif // if FEATURE_SERIAL_FRAME_READER
+
 # ifndef PLUGIN_020_DEBUG
   #  define PLUGIN_020_DEBUG            false // when true: extra logging in serial out !?!?!
 # endif // ifndef PLUGIN_020_DEBUG
@@ -120,6 +124,10 @@ struct P020_Task : public PluginTaskData_base {
   void                handleSerialIn(struct EventStruct *event);
   void                handleClientIn(struct EventStruct *event);
   void                discardSerialIn();
+
+  // Serial port access via the bulk read buffer, when allocated
+  int                 serialAvailable();
+  int                 serialRead();
   void                rulesEngine(const String& message);
 
   bool                isInit() const;
@@ -167,6 +175,9 @@ struct P020_Task : public PluginTaskData_base {
   String         net_buffer;
   int            checkI            = 0;
   ESPeasySerial *ser2netSerial     = nullptr;
+  # if FEATURE_SERIAL_FRAME_READER
+  SerialFrameReader *serialReader = nullptr;
+  # endif // if FEATURE_SERIAL_FRAME_READER
   P020_Events    serial_processing = P020_Events::None;
   taskIndex_t    _taskIndex        = INVALID_TASK_INDEX;
   bool           handleMultiLine   = false;
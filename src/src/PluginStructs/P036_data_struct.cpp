@@ -2026,10 +2026,47 @@ bool P036_data_struct::display_wifibars() {
 void P036_data_struct::update_display()
 {
   if (isInitialized()) {
+    # if P036_FEATURE_DISPLAY_STATS
+    const uint64_t start = getMicros64();
+    # endif // if P036_FEATURE_DISPLAY_STATS
     display->display();
+    # if P036_FEATURE_DISPLAY_STATS
+
+    if (display->lastDisplayBytes > 0) {
+      const uint32_t duration = usecPassedSince(start);
+      ++displayUpdates;
+      displayUpdateBytes     += display->lastDisplayBytes;
+      displayUpdateTime_usec += duration;
+
+      if (duration > displayUpdateMax_usec) {
+        displayUpdateMax_usec = duration;
+      }
+    }
+    # endif // if P036_FEATURE_DISPLAY_STATS
   }
 }
 
+# if P036_FEATURE_DISPLAY_STATS
+void P036_data_struct::web_show_stats() const {
+  addFormSubHeader(F("Statistics"));
+  addRowLabel(F("Display updates"));
+  addHtmlInt(displayUpdates);
+
+  if (displayUpdates > 0) {
+    addRowLabel(F("Avg. update duration"));
+    addHtmlFloat(static_cast<float>(displayUpdateTime_usec / displayUpdates) / 1000.0f, 2);
+    addUnit(F("ms"));
+    addRowLabel(F("Max. update duration"));
+    addHtmlFloat(static_cast<float>(displayUpdateMax_usec) / 1000.0f, 2);
+    addUnit(F("ms"));
+    addRowLabel(F("Avg. bytes per update"));
+    addHtmlInt(displayUpdateBytes / displayUpdates);
+    addUnit(F("byte"));
+  }
+}
+
+# endif // if P036_FEATURE_DISPLAY_STATS
+
 void P036_data_struct::P036_JumpToPage(struct EventStruct *event, uint8_t nextFrame)
 {
   if (!isInitialized()) {
@@ -33,6 +33,13 @@
 # ifndef P036_FEATURE_ALIGN_PREVIEW
 #  define P036_FEATURE_ALIGN_PREVIEW     1
 # endif // ifdef P036_FEATURE_ALIGN_PREVIEW
+# ifndef P036_FEATURE_DISPLAY_STATS
+#  ifdef P036_LIMIT_BUILD_SIZE
+#   define P036_FEATURE_DISPLAY_STATS    0 // Disabled for limited builds
+#  else // ifdef P036_LIMIT_BUILD_SIZE
+#   define P036_FEATURE_DISPLAY_STATS    1 // Show display update duration and bytes sent
+#  endif // ifdef P036_LIMIT_BUILD_SIZE
+# endif // ifndef P036_FEATURE_DISPLAY_STATS
 
 # if defined(ESP8266_1M) && defined(P036_FEATURE_ALIGN_PREVIEW) && P036_FEATURE_ALIGN_PREVIEW
 #  undef P036_FEATURE_ALIGN_PREVIEW
@@ -494,6 +501,10 @@ public:
   bool web_show_values();
   # endif // if P036_FEATURE_DISPLAY_PREVIEW
 
+  # if P036_FEATURE_DISPLAY_STATS
+  void web_show_stats() const;
+  # endif // if P036_FEATURE_DISPLAY_STATS
+
   // Instantiate display here - does not work to do this within the INIT call
   OLEDDisplay *display = nullptr;
 
@@ -517,6 +528,14 @@ public:
   uint8_t  DebounceCounter = 0;     // debounce counter
   uint8_t  RepeatCounter   = 0;     // Repeat delay counter when holding button pressed
   uint16_t displayTimer    = 0;     // counter for display OFF
+  # if P036_FEATURE_DISPLAY_STATS
+
+  // display updates, only counting updates that actually sent data to the display
+  uint32_t displayUpdates          = 0;
+  uint32_t displayUpdateBytes      = 0;
+  uint64_t displayUpdateTime_usec  = 0;
+  uint32_t displayUpdateMax_usec   = 0;
+  # endif // if P036_FEATURE_DISPLAY_STATS
   // frame header
   uint16_t       HeaderCount              = 0;
   eHeaderContent HeaderContent            = eHeaderContent::eSSID;
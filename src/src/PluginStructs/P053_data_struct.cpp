@@ -101,6 +101,13 @@ bool P053_data_struct::init() {
       delete _easySerial;
       _easySerial = nullptr;
     }
+    # if FEATURE_SERIAL_FRAME_READER
+
+    if (_serialReader != nullptr) {
+      delete _serialReader;
+      _serialReader = nullptr;
+    }
+    # endif // if FEATURE_SERIAL_FRAME_READER
 
     _easySerial = new (std::nothrow) ESPeasySerial(_port, _rxPin, _txPin, false, 96); // 96 Bytes buffer, enough for up to 3 packets.
   }
@@ -129,6 +136,11 @@ bool P053_data_struct::init() {
 
       _easySerial->begin(9600);
       _easySerial->flush();
+      # if FEATURE_SERIAL_FRAME_READER
+
+      // Room for 1 packet of the largest sensor type
+      _serialReader = SerialFrameReader::create(PMSx003_PACKET_BUFFER_SIZE);
+      # endif // if FEATURE_SERIAL_FRAME_READER
     }
 
     wakeSensor();
@@ -148,6 +160,13 @@ P053_data_struct::~P053_data_struct() {
     delete _easySerial;
     _easySerial = nullptr;
   }
+  # if FEATURE_SERIAL_FRAME_READER
+
+  if (_serialReader != nullptr) {
+    delete _serialReader;
+    _serialReader = nullptr;
+  }
+  # endif // if FEATURE_SERIAL_FRAME_READER
 }
 
 bool P053_data_struct::initialized() const
@@ -195,6 +214,36 @@ void P053_data_struct::SerialFlush() {
   }
 }
 
+int P053_data_struct::SerialAvailable() {
+  # if FEATURE_SERIAL_FRAME_READER
+
+  if (_serialReader != nullptr) {
+    return _serialReader->available(*_easySerial);
+  }
+  # endif // if FEATURE_SERIAL_FRAME_READER
+  return _easySerial->available();
+}
+
+int P053_data_struct::SerialPeek() {
+  # if FEATURE_SERIAL_FRAME_READER
+
+  if (_serialReader != nullptr) {
+    return _serialReader->peek(*_easySerial);
+  }
+  # endif // if FEATURE_SERIAL_FRAME_READER
+  return _easySerial->peek();
+}
+
+int P053_data_struct::SerialRead() {
+  # if FEATURE_SERIAL_FRAME_READER
+
+  if (_serialReader != nullptr) {
+    return _serialReader->read(*_easySerial);
+  }
+  # endif // if FEATURE_SERIAL_FRAME_READER
+  return _easySerial->read();
+}
+
 uint8_t P053_data_struct::packetSize() const {
   switch (_sensortype) {
     case PMSx003_type::PMS1003_5003_7003:    return PMS1003_5003_7003_SIZE;
@@ -222,26 +271,26 @@ bool P053_data_struct::packetAvailable()
     if (_packetPos < expectedSize) {
       // When there is enough data in the buffer, search through the buffer to
       // find header (buffer may be out of sync)
-      if (!_easySerial->available()) { return false; }
+      if (!SerialAvailable()) { return false; }
 
       if (_packetPos == 0) {
-        while ((_easySerial->peek() != PMSx003_SIG1) && _easySerial->available()) {
-          _easySerial->read(); // Read until the buffer starts with the
+        while ((SerialPeek() != PMSx003_SIG1) && SerialAvailable()) {
+          SerialRead(); // Read until the buffer starts with the
           // first uint8_t of a message, or buffer
           // empty.
         }
 
-        if (_easySerial->peek() == PMSx003_SIG1) {
-          _packet[_packetPos++] = _easySerial->read();
+        if (SerialPeek() == PMSx003_SIG1) {
+          _packet[_packetPos++] = SerialRead();
         }
       }
 
       if (_packetPos > 0) {
         while (_packetPos < expectedSize) {
-          if (_easySerial->available() == 0) {
+          if (SerialAvailable() == 0) {
             return false;
           } else {
-            _packet[_packetPos++] = _easySerial->read();
+            _packet[_packetPos++] = SerialRead();
           }
         }
       }
@@ -11,6 +11,10 @@
 
 # include <ESPeasySerial.h>
 
+# if FEATURE_SERIAL_FRAME_READER
+#  include "../Helpers/SerialFrameReader.h"
+# endif // if FEATURE_SERIAL_FRAME_READER
+
 // Can be unset for memory-tight  builds to remove support for the PMSx003ST and PMS2003/PMS3003 sensor models
 // Difference in build size is roughly 4k
 # define PLUGIN_053_ENABLE_EXTRA_SENSORS
@@ -164,6 +168,11 @@ private:
 
   void    SerialFlush();
 
+  // Serial port access via the bulk read buffer, when allocated
+  int     SerialAvailable();
+  int     SerialPeek();
+  int     SerialRead();
+
   uint8_t packetSize() const;
 
 public:
@@ -227,6 +236,9 @@ public:
 private:
 
   ESPeasySerial          *_easySerial = nullptr;
+  # if FEATURE_SERIAL_FRAME_READER
+  SerialFrameReader      *_serialReader = nullptr;
+  # endif // if FEATURE_SERIAL_FRAME_READER
   uint8_t                 _packet[PMSx003_PACKET_BUFFER_SIZE]{};
   uint8_t                 _packetPos = 0;
   const taskIndex_t       _taskIndex = INVALID_TASK_INDEX;
@@ -24,37 +24,87 @@ uint8_t P073_getDefaultDigits(uint8_t displayModel,
   return bufLen;
 }
 
+# if P073_EXTRA_FONTS
+const char P073_specialChars[] PROGMEM = " -^=/_%@.,;:+*#!?'\"<>\\()|";
+const char P073_chnorux[] PROGMEM      = "CHNORUX";
+
+// Glyph cache: font position + 1 per printable character per fontset, 0 = not yet looked up.
+// Allocated on first use, as scrolling text and clock updates look up the same characters over and over.
+#  define P073_GLYPH_CACHE_FONTSETS 4
+#  define P073_GLYPH_CACHE_CHARS    96 // ' ' .. 0x7F
+uint8_t *P073_glyphCache = nullptr;
+
+/**
+ * Index of character in a PROGMEM string, -1 if not found
+ */
+int P073_indexOf_P(const char *str_P, char character) {
+  if (character == '\0') { return -1; }
+  const char *found = strchr_P(str_P, character);
+
+  return found == nullptr ? -1 : found - str_P;
+}
+
+# endif // if P073_EXTRA_FONTS
+
 /**
  * Maps an ASCII character to a generic 7-segment usable smaller characterset,
  * for easy mapping to different font-sets, see P073_getFontChar()
  */
 uint8_t P073_mapCharToFontPosition(char    character,
                                    uint8_t fontset) {
+  # if P073_EXTRA_FONTS
+  const uint8_t cacheIndex = static_cast<uint8_t>(character) - ' ';
+
+  if ((cacheIndex >= P073_GLYPH_CACHE_CHARS) || (fontset >= P073_GLYPH_CACHE_FONTSETS)) {
+    return P073_lookupFontPosition(character, fontset);
+  }
+
+  if (nullptr == P073_glyphCache) {
+    P073_glyphCache = new (std::nothrow) uint8_t[P073_GLYPH_CACHE_FONTSETS * P073_GLYPH_CACHE_CHARS]();
+
+    if (nullptr == P073_glyphCache) {
+      return P073_lookupFontPosition(character, fontset);
+    }
+  }
+  uint8_t& cached = P073_glyphCache[fontset * P073_GLYPH_CACHE_CHARS + cacheIndex];
+
+  if (cached == 0) {
+    cached = P073_lookupFontPosition(character, fontset) + 1;
+  }
+  return cached - 1;
+  # else // if P073_EXTRA_FONTS
+  return P073_lookupFontPosition(character, fontset);
+  # endif // if P073_EXTRA_FONTS
+}
+
+uint8_t P073_lookupFontPosition(char    character,
+                                uint8_t fontset) {
   uint8_t position = 10;
 
   # if P073_EXTRA_FONTS
-  const String specialChars = F(" -^=/_%@.,;:+*#!?'\"<>\\()|");
-  const String chnorux      = F("CHNORUX");
 
   switch (fontset)
   {
     case 1: // Siekoo
     case 2: // Siekoo with uppercase 'CHNORUX'
+    {
+      const int chnoruxIdx = (fontset == 2) ? P073_indexOf_P(P073_chnorux, character) : -1;
 
-      if ((fontset == 2) && (chnorux.indexOf(character) > -1)) {
-        position = chnorux.indexOf(character) + 35;
+      if (chnoruxIdx > -1) {
+        position = chnoruxIdx + 35;
       } else if (isDigit(character)) {
         position = character - '0';
       } else if (isAlpha(character)) {
         position = character - (isLowerCase(character) ? 'a' : 'A') + 42;
       } else {
-        const int idx = specialChars.indexOf(character);
+        const int idx = P073_indexOf_P(P073_specialChars, character);
 
         if (idx > -1) {
           position = idx + 10;
         }
       }
       break;
+    }
     case 3:  // dSEG7 (same table size as 7Dgt)
     default: // Original fontset (7Dgt)
   # endif // if P073_EXTRA_FONTS
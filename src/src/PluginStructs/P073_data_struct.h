@@ -210,6 +210,8 @@ uint8_t P073_getDefaultDigits(uint8_t displayModel,
                               uint8_t digits = 0);
 uint8_t P073_mapCharToFontPosition(char    character,
                                    uint8_t fontset);
+uint8_t P073_lookupFontPosition(char    character,
+                                uint8_t fontset);
 uint8_t P073_getFontChar(uint8_t index,
                          uint8_t fontset);
 int32_t P073_parse_7dfont(struct EventStruct *event,
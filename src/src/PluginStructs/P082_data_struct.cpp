@@ -205,6 +205,13 @@ P082_data_struct::~P082_data_struct() {
     delete easySerial;
     easySerial = nullptr;
   }
+  # if FEATURE_SERIAL_FRAME_READER
+
+  if (serialReader != nullptr) {
+    delete serialReader;
+    serialReader = nullptr;
+  }
+  # endif // if FEATURE_SERIAL_FRAME_READER
 }
 
 /*
@@ -238,6 +245,13 @@ bool P082_data_struct::init(
     delete easySerial;
     easySerial = nullptr;
   }
+  # if FEATURE_SERIAL_FRAME_READER
+
+  if (serialReader != nullptr) {
+    delete serialReader;
+    serialReader = nullptr;
+  }
+  # endif // if FEATURE_SERIAL_FRAME_READER
 
   # ifdef USE_SECOND_HEAP
   HeapSelectDram ephemeral;
@@ -249,6 +263,9 @@ bool P082_data_struct::init(
 
   if (easySerial != nullptr) {
     easySerial->begin(9600);
+    # if FEATURE_SERIAL_FRAME_READER
+    serialReader = SerialFrameReader::create();
+    # endif // if FEATURE_SERIAL_FRAME_READER
     wakeUp();
   }
 
@@ -275,12 +292,12 @@ bool P082_data_struct::loop() {
   bool completeSentence = false;
 
   if (easySerial != nullptr) {
-    int available           = easySerial->available();
+    int available           = serialAvailable();
     unsigned long startLoop = millis();
 
     while (available > 0 && timePassedSince(startLoop) < 10) {
       --available;
-      int c = easySerial->read();
+      int c = serialRead();
 
       if (c >= 0) {
 # ifdef P082_SEND_GPS_TO_LOG
@@ -303,9 +320,9 @@ bool P082_data_struct::loop() {
           while (!timeOutReached(timeout) && !done)
           {
             if (available == 0) {
-              available = easySerial->available();
+              available = serialAvailable();
             } else {
-              const int c = easySerial->read();
+              const int c = serialRead();
 
               if (c >= 0) {
                 switch (bytesRead)
@@ -357,16 +374,16 @@ bool P082_data_struct::loop() {
           free_string(_currentSentence);
 # endif // ifdef P082_SEND_GPS_TO_LOG
           completeSentence = true;
-          available        = easySerial->available();
+          available        = serialAvailable();
           _softwarePPS.setSentenceType(gps->getCurrentSentenceType(), available);
         } else {
           if (c == '$') {
-            available = easySerial->available();
+            available = serialAvailable();
             _softwarePPS.addStartOfSentence(available);
           }
 
           if (available == 0) {
-            available = easySerial->available();
+            available = serialAvailable();
           }
         }
       }
@@ -375,6 +392,27 @@ bool P082_data_struct::loop() {
   return completeSentence;
 }
 
+int P082_data_struct::serialAvailable() {
+  # if FEATURE_SERIAL_FRAME_READER
+
+  if (serialReader != nullptr) {
+    // Also counts the buffered bytes, so the software PPS still knows how much of the sentence is pending
+    return serialReader->available(*easySerial);
+  }
+  # endif // if FEATURE_SERIAL_FRAME_READER
+  return easySerial->available();
+}
+
+int P082_data_struct::serialRead() {
+  # if FEATURE_SERIAL_FRAME_READER
+
+  if (serialReader != nullptr) {
+    return serialReader->read(*easySerial);
+  }
+  # endif // if FEATURE_SERIAL_FRAME_READER
+  return easySerial->read();
+}
+
 bool P082_data_struct::hasFix(unsigned int maxAge_msec) {
   if (!isInitialized()) {
     return false;
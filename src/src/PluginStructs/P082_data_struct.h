@@ -7,6 +7,9 @@
 # include <TinyGPS++.h>
 # include <ESPeasySerial.h>
 # include "../Helpers/ModuloOversamplingHelper.h"
+# if FEATURE_SERIAL_FRAME_READER
+#  include "../Helpers/SerialFrameReader.h"
+# endif // if FEATURE_SERIAL_FRAME_READER
 
 # ifndef BUILD_NO_DEBUG
 #  define P082_SEND_GPS_TO_LOG
@@ -229,12 +232,19 @@ private:
   bool        writeToGPS(const uint8_t *data,
                          size_t         size);
 
+  // Serial port access via the bulk read buffer, when allocated
+  int         serialAvailable();
+  int         serialRead();
+
   static void pps_interrupt(P082_data_struct *self);
 
 public:
 
   TinyGPSPlus   *gps        = nullptr;
   ESPeasySerial *easySerial = nullptr;
+  # if FEATURE_SERIAL_FRAME_READER
+  SerialFrameReader *serialReader = nullptr;
+  # endif // if FEATURE_SERIAL_FRAME_READER
 
   ESPEASY_RULES_FLOAT_TYPE _last_lat{};
   ESPEASY_RULES_FLOAT_TYPE _last_lng{};
@@ -13,13 +13,16 @@
 
 
 P087_data_struct::~P087_data_struct() {
-  delete easySerial;
-  easySerial = nullptr;
+  reset();
 }
 
 void P087_data_struct::reset() {
   delete easySerial;
   easySerial = nullptr;
+  # if FEATURE_SERIAL_FRAME_READER
+  delete frameReader;
+  frameReader = nullptr;
+  # endif // if FEATURE_SERIAL_FRAME_READER
 }
 
 bool P087_data_struct::init(ESPEasySerialPort port, const int16_t serial_rx, const int16_t serial_tx, unsigned long baudrate,
@@ -36,6 +39,11 @@ bool P087_data_struct::init(ESPEasySerialPort port, const int16_t serial_rx, con
     # elif defined(ESP32)
     easySerial->begin(baudrate, config);
     # endif // if defined(ESP8266)
+    # if FEATURE_SERIAL_FRAME_READER
+    // When out of memory, fall back to reading per byte
+    frameReader = SerialFrameReader::create(P087_FRAME_BUFFER_SIZE);
+    updateFraming();
+    # endif // if FEATURE_SERIAL_FRAME_READER
     return true;
   }
   return false;
@@ -99,6 +107,12 @@ bool P087_data_struct::loop() {
   if (!isInitialized()) {
     return false;
   }
+  # if FEATURE_SERIAL_FRAME_READER
+
+  if (frameReader != nullptr) {
+    return loop_frameReader();
+  }
+  # endif // if FEATURE_SERIAL_FRAME_READER
   bool fullSentenceReceived = false;
 
   if (easySerial != nullptr) {
@@ -176,6 +190,72 @@ bool P087_data_struct::loop() {
   return fullSentenceReceived;
 }
 
+# if FEATURE_SERIAL_FRAME_READER
+void P087_data_struct::updateFraming() {
+  if (frameReader == nullptr) { return; }
+  frameReader->setMaxFrameLength(max_length);
+  #  ifndef LIMIT_BUILD_SIZE
+
+  // Skip LF in ascii-mode
+  frameReader->setSkipByte(handle_binary ? -1 : 10);
+
+  if (0 != fixed_length) {
+    frameReader->setFixedLength(fixed_length);
+    return;
+  }
+
+  if (handle_binary) {
+    // Binary data has no end-marker, all received data is handled as a sentence
+    frameReader->setTimeout(0);
+    return;
+  }
+  #  else // ifndef LIMIT_BUILD_SIZE
+  frameReader->setSkipByte(10);
+  #  endif // ifndef LIMIT_BUILD_SIZE
+
+  // ASCII mode: Done on CR
+  frameReader->setDelimiter(13);
+}
+
+bool P087_data_struct::loop_frameReader() {
+  bool fullSentenceReceived = false;
+
+  frameReader->fill(*easySerial);
+
+  const uint8_t *frame = nullptr;
+  size_t length        = 0;
+
+  while (!fullSentenceReceived && frameReader->getFrame(frame, length)) {
+    bool valid = length > 0;
+
+    #  ifndef LIMIT_BUILD_SIZE
+
+    if (!handle_binary) // Skip valid-ascii check
+    #  endif // ifndef LIMIT_BUILD_SIZE
+    {
+      for (size_t i = 0; i < length && valid; ++i) {
+        if ((frame[i] > 127) || (frame[i] < 32)) {
+          ++sentences_received_error;
+          valid = false;
+        }
+      }
+    }
+
+    if (valid) {
+      fullSentenceReceived = true;
+      last_sentence.clear();
+      last_sentence.concat(reinterpret_cast<const char *>(frame), length);
+      ++sentences_received;
+      length_last_received = length;
+    }
+    frameReader->consumeFrame();
+  }
+
+  return fullSentenceReceived;
+}
+
+# endif // if FEATURE_SERIAL_FRAME_READER
+
 bool P087_data_struct::getSentence(String& string) {
   string = last_sentence;
 
@@ -192,8 +272,21 @@ void P087_data_struct::getSentencesReceived(uint32_t& succes, uint32_t& error, u
   length_last = length_last_received;
 }
 
+# if FEATURE_SERIAL_FRAME_READER
+uint32_t P087_data_struct::getDroppedFrames() const {
+  if (frameReader == nullptr) { return 0; }
+  const SerialFrameReader::Stats& stats = frameReader->getStats();
+
+  return stats.dropped + stats.truncated;
+}
+
+# endif // if FEATURE_SERIAL_FRAME_READER
+
 void P087_data_struct::setMaxLength(uint16_t maxlenght) {
   max_length = maxlenght;
+  # if FEATURE_SERIAL_FRAME_READER
+  updateFraming();
+  # endif // if FEATURE_SERIAL_FRAME_READER
 }
 
 void P087_data_struct::setLine(uint8_t varNr, const String& line) {
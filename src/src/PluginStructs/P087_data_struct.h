@@ -8,6 +8,10 @@
 
 # include <Regexp.h>
 
+# if FEATURE_SERIAL_FRAME_READER
+#  include "../Helpers/SerialFrameReader.h"
+# endif // if FEATURE_SERIAL_FRAME_READER
+
 
 # define P087_REGEX_POS          0
 # define P087_NR_CHAR_USE_POS    1
@@ -33,6 +37,8 @@
 
 # define P087_DEFAULT_BAUDRATE   38400
 
+# define P087_FRAME_BUFFER_SIZE  560 // Must be larger than the max. sentence length
+
 # define P087_READ_BIN_LABEL     PCONFIG_LABEL(1)
 # define P087_EVENT_HEX_LABEL    PCONFIG_LABEL(2)
 # define P087_FIXED_LENGTH_LABEL PCONFIG_LABEL(3)
@@ -98,6 +104,12 @@ public:
                             uint32_t& error,
                             uint32_t& length_last) const;
 
+  # if FEATURE_SERIAL_FRAME_READER
+
+  // Nr of sentences dropped or truncated as they did not fit in the receive buffer
+  uint32_t        getDroppedFrames() const;
+  # endif // if FEATURE_SERIAL_FRAME_READER
+
   void            setMaxLength(uint16_t maxlenght);
 
   void            setLine(uint8_t       varNr,
@@ -143,6 +155,9 @@ public:
   # ifndef LIMIT_BUILD_SIZE
   void setHandleBinary(bool state) {
     handle_binary = state;
+    #  if FEATURE_SERIAL_FRAME_READER
+    updateFraming();
+    #  endif // if FEATURE_SERIAL_FRAME_READER
   }
 
   void setEventAsHex(bool state) {
@@ -155,6 +170,9 @@ public:
 
   void setFixedLength(uint8_t value) {
     fixed_length = value;
+    #  if FEATURE_SERIAL_FRAME_READER
+    updateFraming();
+    #  endif // if FEATURE_SERIAL_FRAME_READER
   }
 
   # endif // ifndef LIMIT_BUILD_SIZE
@@ -163,6 +181,14 @@ private:
 
   bool max_length_reached() const;
 
+  # if FEATURE_SERIAL_FRAME_READER
+  void updateFraming();
+
+  bool loop_frameReader();
+
+  SerialFrameReader *frameReader = nullptr;
+  # endif // if FEATURE_SERIAL_FRAME_READER
+
   ESPeasySerial *easySerial = nullptr;
   String         sentence_part;
   String         last_sentence;
@@ -22,10 +22,7 @@
 P094_data_struct::P094_data_struct() :  easySerial(nullptr) {}
 
 P094_data_struct::~P094_data_struct() {
-  if (easySerial != nullptr) {
-    delete easySerial;
-    easySerial = nullptr;
-  }
+  reset();
 }
 
 void P094_data_struct::reset() {
@@ -33,6 +30,13 @@ void P094_data_struct::reset() {
     delete easySerial;
     easySerial = nullptr;
   }
+  # if FEATURE_SERIAL_FRAME_READER
+
+  if (serialReader != nullptr) {
+    delete serialReader;
+    serialReader = nullptr;
+  }
+  # endif // if FEATURE_SERIAL_FRAME_READER
 }
 
 bool P094_data_struct::init(ESPEasySerialPort port,
@@ -49,6 +53,9 @@ bool P094_data_struct::init(ESPEasySerialPort port,
     return false;
   }
   easySerial->begin(baudrate);
+  # if FEATURE_SERIAL_FRAME_READER
+  serialReader = SerialFrameReader::create();
+  # endif // if FEATURE_SERIAL_FRAME_READER
   return true;
 }
 
@@ -570,18 +577,18 @@ bool P094_data_struct::loop() {
   bool fullSentenceReceived = false;
 
   if (easySerial != nullptr) {
-    int available = easySerial->available();
+    int available = serialAvailable();
 
     unsigned long timeout = millis() + 10;
 
     while (available > 0 && !fullSentenceReceived) {
       // Look for end marker
-      char c = easySerial->read();
+      char c = serialRead();
       --available;
 
       if (available == 0) {
         if (!timeOutReached(timeout)) {
-          available = easySerial->available();
+          available = serialAvailable();
         }
         delay(0);
       }
@@ -647,6 +654,26 @@ bool P094_data_struct::loop() {
   return fullSentenceReceived;
 }
 
+int P094_data_struct::serialAvailable() {
+  # if FEATURE_SERIAL_FRAME_READER
+
+  if (serialReader != nullptr) {
+    return serialReader->available(*easySerial);
+  }
+  # endif // if FEATURE_SERIAL_FRAME_READER
+  return easySerial->available();
+}
+
+int P094_data_struct::serialRead() {
+  # if FEATURE_SERIAL_FRAME_READER
+
+  if (serialReader != nullptr) {
+    return serialReader->read(*easySerial);
+  }
+  # endif // if FEATURE_SERIAL_FRAME_READER
+  return easySerial->read();
+}
+
 const String& P094_data_struct::peekSentence() const {
   return sentence_part;
 }
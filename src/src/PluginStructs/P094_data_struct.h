@@ -6,6 +6,9 @@
 
 # include "../Helpers/CUL_interval_filter.h"
 # include "../Helpers/CUL_stats.h"
+# if FEATURE_SERIAL_FRAME_READER
+#  include "../Helpers/SerialFrameReader.h"
+# endif // if FEATURE_SERIAL_FRAME_READER
 
 # include "../PluginStructs/P094_Filter.h"
 
@@ -158,11 +161,18 @@ private:
 
   bool max_length_reached() const;
 
+  // Serial port access via the bulk read buffer, when allocated
+  int  serialAvailable();
+  int  serialRead();
+
   bool isDuplicate(const P094_filter& other) const;
 
   std::vector<P094_filter>_filters;
 
   ESPeasySerial *easySerial = nullptr;
+  # if FEATURE_SERIAL_FRAME_READER
+  SerialFrameReader *serialReader = nullptr;
+  # endif // if FEATURE_SERIAL_FRAME_READER
   String         sentence_part;
   uint16_t       max_length = P094_MAX_MSG_LENGTH;
   uint16_t       nrFilters{};
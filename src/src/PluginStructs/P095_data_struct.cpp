@@ -409,6 +409,9 @@ bool P095_data_struct::plugin_ten_per_second(struct EventStruct *event) {
         ili9488->fillScreen(_bgcolor); // fill screen with background color
       }
       #  endif // if P095_ENABLE_ILI948X
+      # if ADAGFX_ENABLE_TEXT_CACHE
+      if (nullptr != gfxHelper) { gfxHelper->invalidateTextCache(); }
+      # endif // if ADAGFX_ENABLE_TEXT_CACHE
 
       // Schedule the surrogate initial PLUGIN_READ that has been suppressed by the splash
       Scheduler.schedule_task_device_timer(event->TaskIndex, millis() + 10);
@@ -479,6 +482,9 @@ bool P095_data_struct::plugin_write(struct EventStruct *event, const String& str
           tft->fillScreen(_bgcolor);
         }
       }
+      # if ADAGFX_ENABLE_TEXT_CACHE
+      if (nullptr != gfxHelper) { gfxHelper->invalidateTextCache(); }
+      # endif // if ADAGFX_ENABLE_TEXT_CACHE
     }
     else if (equals(arg1, F("backlight"))) {
       if (validGpio(P095_CONFIG_BACKLIGHT_PIN) &&    // All is valid?
@@ -343,6 +343,9 @@ bool P096_data_struct::plugin_write(struct EventStruct *event, const String& str
       }
       eInkScreen->display();
       eInkScreen->clearBuffer();
+      # if ADAGFX_ENABLE_TEXT_CACHE
+      if (nullptr != gfxHelper) { gfxHelper->invalidateTextCache(); }
+      # endif // if ADAGFX_ENABLE_TEXT_CACHE
       success = true;
     }
     else if (equals(arg1, F("backlight"))) { // not supported
@@ -359,6 +362,9 @@ bool P096_data_struct::plugin_write(struct EventStruct *event, const String& str
         (arg2.isEmpty() ? static_cast<uint16_t>(AdaGFXMonoRedGreyscaleColors::ADAGFXEPD_BLACK)
         : AdaGFXparseColor(arg2, _colorDepth));
       eInkScreen->fillScreen(fillColor);
+      # if ADAGFX_ENABLE_TEXT_CACHE
+      if (nullptr != gfxHelper) { gfxHelper->invalidateTextCache(); }
+      # endif // if ADAGFX_ENABLE_TEXT_CACHE
       plugin_096_sequence_in_progress = true;
       success                         = true;
     }
@@ -498,6 +498,9 @@ bool P116_data_struct::plugin_write(struct EventStruct *event,
     }
     else if (equals(arg1, F("clear"))) {
       st77xx->fillScreen(_bgcolor);
+      # if ADAGFX_ENABLE_TEXT_CACHE
+      if (nullptr != gfxHelper) { gfxHelper->invalidateTextCache(); }
+      # endif // if ADAGFX_ENABLE_TEXT_CACHE
     }
     else if (equals(arg1, F("backlight"))) {
       if ((P116_CONFIG_BACKLIGHT_PIN != -1) &&       // All is valid?
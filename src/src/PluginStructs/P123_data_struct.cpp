@@ -96,6 +96,10 @@ void P123_data_struct::reset() {
   addLog(LOG_LEVEL_INFO, F("P123 DEBUG Touchscreen reset."));
   # endif // PLUGIN_123_DEBUG
 
+  if (validGpio(_interruptPin)) {
+    detachInterrupt(digitalPinToInterrupt(_interruptPin));
+    _interruptPin = -1;
+  }
   delete touchscreen;
   touchscreen = nullptr;
   delete touchHandler;
@@ -136,6 +140,16 @@ bool P123_data_struct::init(struct EventStruct *event) {
           touchscreen = nullptr;
         } else {
           setRotation(_rotation);
+
+          if (validGpio(P123_INTERRUPTPIN)) {
+            // Depending on the controller and its configuration, the interrupt is either a rising or falling edge
+            _interruptPin = P123_INTERRUPTPIN;
+            _touchIrq     = true; // Read once to get in sync
+            attachInterruptArg(digitalPinToInterrupt(_interruptPin),
+                               reinterpret_cast<void (*)(void *)>(ISR_touched),
+                               this,
+                               CHANGE);
+          }
         }
       }
     }
@@ -245,10 +259,23 @@ bool P123_data_struct::plugin_write(struct EventStruct *event,
 
 /**
  * Every 1/50th second we check if the screen is touched
+ * When the interrupt pin is used, the touchscreen is only read after an interrupt, while being touched,
+ * and as a fallback 5 times per second, to save on I2C traffic.
  */
 bool P123_data_struct::plugin_fifty_per_second(struct EventStruct *event) {
   if (isInitialized() && touchHandler->touchEnabled()) {
-    if (touched()) {
+    if (validGpio(_interruptPin)) {
+      ++_touchPollCount;
+
+      if (!_touchIrq && !_touchActive && (_touchPollCount < 10)) {
+        return false;
+      }
+      _touchIrq       = false;
+      _touchPollCount = 0;
+    }
+    _touchActive = touched();
+
+    if (_touchActive) {
       int16_t x  = 0;
       int16_t y  = 0;
       int16_t z  = 0;
@@ -288,6 +315,13 @@ void P123_data_struct::loadTouchObjects(struct EventStruct *event) {
   }
 }
 
+/**
+ * Interrupt handler, only set a flag to read the touchscreen from the next 50/sec call
+ */
+void P123_data_struct::ISR_touched(P123_data_struct *self) {
+  self->_touchIrq = true;
+}
+
 /**
  * Check if the screen is touched.
  */
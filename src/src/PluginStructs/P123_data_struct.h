@@ -150,6 +150,13 @@ private:
   int16_t          _interruptPin = -1;
   P123_TouchType_e _touchType;
 
+  // Set from the interrupt pin, when available, so the touchscreen is only read when needed
+  volatile bool _touchIrq = false;
+  bool          _touchActive{};
+  uint8_t       _touchPollCount{};
+
+  static void ISR_touched(P123_data_struct *self) ICACHE_RAM_ATTR;
+
   TOUCHINFO touchInfo;
 
   ESPEasy_TouchHandler *touchHandler = nullptr;
@@ -140,6 +140,9 @@ bool P128_data_struct::plugin_write(struct EventStruct *event,
                                     const String      & string) {
   bool success = false;
 
+  // All effects and most commands use pixelCount as divisor
+  if (pixelCount == 0) { return success; }
+
   const String command = parseString(string, 1);
 
   if ((equals(command, F("neopixelfx"))) || (equals(command, F("nfx")))) {
@@ -775,6 +778,7 @@ void P128_data_struct::rgb2colorStr() {
 }
 
 bool P128_data_struct::plugin_fifty_per_second(struct EventStruct *event) {
+  if (pixelCount == 0) { return false; }
   counter20ms++;
   lastmode = mode;
 
@@ -867,29 +871,77 @@ bool P128_data_struct::plugin_fifty_per_second(struct EventStruct *event) {
 }
 
 void P128_data_struct::fade(void) {
-  for (int pixel = 0; pixel < pixelCount; pixel++) {
-    long  counter  = 20 * (counter20ms - starttime[pixel]);
-    float progress = (float)counter / (float)fadetime;
-    progress = constrain(progress, 0.0f, 1.0f);
+  const uint16_t nrPixels = min(pixelCount, static_cast<uint16_t>(ARRAYSIZE));
 
-    # if defined(RGBW) || defined(GRBW)
-    RgbwColor updatedColor = RgbwColor::LinearBlend(
-      rgb_old[pixel], rgb_target[pixel],
-      progress);
-    # else // if defined(RGBW) || defined(GRBW)
-    RgbColor updatedColor = RgbColor::LinearBlend(
-      rgb_old[pixel], rgb_target[pixel],
-      progress);
-    # endif // if defined(RGBW) || defined(GRBW)
+  if (nrPixels == 0) {
+    mode = P128_modetype::Off;
+    return;
+  }
 
-    if ((counter20ms > maxtime) && (Plugin_128_pixels->GetPixelColor(pixel).CalculateBrightness() == 0)) {
-      mode = P128_modetype::Off;
-    } else if (counter20ms > maxtime) {
-      mode = P128_modetype::On;
-    }
+  if (counter20ms > maxtime) { // Fade finished, final state depends on the last pixel
+    mode = (Plugin_128_pixels->GetPixelColor(nrPixels - 1).CalculateBrightness() == 0)
+           ? P128_modetype::Off
+           : P128_modetype::On;
+  }
+
+  // Fixed-point progress: 0..256, using 1/fadetime in 16.16 format to avoid a division per pixel
+  const uint32_t fadetime_ms = fadetime > 0 ? fadetime : 1;
+  const uint32_t invFadetime = (1u << 24) / fadetime_ms;
+
+  for (uint16_t pixel = 0; pixel < nrPixels; pixel++) {
+    int32_t counter = 20 * static_cast<int32_t>(counter20ms - starttime[pixel]);
+    counter = constrain(counter, 0, static_cast<int32_t>(fadetime_ms));
+
+    // Rounding of invFadetime may end just below 256, so make sure the target color is reached.
+    const uint16_t progress = (counter >= static_cast<int32_t>(fadetime_ms))
+                              ? 256
+                              : (static_cast<uint32_t>(counter) * invFadetime) >> 16;
+
+    Plugin_128_pixels->SetPixelColor(pixel, blendColor(rgb_old[pixel], rgb_target[pixel], progress));
+  }
+}
+
+/*
+ * Linear blend using integer math, progress 0..256
+ */
+# if defined(RGBW) || defined(GRBW)
+RgbwColor P128_data_struct::blendColor(const RgbwColor& left, const RgbwColor& right, uint16_t progress) {
+  return RgbwColor(blend8(left.R, right.R, progress),
+                   blend8(left.G, right.G, progress),
+                   blend8(left.B, right.B, progress),
+                   blend8(left.W, right.W, progress));
+}
+
+# else // if defined(RGBW) || defined(GRBW)
+RgbColor P128_data_struct::blendColor(const RgbColor& left, const RgbColor& right, uint16_t progress) {
+  return RgbColor(blend8(left.R, right.R, progress),
+                  blend8(left.G, right.G, progress),
+                  blend8(left.B, right.B, progress));
+}
+
+# endif // if defined(RGBW) || defined(GRBW)
+
+/*
+ * Fade out all pixels (divide by 2).
+ * Works directly on the (brightness scaled) pixel buffer, 4 bytes at a time,
+ * instead of reading, scaling back and writing each pixel.
+ */
+void P128_data_struct::halvePixels() {
+  uint8_t *pixels   = Plugin_128_pixels->Pixels();
+  const size_t size = Plugin_128_pixels->PixelsSize();
+  size_t i          = 0;
+
+  for (; i + 4 <= size; i += 4) {
+    uint32_t value;
+    memcpy(&value, &pixels[i], sizeof(value));
+    value = (value >> 1) & 0x7F7F7F7Fu;
+    memcpy(&pixels[i], &value, sizeof(value));
+  }
 
-    Plugin_128_pixels->SetPixelColor(pixel, updatedColor);
+  for (; i < size; ++i) {
+    pixels[i] >>= 1;
   }
+  Plugin_128_pixels->Dirty();
 }
 
 void P128_data_struct::colorfade(void) {
@@ -1033,16 +1085,19 @@ void P128_data_struct::faketv(void) {
  * Cycles a rainbow over the entire string of LEDs.
  */
 void P128_data_struct::rainbow(void) {
-  const long  counter  = 20 * (counter20ms - starttimerb);
-  const float progress = (float)counter / (float)fadetime;
-
   if (fadeIn == true) {
+    const long  counter  = 20 * (counter20ms - starttimerb);
+    const float progress = (float)counter / (float)fadetime;
     Plugin_128_pixels->SetBrightness(progress * maxBright); // Safety check
     fadeIn = (progress == 1) ? false : true;
   }
 
+  // Wheel position per pixel in 8.8 fixed-point, to avoid a division per pixel
+  const uint32_t step   = (256u << 8) / pixelCount;
+  const uint32_t offset = counter20ms * rainbowspeed / 10;
+
   for (int i = 0; i < pixelCount; i++) {
-    const uint32_t color = Wheel(((i * 256 / pixelCount) + counter20ms * rainbowspeed / 10) & 255);
+    const uint32_t color = Wheel((((i * step) >> 8) + offset) & 255);
     Plugin_128_pixels->SetPixelColor(i, 
       RgbColor(
         (color >> 16), // r
@@ -1074,28 +1129,7 @@ uint32_t P128_data_struct::Wheel(uint8_t pos) {
 // Larson Scanner K.I.T.T.
 void P128_data_struct::kitt(void) {
   if (counter20ms % (unsigned long)(SPEED_MAX / abs(speed)) == 0) {
-    for (uint16_t i = 0; i < pixelCount; i++) {
-      # if defined(RGBW) || defined(GRBW)
-      RgbwColor px_rgb = Plugin_128_pixels->GetPixelColor(i);
-
-      // fade out (divide by 2)
-      px_rgb.R >>= 1;
-      px_rgb.G >>= 1;
-      px_rgb.B >>= 1;
-      px_rgb.W >>= 1;
-
-      # else // if defined(RGBW) || defined(GRBW)
-
-      RgbColor px_rgb = Plugin_128_pixels->GetPixelColor(i);
-
-      // fade out (divide by 2)
-      px_rgb.R >>= 1;
-      px_rgb.G >>= 1;
-      px_rgb.B >>= 1;
-      # endif // if defined(RGBW) || defined(GRBW)
-
-      Plugin_128_pixels->SetPixelColor(i, px_rgb);
-    }
+    halvePixels(); // fade out (divide by 2)
 
     uint16_t pos = 0;
 
@@ -1107,36 +1141,16 @@ void P128_data_struct::kitt(void) {
 
     Plugin_128_pixels->SetPixelColor(pos, rgb);
 
-    _counter_mode_step = (_counter_mode_step + 1) % ((pixelCount * 2) - 2);
+    // A single pixel has no way back
+    const uint16_t steps = (pixelCount > 1) ? (pixelCount * 2) - 2 : 1;
+    _counter_mode_step = (_counter_mode_step + 1) % steps;
   }
 }
 
 // Firing comets from one end.
 void P128_data_struct::comet(void) {
   if (counter20ms % (unsigned long)(SPEED_MAX / abs(speed)) == 0) {
-    for (uint16_t i = 0; i < pixelCount; i++) {
-      const uint16_t pixelIndex = (speed > 0) ? i : pixelCount - i - 1;
-      # if defined(RGBW) || defined(GRBW)
-      RgbwColor px_rgb = Plugin_128_pixels->GetPixelColor(pixelIndex);
-
-      // fade out (divide by 2)
-      px_rgb.R >>= 1;
-      px_rgb.G >>= 1;
-      px_rgb.B >>= 1;
-      px_rgb.W >>= 1;
-
-      # else // if defined(RGBW) || defined(GRBW)
-
-      RgbColor px_rgb = Plugin_128_pixels->GetPixelColor(pixelIndex);
-
-      // fade out (divide by 2)
-      px_rgb.R >>= 1;
-      px_rgb.G >>= 1;
-      px_rgb.B >>= 1;
-      # endif // if defined(RGBW) || defined(GRBW)
-
-      Plugin_128_pixels->SetPixelColor(pixelIndex, px_rgb);
-    }
+    halvePixels(); // fade out (divide by 2)
 
     {
       const uint16_t pixelIndex = (speed > 0) ? _counter_mode_step : pixelCount - _counter_mode_step - 1;
@@ -1274,12 +1288,15 @@ void P128_data_struct::fire(void) {
   if (counter20ms > fireTimer + 50 / fps) {
     fireTimer = counter20ms;
     Fire2012();
-    RgbColor pixel;
+
+    // Blend to black by (255 - brightness) / 255, in fixed-point 0..256
+    const uint16_t scale = ((static_cast<uint16_t>(brightness) << 8) + 127) / 255;
 
     for (int i = 0; i < pixelCount; i++) {
-      pixel = leds[i];
-      pixel = RgbColor::LinearBlend(pixel, RgbColor(0, 0, 0), (255 - brightness) / 255.0f);
-      Plugin_128_pixels->SetPixelColor(i, pixel);
+      const RgbColor& pixel = leds[i];
+      Plugin_128_pixels->SetPixelColor(i, RgbColor((pixel.R * scale) >> 8,
+                                                   (pixel.G * scale) >> 8,
+                                                   (pixel.B * scale) >> 8));
     }
   }
 }
@@ -1348,8 +1365,10 @@ uint8_t P128_data_struct::scale8_video(uint8_t i, uint8_t scale) {
 
 void P128_data_struct::Fire2012(void) {
   // Step 1.  Cool down every cell a little
+  const uint8_t cooldown = ((cooling * 10) / pixelCount) + 2;
+
   for (int i = 0; i < pixelCount; i++) {
-    heat[i] = qsub8(heat[i],  random8(0, ((cooling * 10) / pixelCount) + 2));
+    heat[i] = qsub8(heat[i],  random8(0, cooldown));
   }
 
   // Step 2.  Heat from each cell drifts 'up' and diffuses a little
@@ -1447,16 +1466,21 @@ void P128_data_struct::Plugin_128_simpleclock() {
   }
 
 
+  // Hand positions are the same for all pixels
+  const long secondsPos = lround((((float)Seconds + ((float)counter20ms - (float)maxtime) / 50.0f) * (float)pixelCount) / 60.0f);
+  const long minutesPos = lround((((float)Minutes * 60.0f) + (float)Seconds) / 60.0f * (float)pixelCount / 60.0f);
+  const long hoursPos   = lround(((float)Hours + (float)Minutes / 60) * (float)pixelCount / 12.0f);
+
   for (int i = 0; i < pixelCount; i++) {
-    if (lround((((float)Seconds + ((float)counter20ms - (float)maxtime) / 50.0f) * (float)pixelCount) / 60.0f) == i) {
+    if (secondsPos == i) {
       if (rgb_s_off  == false) {
         Plugin_128_pixels->SetPixelColor(i, rgb_s);
       }
     }
-    else if (lround((((float)Minutes * 60.0f) + (float)Seconds) / 60.0f * (float)pixelCount / 60.0f) == i) {
+    else if (minutesPos == i) {
       Plugin_128_pixels->SetPixelColor(i, rgb_m);
     }
-    else if (lround(((float)Hours + (float)Minutes / 60) * (float)pixelCount / 12.0f)  == i) {
+    else if (hoursPos == i) {
       Plugin_128_pixels->SetPixelColor(i,                                 rgb_h);
       Plugin_128_pixels->SetPixelColor((i + 1) % pixelCount,              rgb_h);
       Plugin_128_pixels->SetPixelColor((i - 1 + pixelCount) % pixelCount, rgb_h);
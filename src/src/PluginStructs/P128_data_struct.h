@@ -2407,6 +2407,24 @@ private:
   void     rgb2colorStr();
 
   void     fade(void);
+  # if defined(RGBW) || defined(GRBW)
+  static RgbwColor blendColor(const RgbwColor& left,
+                              const RgbwColor& right,
+                              uint16_t         progress);
+  # else // if defined(RGBW) || defined(GRBW)
+  static RgbColor  blendColor(const RgbColor& left,
+                              const RgbColor& right,
+                              uint16_t        progress);
+  # endif // if defined(RGBW) || defined(GRBW)
+
+  // Linear blend of a single color element, progress 0..256
+  static uint8_t blend8(uint8_t  left,
+                        uint8_t  right,
+                        uint16_t progress) {
+    return left + (((static_cast<int32_t>(right) - left) * static_cast<int32_t>(progress)) >> 8);
+  }
+
+  void     halvePixels();
   void     colorfade(void);
   void     wipe(void);
   void     dualwipe(void);
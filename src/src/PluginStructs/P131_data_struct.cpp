@@ -380,6 +380,9 @@ bool P131_data_struct::plugin_write(struct EventStruct *event, const String& str
 
       if (equals(sub, F("clear"))) {
         matrix->fillScreen(_bgcolor);
+        # if ADAGFX_ENABLE_TEXT_CACHE
+        if (nullptr != gfxHelper) { gfxHelper->invalidateTextCache(); }
+        # endif // if ADAGFX_ENABLE_TEXT_CACHE
       } else if (sub.startsWith(F("bright")) && (event->Par2 >= 0) && (event->Par2 <= 255)) {
         if (parseString(string, 3).isEmpty()) {                     // No argument, then
           matrix->setBrightness(std::min(_maxbright, _brightness)); // use initial brightness
@@ -520,6 +523,9 @@ bool P131_data_struct::plugin_ten_per_second(struct EventStruct *event) {
       if (nullptr != matrix) {
         matrix->fillScreen(_bgcolor); // fill screen with black color
       }
+      # if ADAGFX_ENABLE_TEXT_CACHE
+      if (nullptr != gfxHelper) { gfxHelper->invalidateTextCache(); }
+      # endif // if ADAGFX_ENABLE_TEXT_CACHE
 
       // Schedule the surrogate initial PLUGIN_READ that has been suppressed by the splash
       Scheduler.schedule_task_device_timer(event->TaskIndex, millis() + 10);
@@ -275,6 +275,9 @@ bool P141_data_struct::plugin_write(struct EventStruct *event,
     else if (equals(arg1, F("clear"))) {       // Empty screen
       pcd8544->fillScreen(_bgcolor);
       pcd8544->display();                      // Put on display
+      # if ADAGFX_ENABLE_TEXT_CACHE
+      if (nullptr != gfxHelper) { gfxHelper->invalidateTextCache(); }
+      # endif // if ADAGFX_ENABLE_TEXT_CACHE
     }
     else if (equals(arg1, F("inv")) &&         // Invert display
              (event->Par2 >= 0) && (event->Par2 <= 1)) {
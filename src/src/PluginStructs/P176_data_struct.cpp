@@ -31,6 +31,9 @@ P176_data_struct::P176_data_struct(struct EventStruct *event) {
 
 P176_data_struct::~P176_data_struct() {
   delete _serial;
+  # if FEATURE_SERIAL_FRAME_READER
+  delete _serialReader;
+  # endif // if FEATURE_SERIAL_FRAME_READER
 }
 
 bool P176_data_struct::init() {
@@ -43,6 +46,9 @@ bool P176_data_struct::init() {
       # elif defined(ESP32)
       _serial->begin(_baud, _config);
       # endif // if defined(ESP8266)
+      # if FEATURE_SERIAL_FRAME_READER
+      _serialReader = SerialFrameReader::create();
+      # endif // if FEATURE_SERIAL_FRAME_READER
       addLog(LOG_LEVEL_INFO, F("Victron: Serial port started"));
 
       if (validGpio(_ledPin)) {
@@ -264,7 +270,7 @@ bool P176_data_struct::getReceivedValue(const String& key,
 bool P176_data_struct::handleSerial() {
   bool enough    = false;
   bool result    = false; // True for a successfully received packet, with a correct checksum or _failChecksum = false
-  int  available = _serial->available();
+  int  available = serialAvailable();
   uint8_t ch;
 
   do {
@@ -273,7 +279,7 @@ bool P176_data_struct::handleSerial() {
         DIRECT_pinWrite(_ledPin, _ledInverted ? 0 : 1);
       }
 
-      ch = static_cast<uint8_t>(_serial->read());
+      ch = static_cast<uint8_t>(serialRead());
       available--;
 
       # if P176_HANDLE_CHECKSUM
@@ -386,13 +392,33 @@ bool P176_data_struct::handleSerial() {
         DIRECT_pinWrite(_ledPin, _ledInverted ? 1 : 0);
       }
     } else {
-      available = _serial->available();
+      available = serialAvailable();
       enough    = available <= 0;
     }
   } while (!enough);
   return result;
 }
 
+int P176_data_struct::serialAvailable() {
+  # if FEATURE_SERIAL_FRAME_READER
+
+  if (nullptr != _serialReader) {
+    return _serialReader->available(*_serial);
+  }
+  # endif // if FEATURE_SERIAL_FRAME_READER
+  return _serial->available();
+}
+
+int P176_data_struct::serialRead() {
+  # if FEATURE_SERIAL_FRAME_READER
+
+  if (nullptr != _serialReader) {
+    return _serialReader->read(*_serial);
+  }
+  # endif // if FEATURE_SERIAL_FRAME_READER
+  return _serial->read();
+}
+
 /*****************************************************
 * processBuffer
 *****************************************************/
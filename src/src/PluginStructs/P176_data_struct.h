@@ -6,6 +6,10 @@
 
 # include <ESPeasySerial.h>
 
+# if FEATURE_SERIAL_FRAME_READER
+#  include "../Helpers/SerialFrameReader.h"
+# endif // if FEATURE_SERIAL_FRAME_READER
+
 # define P176_DEBUG 1           // Enable some extra (development) logging
 
 # define P176_HANDLE_CHECKSUM 1 // Implement checksum?
@@ -183,12 +187,19 @@ private:
   bool  getReceivedValue(const String& key,
                          VictronValue& value) const;
   bool  handleSerial();
+
+  // Serial port access via the bulk read buffer, when allocated
+  int   serialAvailable();
+  int   serialRead();
   void  processBuffer(const String& message);
   # if P176_FAIL_CHECKSUM
   bool  commitTempData(bool checksumSuccess);
   # endif // if P176_FAIL_CHECKSUM
 
   ESPeasySerial *_serial = nullptr;
+  # if FEATURE_SERIAL_FRAME_READER
+  SerialFrameReader *_serialReader = nullptr;
+  # endif // if FEATURE_SERIAL_FRAME_READER
 
   # if P176_HANDLE_CHECKSUM
   uint32_t _checksumErrors     = 0;
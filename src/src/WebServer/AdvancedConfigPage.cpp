@@ -20,6 +20,9 @@
 #include "../Helpers/ESPEasy_time.h"
 #include "../Helpers/Hardware_defines.h"
 #include "../Helpers/StringConverter.h"
+#if FEATURE_SYSLOG
+#include "../Helpers/SyslogWriter.h"
+#endif
 
 #if FEATURE_I2C_MULTIPLE
 #include "../Helpers/I2C_access.h"
@@ -60,6 +63,9 @@ void handle_advanced() {
 
     Settings.SyslogFacility = getFormItemInt(F("syslogfacility"));
     Settings.SyslogPort     = getFormItemInt(F("syslogport"));
+#if FEATURE_SYSLOG
+    Settings.SyslogTransport(getFormItemInt(F("syslogtransport")));
+#endif
     Settings.UseSerial      = isFormItemChecked(LabelType::ENABLE_SERIAL_PORT_CONSOLE);
 
 #if FEATURE_DEFINE_SERIAL_CONSOLE_PORT
@@ -86,6 +92,9 @@ void handle_advanced() {
     setLogLevelFor(LOG_TO_SDCARD, LabelType::SD_LOG_LEVEL);
 #endif // if FEATURE_SD
     Settings.UseValueLogger              = isFormItemChecked(F("valuelogger"));
+#if FEATURE_SD
+    Settings.ValueLoggerBinary(isFormItemChecked(F("valuelogbin")));
+#endif // if FEATURE_SD
     Settings.BaudRate                    = getFormItemInt(F("baudrate"));
     Settings.UseNTP(isFormItemChecked(F("usentp")));
     Settings.ExtTimeSource(
@@ -120,6 +129,7 @@ void handle_advanced() {
     Settings.SendToHttp_ack(isFormItemChecked(F("sendtohttp_ack")));
     Settings.SendToHTTP_follow_redirects(isFormItemChecked(F("sendtohttp_redir")));
     Settings.EcoPowerMode(isFormItemChecked(LabelType::CPU_ECO_MODE));
+    Settings.AlignTaskReads(isFormItemChecked(LabelType::ALIGN_TASK_READS));
     Settings.JSONBoolWithoutQuotes(isFormItemChecked(LabelType::JSON_BOOL_QUOTES));
 #if FEATURE_TIMING_STATS
     Settings.EnableTimingStats(isFormItemChecked(LabelType::ENABLE_TIMING_STATISTICS));
@@ -243,8 +253,23 @@ void handle_advanced() {
   addFormSubHeader(F("Log Settings"));
 
   addFormIPBox(F("Syslog IP"), F("syslogip"), Settings.Syslog_IP);
-  addFormNumericBox(F("Syslog UDP port"), F("syslogport"), Settings.SyslogPort, 0, 65535);
+  addFormNumericBox(F("Syslog port"), F("syslogport"), Settings.SyslogPort, 0, 65535);
 #if FEATURE_SYSLOG
+  {
+    const __FlashStringHelper *options[] = {
+      F("UDP (RFC3164)"),
+      F("UDP batched (RFC5424)"),
+      F("TCP (RFC5424, octet-counting)")
+    };
+    const int optionValues[] = {
+      SYSLOG_TRANSPORT_UDP,
+      SYSLOG_TRANSPORT_UDP_BATCHED,
+      SYSLOG_TRANSPORT_TCP
+    };
+    const FormSelectorOptions selector(NR_ELEMENTS(options), options, optionValues);
+    selector.addFormSelector(F("Syslog Transport"), F("syslogtransport"), Settings.SyslogTransport());
+    addFormNote(F("Batched UDP packs multiple messages per packet, separated by a newline"));
+  }
   addFormLogLevelSelect(LabelType::SYSLOG_LOG_LEVEL, Settings.SyslogLevel);
   addFormLogFacilitySelect(F("Syslog Facility"), F("syslogfacility"), Settings.SyslogFacility);
 #endif
@@ -257,6 +282,8 @@ void handle_advanced() {
   addFormLogLevelSelect(LabelType::SD_LOG_LEVEL,     Settings.SDLogLevel);
 
   addFormCheckBox(F("SD Card Value Logger"), F("valuelogger"), Settings.UseValueLogger);
+  addFormCheckBox(F("Value Logger Binary Format"), F("valuelogbin"), Settings.ValueLoggerBinary());
+  addFormNote(F("Writes VALUES.BIN instead of VALUES.CSV. Convert to CSV with tools/espeasyvaluelog"));
 #endif // if FEATURE_SD
 
 
@@ -382,6 +409,7 @@ void handle_advanced() {
   LabelType::Enum labels[]{
 
   LabelType::CPU_ECO_MODE
+  ,LabelType::ALIGN_TASK_READS
   #ifdef ESP8266
   ,LabelType::DEEP_SLEEP_ALTERNATIVE_CALL
   #endif
@@ -364,7 +364,12 @@ void WebServerInit()
 
   // List of headers to be recorded
   // "If-None-Match" is used to see whether we need to serve a static file, or simply can reply with a 304 (not modified)
-  const char *headerkeys[]        = { "If-None-Match" };
+  // "Accept" is used to select CBOR output of the /json page
+  const char *headerkeys[]        = { "If-None-Match"
+#if FEATURE_JSON_CBOR
+                                      , "Accept"
+#endif // if FEATURE_JSON_CBOR
+  };
   constexpr size_t headerkeyssize = NR_ELEMENTS(headerkeys);
   web_server.collectHeaders(headerkeys, headerkeyssize);
   #if defined(ESP8266) || defined(ESP32)
@@ -8,12 +8,15 @@
 #include "../DataStructs/TimingStats.h"
 
 #include "../Globals/Cache.h"
+#include "../Globals/ESPEasy_time.h"
 #include "../Globals/Nodes.h"
 #include "../Globals/Device.h"
 #include "../Globals/Plugins.h"
 #include "../Globals/NPlugins.h"
+#include "../Globals/RuntimeData.h"
 
 #include "../Helpers/_Plugin_init.h"
+#include "../Helpers/CBOR_Writer.h"
 #include "../Helpers/ESPEasyStatistics.h"
 #include "../Helpers/ESPEasy_Storage.h"
 #include "../Helpers/ESPEasy_UnitOfMeasure.h"
@@ -119,6 +122,14 @@ void handle_csvval()
 // ********************************************************************************
 void handle_json()
 {
+#if FEATURE_JSON_CBOR
+
+  if (equals(webArg(F("fmt")), F("cbor")) ||
+      (web_server.header(F("Accept")).indexOf(F("application/cbor")) != -1)) {
+    handle_json_cbor();
+    return;
+  }
+#endif // if FEATURE_JSON_CBOR
   START_TIMER
   const taskIndex_t taskNr    = getFormItemInt(F("tasknr"), INVALID_TASK_INDEX);
   const bool showSpecificTask = validTaskIndex(taskNr);
@@ -444,231 +455,228 @@ void handle_json()
     // Keep track of the lowest reported TTL and use that as refresh interval.
     uint32_t lowest_ttl_json = 60;
     {
-      auto sensorsWriter = showSpecificTask
-        ? mainLevelWriter.createNew()
-        : mainLevelWriter.createChildArray(F("Sensors"));
+      // Task data is streamed directly, without creating writer objects per task and task value
+      JSON_StreamWriter writer;
 
-      if (sensorsWriter) {
-        sensorsWriter->setWriteWhenEmpty();
-        for (taskIndex_t TaskIndex = firstTaskIndex; TaskIndex <= lastActiveTaskIndex && validTaskIndex(TaskIndex); TaskIndex++)
-        {
-          const deviceIndex_t DeviceIndex = getDeviceIndex_from_TaskIndex(TaskIndex);
-
-          if (validDeviceIndex(DeviceIndex))
-          {
-            const uint32_t taskInterval = Settings.TaskDeviceTimer[TaskIndex];
+      if (!showSpecificTask) {
+        mainLevelWriter.write(); // Open the main object, or add a separating comma
+        writer.beginArray(F("Sensors"));
+      }
 
-            auto taskWriter = sensorsWriter->createChild();
+      for (taskIndex_t TaskIndex = firstTaskIndex; TaskIndex <= lastActiveTaskIndex && validTaskIndex(TaskIndex); TaskIndex++)
+      {
+        const deviceIndex_t DeviceIndex = getDeviceIndex_from_TaskIndex(TaskIndex);
 
-            if (taskWriter) {
+        if (validDeviceIndex(DeviceIndex))
+        {
+          const uint32_t taskInterval = Settings.TaskDeviceTimer[TaskIndex];
 
-              // LoadTaskSettings(TaskIndex);
+          if (writer.beginObject()) {
 
-              uint32_t ttl_json = 60; // Default value
+            // LoadTaskSettings(TaskIndex);
 
-              // For simplicity, do the optional values first.
-              const uint8_t valueCount = getValueCountForTask(TaskIndex);
+            uint32_t ttl_json = 60; // Default value
 
-              if (valueCount != 0) {
-                if (Settings.TaskDeviceEnabled[TaskIndex]) {
-                  if (taskInterval == 0) {
-                    ttl_json = 1;
-                  } else {
-                    ttl_json = taskInterval;
-                  }
+            // For simplicity, do the optional values first.
+            const uint8_t valueCount = getValueCountForTask(TaskIndex);
 
-                  if (ttl_json < lowest_ttl_json) {
-                    lowest_ttl_json = ttl_json;
-                  }
+            if (valueCount != 0) {
+              if (Settings.TaskDeviceEnabled[TaskIndex]) {
+                if (taskInterval == 0) {
+                  ttl_json = 1;
+                } else {
+                  ttl_json = taskInterval;
                 }
-                auto taskValueWriter = taskWriter->createChildArray(F("TaskValues"));
 
-                if (taskValueWriter) {
-                  struct EventStruct TempEvent(TaskIndex);
+                if (ttl_json < lowest_ttl_json) {
+                  lowest_ttl_json = ttl_json;
+                }
+              }
+              if (writer.beginArray(F("TaskValues"))) {
+                struct EventStruct TempEvent(TaskIndex);
 
-                  for (uint8_t x = 0; x < valueCount; x++)
-                  {
-                    uint8_t nrDecimals = Cache.getTaskDeviceValueDecimals(TaskIndex, x);
-                    String  value      = formatUserVarNoCheck(&TempEvent, x);
+                for (uint8_t x = 0; x < valueCount; x++)
+                {
+                  uint8_t nrDecimals = Cache.getTaskDeviceValueDecimals(TaskIndex, x);
+                  String  value      = formatUserVarNoCheck(&TempEvent, x);
 #if FEATURE_STRING_VARIABLES
-                    bool hasPresentation;
-                    const String presentation = formatUserVarForPresentation(&TempEvent, x, hasPresentation, value, DeviceIndex);
+                  bool hasPresentation;
+                  const String presentation = formatUserVarForPresentation(&TempEvent, x, hasPresentation, value, DeviceIndex);
 #endif // if FEATURE_STRING_VARIABLES
 
-                    if (mustConsiderAsJSONString(value)) {
-                      // Flag as not to treat as a float
-                      nrDecimals = 255;
-                    }
+                  if (mustConsiderAsJSONString(value)) {
+                    // Flag as not to treat as a float
+                    nrDecimals = 255;
+                  }
 #if FEATURE_TASKVALUE_UNIT_OF_MEASURE
-                    String uom;
-                    const uint8_t uomIndex = Cache.getTaskVarUnitOfMeasure(TaskIndex, x);
+                  String uom;
+                  const uint8_t uomIndex = Cache.getTaskVarUnitOfMeasure(TaskIndex, x);
 
-                    if (uomIndex != 0) {
-                      uom = toUnitOfMeasureName(uomIndex);
-                    }
+                  if (uomIndex != 0) {
+                    uom = toUnitOfMeasureName(uomIndex);
+                  }
 #else // if FEATURE_TASKVALUE_UNIT_OF_MEASURE
-                    const String uom;
+                  const String uom;
 #endif // if FEATURE_TASKVALUE_UNIT_OF_MEASURE
-                    handle_json_stream_task_value_data(taskValueWriter.get(),
-                                                       x + 1,
-                                                       Cache.getTaskDeviceValueName(TaskIndex, x),
-                                                       nrDecimals,
-                                                       value,
+                  handle_json_stream_task_value_data(writer,
+                                                     x + 1,
+                                                     Cache.getTaskDeviceValueName(TaskIndex, x),
+                                                     nrDecimals,
+                                                     value,
 #if FEATURE_STRING_VARIABLES
-                                                       presentation,
+                                                     presentation,
 #else // if FEATURE_STRING_VARIABLES
-                                                       EMPTY_STRING,
+                                                     EMPTY_STRING,
 #endif // if FEATURE_STRING_VARIABLES
-                                                       uom);
-                  }
+                                                     uom);
+                }
 #if FEATURE_STRING_VARIABLES
 
-                  if (Settings.ShowDerivedTaskValues(TaskIndex)) {
-                    int varNr       = VARS_PER_TASK;
-                    String taskName = getTaskDeviceName(TaskIndex);
-                    taskName.toLowerCase();
-                    String postfix;
-                    const String search = getDerivedValueSearchAndPostfix(taskName, postfix);
-
-                    auto it = customStringVar.begin();
-
-                    while (it != customStringVar.end()) {
-                      if (it->first.startsWith(search) && it->first.endsWith(postfix)) {
-                        String valueName = it->first.substring(search.length(), it->first.indexOf('-'));
-                        String uom;
-                        String vType;
-                        const String vname2 = getDerivedValueNameUomAndVType(taskName, valueName, uom, vType);
-
-                        if (!vname2.isEmpty()) {
-                          valueName = vname2;
-                        }
-
-                        if (!it->second.isEmpty()) {
-                          String value(it->second);
-                          stripEscapeCharacters(value);
-                          value = parseTemplate(value);
-                          uint8_t nrDecimals = 255; // FIXME Use the minimal number of decimals needed
-                          bool    hasPresentation;
-                          const String presentation =
-                            formatUserVarForPresentation(&TempEvent,
-                                                         INVALID_TASKVAR_INDEX,
-                                                         hasPresentation,
-                                                         value,
-                                                         DeviceIndex,
-                                                         valueName);
-
-                          handle_json_stream_task_value_data(taskValueWriter.get(),
-                                                             varNr + 1,
-                                                             valueName,
-                                                             nrDecimals,
-                                                             value,
-                                                             presentation,
-                                                             uom);
-                          ++varNr;
-                        }
+                if (Settings.ShowDerivedTaskValues(TaskIndex)) {
+                  int varNr       = VARS_PER_TASK;
+                  String taskName = getTaskDeviceName(TaskIndex);
+                  taskName.toLowerCase();
+                  String postfix;
+                  const String search = getDerivedValueSearchAndPostfix(taskName, postfix);
+
+                  auto it = customStringVar.begin();
+
+                  while (it != customStringVar.end()) {
+                    if (it->first.startsWith(search) && it->first.endsWith(postfix)) {
+                      String valueName = it->first.substring(search.length(), it->first.indexOf('-'));
+                      String uom;
+                      String vType;
+                      const String vname2 = getDerivedValueNameUomAndVType(taskName, valueName, uom, vType);
+
+                      if (!vname2.isEmpty()) {
+                        valueName = vname2;
                       }
-                      else if (it->first.substring(0, search.length()).compareTo(search) > 0) {
-                        break;
+
+                      if (!it->second.isEmpty()) {
+                        String value(it->second);
+                        stripEscapeCharacters(value);
+                        value = parseTemplate(value);
+                        uint8_t nrDecimals = 255; // FIXME Use the minimal number of decimals needed
+                        bool    hasPresentation;
+                        const String presentation =
+                          formatUserVarForPresentation(&TempEvent,
+                                                       INVALID_TASKVAR_INDEX,
+                                                       hasPresentation,
+                                                       value,
+                                                       DeviceIndex,
+                                                       valueName);
+
+                        handle_json_stream_task_value_data(writer,
+                                                           varNr + 1,
+                                                           valueName,
+                                                           nrDecimals,
+                                                           value,
+                                                           presentation,
+                                                           uom);
+                        ++varNr;
                       }
-                      ++it;
                     }
+                    else if (it->first.substring(0, search.length()).compareTo(search) > 0) {
+                      break;
+                    }
+                    ++it;
                   }
-#endif // if FEATURE_STRING_VARIABLES
                 }
+#endif // if FEATURE_STRING_VARIABLES
+                writer.end();
               }
+            }
 
 #if FEATURE_PLUGIN_STATS && FEATURE_CHART_JS
 
-              if (showPluginStats && Device[DeviceIndex].PluginStats) {
-                PluginTaskData_base *taskData = getPluginTaskDataBaseClassOnly(TaskIndex);
+            if (showPluginStats && Device[DeviceIndex].PluginStats) {
+              PluginTaskData_base *taskData = getPluginTaskDataBaseClassOnly(TaskIndex);
 
-                if ((taskData != nullptr) && (taskData->nrSamplesPresent() > 0)) {
-                  stream_comma_newline();
-                  addHtml(F("\"PluginStats\":\n"));
-                  taskData->plot_ChartJS(true);
-                }
+              if ((taskData != nullptr) && (taskData->nrSamplesPresent() > 0)) {
+                writer.key(F("PluginStats"));
+                addHtml('\n');
+                taskData->plot_ChartJS(true);
               }
+            }
 #endif // if FEATURE_PLUGIN_STATS && FEATURE_CHART_JS
 
 
-              if (showDataAcquisition) {
-                auto dataAquisitionWriter = taskWriter->createChildArray(F("DataAcquisition"));
-
-                if (dataAquisitionWriter) {
-                  for (controllerIndex_t x = 0; x < CONTROLLER_MAX; x++)
-                  {
-                    auto controllerWriter = dataAquisitionWriter->createChild();
-
-                    if (controllerWriter) {
-                      controllerWriter->write({ F("Controller"), x + 1 });
-                      controllerWriter->write({ F("IDX"),        Settings.TaskDeviceID[x][TaskIndex] });
-                      controllerWriter->write({ F("Enabled"),    !!Settings.TaskDeviceSendData[x][TaskIndex] });
-                    }
+            if (showDataAcquisition) {
+              if (writer.beginArray(F("DataAcquisition"))) {
+                for (controllerIndex_t x = 0; x < CONTROLLER_MAX; x++)
+                {
+                  if (writer.beginObject()) {
+                    writer.write(F("Controller"), x + 1);
+                    writer.write(F("IDX"),        Settings.TaskDeviceID[x][TaskIndex]);
+                    writer.write(F("Enabled"),    !!Settings.TaskDeviceSendData[x][TaskIndex]);
+                    writer.end();
                   }
                 }
+                writer.end();
               }
+            }
 
-              if (showTaskDetails) {
-                taskWriter->write({ F("TaskInterval"),     taskInterval });
-                taskWriter->write({ F("Type"),             getPluginNameFromDeviceIndex(DeviceIndex) });
-                taskWriter->write({ F("TaskName"),         getTaskDeviceName(TaskIndex) });
-                taskWriter->write({ F("TaskDeviceNumber"), Settings.getPluginID_for_task(TaskIndex).value });
+            if (showTaskDetails) {
+              writer.write(F("TaskInterval"),     taskInterval);
+              writer.write(F("Type"),             getPluginNameFromDeviceIndex(DeviceIndex));
+              writer.write(F("TaskName"),         getTaskDeviceName(TaskIndex));
+              writer.write(F("TaskDeviceNumber"), static_cast<int>(Settings.getPluginID_for_task(TaskIndex).value));
 
-                for (int i = 0; i < 3; i++) {
-                  if (Settings.TaskDevicePin[i][TaskIndex] >= 0) {
-                    taskWriter->write({ concat(F("TaskDeviceGPIO"), i + 1), static_cast<int>(Settings.TaskDevicePin[i][TaskIndex]) });
-                  }
+              for (int i = 0; i < 3; i++) {
+                if (Settings.TaskDevicePin[i][TaskIndex] >= 0) {
+                  writer.write(concat(F("TaskDeviceGPIO"), i + 1), static_cast<int>(Settings.TaskDevicePin[i][TaskIndex]));
                 }
+              }
 
 #if FEATURE_I2CMULTIPLEXER
-                uint8_t i2cBus = 0;
+              uint8_t i2cBus = 0;
 # if FEATURE_I2C_MULTIPLE
-                i2cBus = Settings.getI2CInterface(TaskIndex);
+              i2cBus = Settings.getI2CInterface(TaskIndex);
 # endif
 
-                if ((Device[DeviceIndex].Type == DEVICE_TYPE_I2C) && isI2CMultiplexerEnabled(i2cBus)) {
+              if ((Device[DeviceIndex].Type == DEVICE_TYPE_I2C) && isI2CMultiplexerEnabled(i2cBus)) {
 # if FEATURE_I2C_MULTIPLE
-                  taskWriter->write({ F("I2C_Interface"), static_cast<int>(i2cBus + 1) });
+                writer.write(F("I2C_Interface"), static_cast<int>(i2cBus + 1));
 # endif
-                  int8_t channel = Settings.I2C_Multiplexer_Channel[TaskIndex];
-
-                  if (bitRead(Settings.I2C_SPI_bus_Flags[TaskIndex], I2C_FLAGS_MUX_MULTICHANNEL)) {
-
-                    KeyValueStruct kv(F("I2CBus"));
-
-                    addHtml(F("\"I2CBus\" : ["));
+                int8_t channel = Settings.I2C_Multiplexer_Channel[TaskIndex];
 
+                if (bitRead(Settings.I2C_SPI_bus_Flags[TaskIndex], I2C_FLAGS_MUX_MULTICHANNEL)) {
+                  if (writer.beginArray(F("I2CBus"))) {
                     for (uint8_t c = 0; c < I2CMultiplexerMaxChannels(i2cBus); ++c) {
                       if (bitRead(channel, c)) {
-                        kv.appendValue(concat(F("Multiplexer channel "), c));
+                        writer.value(concat(F("Multiplexer channel "), c));
                       }
                     }
-                    taskWriter->write(kv);
+                    writer.end();
+                  }
+                } else {
+                  if (channel == -1) {
+                    writer.write(F("I2Cbus"), F("Standard I2C bus"));
                   } else {
-                    if (channel == -1) {
-                      taskWriter->write({ F("I2Cbus"), F("Standard I2C bus") });
-                    } else {
-                      taskWriter->write({ F("I2Cbus"), concat(F("Multiplexer channel "), channel) });
-                    }
+                    writer.write(F("I2Cbus"), concat(F("Multiplexer channel "), channel));
                   }
                 }
-#endif // if FEATURE_I2CMULTIPLEXER
               }
+#endif // if FEATURE_I2CMULTIPLEXER
+            }
 
-              taskWriter->write({ F("TaskEnabled"),
-                                  Settings.TaskDeviceEnabled[TaskIndex] });
-              taskWriter->write({ F("TaskNumber"), TaskIndex + 1 });
+            writer.write(F("TaskEnabled"), static_cast<bool>(Settings.TaskDeviceEnabled[TaskIndex]));
+            writer.write(F("TaskNumber"),  TaskIndex + 1);
 
-              if (showSpecificTask) {
+            if (showSpecificTask) {
 #if FEATURE_TASKVALUE_UNIT_OF_MEASURE
-                taskWriter->write({ F("ShowUoM"), Settings.ShowUnitOfMeasureOnDevicesPage() });
+              writer.write(F("ShowUoM"), Settings.ShowUnitOfMeasureOnDevicesPage());
 #endif // if FEATURE_TASKVALUE_UNIT_OF_MEASURE
-                taskWriter->write({ F("TTL"),     ttl_json * 1000 });
-              }
+              writer.write(F("TTL"),     ttl_json * 1000);
             }
+            writer.end();
           }
         }
       }
+
+      if (!showSpecificTask) {
+        writer.end(); // Sensors
+      }
     }
 
     if (!showSpecificTask) {
@@ -683,33 +691,131 @@ void handle_json()
   STOP_TIMER(HANDLE_SERVING_WEBPAGE_JSON);
 }
 
-void handle_json_stream_task_value_data(KeyValueWriter*parent,
-                                        uint16_t       valueNumber,
-                                        const String & valueName,
-                                        uint8_t        nrDecimals,
-                                        const String & value,
-                                        const String & presentation,
-                                        const String & uom)
+void handle_json_stream_task_value_data(JSON_StreamWriter& writer,
+                                        uint16_t           valueNumber,
+                                        const String     & valueName,
+                                        uint8_t            nrDecimals,
+                                        const String     & value,
+                                        const String     & presentation,
+                                        const String     & uom)
 {
-  auto writer = parent->createChild();
-
-  if (writer) {
-    writer->write({ F("ValueNumber"), valueNumber });
-    writer->write({ F("Name"),        valueName });
-    writer->write({ F("NrDecimals"),  nrDecimals });
+  if (writer.beginObject()) {
+    writer.write(F("ValueNumber"), static_cast<int>(valueNumber));
+    writer.write(F("Name"),        valueName);
+    writer.write(F("NrDecimals"),  static_cast<int>(nrDecimals));
 #if FEATURE_STRING_VARIABLES
 
     if (!presentation.isEmpty()) {
-      writer->write({ F("Presentation"), presentation });
+      writer.write(F("Presentation"), presentation);
     }
 #endif // if FEATURE_STRING_VARIABLES
 
     if (!uom.isEmpty()) {
-      writer->write({ F("UoM"), uom });
+      writer.write(F("UoM"), uom);
+    }
+    writer.write(F("Value"), value);
+    writer.end();
+  }
+}
+
+#if FEATURE_JSON_CBOR
+
+// ********************************************************************************
+// Task values in CBOR format, only the values as stored, without formatting
+// ********************************************************************************
+void handle_json_cbor()
+{
+  START_TIMER
+  const taskIndex_t taskNr       = getFormItemInt(F("tasknr"), INVALID_TASK_INDEX);
+  const bool showSpecificTask    = validTaskIndex(taskNr);
+  const uint32_t since           = getFormItemInt(F("since"), 0);
+  const uint32_t updateSequence  = UserVar.getUpdateSequence();
+  const String   updateSeqString = String(updateSequence);
+
+  if (equals(stripQuotes(web_server.header(F("If-None-Match"))), updateSeqString)) {
+    // No task values were sent since the previous request
+    web_server.send(304, String(F("application/cbor")), EMPTY_STRING);
+    return;
+  }
+  sendHeader(F("ETag"), wrap_String(updateSeqString, '"'));
+  TXBuffer.startStream(F("application/cbor"), F(""));
+
+  taskIndex_t firstTaskIndex = 0;
+  taskIndex_t lastTaskIndex  = TASKS_MAX - 1;
+
+  if (showSpecificTask)
+  {
+    firstTaskIndex = taskNr - 1;
+    lastTaskIndex  = taskNr - 1;
+  }
+
+  CBOR_beginMap(3);
+  CBOR_writeString(F("seq"));
+  CBOR_writeUInt(updateSequence);
+  CBOR_writeString(F("time"));
+  CBOR_writeUInt(node_time.getUnixTime());
+  CBOR_writeString(F("tasks"));
+  CBOR_beginArray();
+
+  for (taskIndex_t TaskIndex = firstTaskIndex; TaskIndex <= lastTaskIndex && validTaskIndex(TaskIndex); TaskIndex++)
+  {
+    const uint32_t taskSequence = UserVar.getUpdateSequence(TaskIndex);
+
+    if (Settings.TaskDeviceEnabled[TaskIndex] &&
+        validDeviceIndex(getDeviceIndex_from_TaskIndex(TaskIndex)) &&
+        ((since == 0) || (taskSequence > since)))
+    {
+      struct EventStruct TempEvent(TaskIndex);
+      const Sensor_VType sensorType = TempEvent.getSensorType();
+      const uint8_t valueCount      = getValueCountForTask(TaskIndex);
+
+      // [task nr, sequence nr, unix time, [values]]
+      CBOR_beginArray(4);
+      CBOR_writeUInt(TaskIndex + 1);
+      CBOR_writeUInt(taskSequence);
+      CBOR_writeUInt(UserVar.getUpdateTime(TaskIndex));
+      CBOR_beginArray(valueCount);
+
+      for (uint8_t x = 0; x < valueCount; x++)
+      {
+        handle_json_cbor_task_value(TaskIndex, x, sensorType);
+      }
     }
-    writer->write({ F("Value"), value });
+  }
+  CBOR_writeBreak();
+
+  TXBuffer.endStream();
+  STOP_TIMER(HANDLE_SERVING_WEBPAGE_JSON);
+}
+
+void handle_json_cbor_task_value(taskIndex_t    taskIndex,
+                                 taskVarIndex_t varNr,
+                                 Sensor_VType   sensorType)
+{
+  if (sensorType == Sensor_VType::SENSOR_TYPE_ULONG) {
+    CBOR_writeUInt(UserVar.getSensorTypeLong(taskIndex));
+  } else if (isFloatOutputDataType(sensorType)) {
+    CBOR_writeFloat(UserVar.getFloat(taskIndex, varNr));
+  } else if (isUInt32OutputDataType(sensorType)) {
+    CBOR_writeUInt(UserVar.getUint32(taskIndex, varNr));
+# if FEATURE_EXTENDED_TASK_VALUE_TYPES
+  } else if (isInt32OutputDataType(sensorType)) {
+    CBOR_writeInt(UserVar.getInt32(taskIndex, varNr));
+  } else if (isUInt64OutputDataType(sensorType)) {
+    CBOR_writeUInt(UserVar.getUint64(taskIndex, varNr));
+  } else if (isInt64OutputDataType(sensorType)) {
+    CBOR_writeInt(UserVar.getInt64(taskIndex, varNr));
+#  if FEATURE_USE_DOUBLE_AS_ESPEASY_RULES_FLOAT_TYPE
+  } else if (isDoubleOutputDataType(sensorType)) {
+    CBOR_writeDouble(UserVar.getDouble(taskIndex, varNr));
+#  endif // if FEATURE_USE_DOUBLE_AS_ESPEASY_RULES_FLOAT_TYPE
+# endif  // if FEATURE_EXTENDED_TASK_VALUE_TYPES
+  } else {
+    CBOR_writeNull();
   }
 }
+
+#endif // if FEATURE_JSON_CBOR
 #endif
 
 // ********************************************************************************
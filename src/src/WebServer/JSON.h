@@ -4,6 +4,10 @@
 
 #include "../WebServer/common.h"
 
+#include "../DataTypes/SensorVType.h"
+#include "../DataTypes/TaskIndex.h"
+
+#include "../Helpers/JSON_StreamWriter.h"
 #include "../Helpers/KeyValueWriter_JSON.h"
 
 // ********************************************************************************
@@ -19,13 +23,26 @@ void handle_csvval();
 // ********************************************************************************
 void handle_json();
 
-void handle_json_stream_task_value_data(KeyValueWriter* parent,
-                                        uint16_t       valueNumber,
-                                        const String & valueName,
-                                        uint8_t        nrDecimals,
-                                        const String & value,
-                                        const String & presentation,
-                                        const String & uom);
+void handle_json_stream_task_value_data(JSON_StreamWriter& writer,
+                                        uint16_t           valueNumber,
+                                        const String     & valueName,
+                                        uint8_t            nrDecimals,
+                                        const String     & value,
+                                        const String     & presentation,
+                                        const String     & uom);
+
+#if FEATURE_JSON_CBOR
+
+// Task values in CBOR format, selected via ?fmt=cbor or "Accept: application/cbor"
+// Optional arguments:
+// - tasknr: Only this task (starting at 1)
+// - since:  Only tasks with values sent after this sequence nr
+void handle_json_cbor();
+
+void handle_json_cbor_task_value(taskIndex_t    taskIndex,
+                                 taskVarIndex_t varNr,
+                                 Sensor_VType   sensorType);
+#endif // if FEATURE_JSON_CBOR
 #endif
 // ********************************************************************************
 // JSON formatted timing statistics
@@ -5,7 +5,12 @@
 #include "../../ESPEasy/net/ESPEasyNetwork.h"
 #include "../../ESPEasy/net/wifi/ESPEasyWifi.h"
 #include "../../_Plugin_Helper.h"
+#include "../DataStructs/TimingStats.h"
+#include "../Globals/Logging.h"
 #include "../Helpers/ESPEasyStatistics.h"
+#include "../Helpers/Hardware_temperature_sensor.h"
+#include "../Helpers/Memory.h"
+#include "../Helpers/SD_ValueLogger.h"
 #include "../Static/WebStaticData.h"
 
 #ifdef WEBSERVER_METRICS
@@ -14,144 +19,313 @@
 #  include <esp_partition.h>
 # endif // ifdef ESP32
 
+# include <map>
+
+// Pre-rendered series descriptors (metric name + labels) per task.
+// Only the numeric values need to be formatted per scrape.
+struct MetricsSeriesDescriptor {
+  // "# HELP" and "# TYPE" lines
+  String header;
+
+  // "espeasy_device_<name>{valueName="<valueName>"} " per task value
+  String  valuePrefix[VARS_PER_TASK];
+  uint8_t valueCount{};
+};
+
+std::map<taskIndex_t, MetricsSeriesDescriptor> metrics_seriesCache;
+
+
 void handle_metrics() {
   TXBuffer.startStream(F("text/plain"), F("*"));
-  const __FlashStringHelper *prefixHELP = F("# HELP espeasy_");
-  const __FlashStringHelper *prefixTYPE = F("# TYPE espeasy_");
 
   // uptime
-  addHtml(prefixHELP);
-  addHtml(F("uptime current device uptime in minutes\n"));
-  addHtml(prefixTYPE);
-  addHtml(F("uptime counter\n"));
-  addHtml(F("espeasy_uptime "));
-  addHtml(getValue(LabelType::UPTIME));
+  addHtml(F("# HELP espeasy_uptime current device uptime in minutes\n"
+            "# TYPE espeasy_uptime counter\n"
+            "espeasy_uptime "));
+  addHtmlInt(getUptimeMinutes());
   addHtml('\n');
 
   // load
-  addHtml(prefixHELP);
-  addHtml(F("load device percentage load\n"));
-  addHtml(prefixTYPE);
-  addHtml(F("load gauge\n"));
-  addHtml(F("espeasy_load "));
-  addHtml(getValue(LabelType::LOAD_PCT));
-  addHtml('\n');
+  addHtml(F("# HELP espeasy_load device percentage load\n"
+            "# TYPE espeasy_load gauge\n"));
+
+  if (wdcounter > 0) {
+    addHtml(F("espeasy_load "));
+    addHtmlFloat(getCPUload(), 2);
+    addHtml('\n');
+  }
 
   // Free RAM
-  addHtml(prefixHELP);
-  addHtml(F("free_ram device amount of RAM free in Bytes\n"));
-  addHtml(prefixTYPE);
-  addHtml(F("free_ram gauge\n"));
-  addHtml(F("espeasy_free_ram "));
-  addHtml(getValue(LabelType::FREE_MEM));
+  addHtml(F("# HELP espeasy_free_ram device amount of RAM free in Bytes\n"
+            "# TYPE espeasy_free_ram gauge\n"
+            "espeasy_free_ram "));
+  addHtmlInt(FreeMem());
   addHtml('\n');
 
-  // Free RAM
-  addHtml(prefixHELP);
-  addHtml(F("free_stack device amount of Stack free in Bytes\n"));
-  addHtml(prefixTYPE);
-  addHtml(F("free_stack gauge\n"));
-  addHtml(F("espeasy_free_stack "));
-  addHtml(getValue(LabelType::FREE_STACK));
+  // Free Stack
+  addHtml(F("# HELP espeasy_free_stack device amount of Stack free in Bytes\n"
+            "# TYPE espeasy_free_stack gauge\n"
+            "espeasy_free_stack "));
+  addHtmlInt(getCurrentFreeStack());
   addHtml('\n');
 
   // Wifi strength
-  addHtml(prefixHELP);
-  addHtml(F("wifi_rssi Wifi connection Strength\n"));
-  addHtml(prefixTYPE);
-  addHtml(F("wifi_rssi gauge\n"));
-  addHtml(F("espeasy_wifi_rssi "));
-  addHtml(getValue(LabelType::WIFI_RSSI));
-  addHtml('\n');
+  addHtml(F("# HELP espeasy_wifi_rssi Wifi connection Strength\n"
+            "# TYPE espeasy_wifi_rssi gauge\n"));
+
+  if (ESPEasy::net::wifi::WiFiConnected()) {
+    addHtml(F("espeasy_wifi_rssi "));
+    addHtmlInt(static_cast<int32_t>(WiFi.RSSI()));
+    addHtml('\n');
+  }
 
   // Wifi uptime
-  addHtml(prefixHELP);
-  addHtml(F("wifi_connected Time wifi has been connected in milliseconds\n"));
-  addHtml(prefixTYPE);
-  addHtml(F("wifi_connected counter\n"));
-  addHtml(F("espeasy_wifi_connected "));
-  addHtml(getValue(LabelType::CONNECTED_MSEC));
+  addHtml(F("# HELP espeasy_wifi_connected Time wifi has been connected in milliseconds\n"
+            "# TYPE espeasy_wifi_connected counter\n"
+            "espeasy_wifi_connected "));
+  addHtmlInt(ESPEasy::net::NetworkConnectDuration_ms());
   addHtml('\n');
 
   // Wifi reconnects
-  addHtml(prefixHELP);
-  addHtml(F("wifi_reconnects Number of times Wifi has reconnected since boot\n"));
-  addHtml(prefixTYPE);
-  addHtml(F("wifi_reconnects counter\n"));
-  addHtml(F("espeasy_wifi_reconnects "));
-  addHtml(getValue(LabelType::NUMBER_RECONNECTS));
+  addHtml(F("# HELP espeasy_wifi_reconnects Number of times Wifi has reconnected since boot\n"
+            "# TYPE espeasy_wifi_reconnects counter\n"
+            "espeasy_wifi_reconnects "));
+  addHtmlInt(ESPEasy::net::NetworkConnectCount());
   addHtml('\n');
 
   # if FEATURE_INTERNAL_TEMPERATURE
 
   // CPU Temperature
-  addHtml(prefixHELP);
-  addHtml(F("cpu_temperature Level of CPU temperature in Celcius\n"));
-  addHtml(prefixTYPE);
-  addHtml(F("cpu_temperature gauge\n"));
-  addHtml(F("espeasy_cpu_temperature "));
-  addHtml(getValue(LabelType::INTERNAL_TEMPERATURE));
+  addHtml(F("# HELP espeasy_cpu_temperature Level of CPU temperature in Celcius\n"
+            "# TYPE espeasy_cpu_temperature gauge\n"
+            "espeasy_cpu_temperature "));
+  addHtmlFloat(getInternalTemperature(), 1);
   addHtml('\n');
   # endif // if FEATURE_INTERNAL_TEMPERATURE
 
+  # if FEATURE_SD
+
+  // Value log lines not yet written to the SD card
+  addHtml(F("# HELP espeasy_sd_valuelogger_buffered_bytes Bytes buffered to be written to the SD card value log\n"
+            "# TYPE espeasy_sd_valuelogger_buffered_bytes gauge\n"
+            "espeasy_sd_valuelogger_buffered_bytes "));
+  addHtmlInt(static_cast<uint32_t>(SD_ValueLogger_bufferedBytes()));
+  addHtml('\n');
+  # endif // if FEATURE_SD
+
+  # if FEATURE_SYSLOG
+  {
+    const SyslogWriter::Stats& stats = syslogWriter.getStats();
+
+    addHtml(F("# HELP espeasy_syslog_messages_sent Number of log messages sent to the syslog server\n"
+              "# TYPE espeasy_syslog_messages_sent counter\n"
+              "espeasy_syslog_messages_sent "));
+    addHtmlInt(stats.messagesSent);
+    addHtml(F("\n# HELP espeasy_syslog_bytes_sent Number of bytes sent to the syslog server\n"
+              "# TYPE espeasy_syslog_bytes_sent counter\n"
+              "espeasy_syslog_bytes_sent "));
+    addHtmlInt(stats.bytesSent);
+    addHtml(F("\n# HELP espeasy_syslog_messages_dropped Number of log messages expired before they could be sent to the syslog server\n"
+              "# TYPE espeasy_syslog_messages_dropped counter\n"
+              "espeasy_syslog_messages_dropped "));
+    addHtmlInt(syslogWriter.getNrDropped());
+    addHtml('\n');
+  }
+  # endif // if FEATURE_SYSLOG
+
+  # if FEATURE_TIMING_STATS
+  handle_metrics_timing_stats();
+  # endif // if FEATURE_TIMING_STATS
+
   // devices
   handle_metrics_devices();
 
   TXBuffer.endStream();
 }
 
+const MetricsSeriesDescriptor& metrics_getSeriesDescriptor(taskIndex_t taskIndex) {
+  auto it = metrics_seriesCache.find(taskIndex);
+
+  if (it != metrics_seriesCache.end()) {
+    return it->second;
+  }
+
+  MetricsSeriesDescriptor& descr = metrics_seriesCache[taskIndex];
+  String deviceName              = getTaskDeviceName(taskIndex);
+
+  if (deviceName.isEmpty()) { // Empty name, then use taskN
+    deviceName  = F("task");
+    deviceName += taskIndex + 1;
+  }
+  descr.header = strformat(
+    F("# HELP espeasy_device_%s Values from connected device\n"
+      "# TYPE espeasy_device_%s gauge\n"),
+    deviceName.c_str(),
+    deviceName.c_str());
+
+  descr.valueCount = getValueCountForTask(taskIndex);
+
+  for (uint8_t varNr = 0; varNr < descr.valueCount && varNr < VARS_PER_TASK; varNr++) {
+    descr.valuePrefix[varNr] = strformat(
+      F("espeasy_device_%s{valueName=\"%s\"} "),
+      deviceName.c_str(),
+      Cache.getTaskDeviceValueName(taskIndex, varNr).c_str());
+  }
+  return descr;
+}
+
+void metrics_clearSeriesCache() {
+  metrics_seriesCache.clear();
+}
+
+void metrics_clearSeriesCache(taskIndex_t taskIndex) {
+  auto it = metrics_seriesCache.find(taskIndex);
+
+  if (it != metrics_seriesCache.end()) {
+    metrics_seriesCache.erase(it);
+  }
+}
+
 void handle_metrics_devices() {
   for (taskIndex_t x = 0; validTaskIndex(x); x++) {
-    const deviceIndex_t DeviceIndex = getDeviceIndex_from_TaskIndex(x);
-    const bool pluginID_set         = INVALID_PLUGIN_ID != Settings.getPluginID_for_task(x);
+    const pluginID_t pluginID = Settings.getPluginID_for_task(x);
 
-    if (pluginID_set) {
-      if (Settings.TaskDeviceEnabled[x]) {
-        String deviceName = getTaskDeviceName(x);
+    if ((INVALID_PLUGIN_ID != pluginID) && Settings.TaskDeviceEnabled[x]) {
+      const MetricsSeriesDescriptor& descr = metrics_getSeriesDescriptor(x);
 
-        if (deviceName.isEmpty()) { // Empty name, then use taskN
-          deviceName  = F("task");
-          deviceName += x + 1;
-        }
-        addHtml(F("# HELP espeasy_device_"));
-        addHtml(deviceName);
-        addHtml(F(" Values from connected device\n"));
-        addHtml(F("# TYPE espeasy_device_"));
-        addHtml(deviceName);
-        addHtml(F(" gauge\n"));
-
-        if (validDeviceIndex(DeviceIndex)) {
-          String customValuesString;
-
-          // const bool customValues = PluginCall(PLUGIN_WEBFORM_SHOW_VALUES, &TempEvent, customValuesString);
-          const bool customValues = 0; // TODO: handle custom values
-
-          if (!customValues) {
-            const uint8_t valueCount = getValueCountForTask(x);
-            struct EventStruct TempEvent(x);
-
-            for (uint8_t varNr = 0; varNr < valueCount; varNr++) {
-              if (validPluginID_fullcheck(Settings.getPluginID_for_task(x))) {
-                addHtml(F("espeasy_device_"));
-                addHtml(deviceName);
-                addHtml(F("{valueName=\""));
-                addHtml(Cache.getTaskDeviceValueName(x, varNr));
-                addHtml(F("\"} "));
-                const String value(formatUserVarNoCheck(&TempEvent, varNr));
-
-                if (value.isEmpty()) {
-                  addHtml('0'); // Return 0 for not-set values
-                } else {
-                  addHtml(value);
-                }
-                addHtml('\n');
-              }
-            }
+      addHtml(descr.header);
+
+      // TODO: handle custom values (PLUGIN_WEBFORM_SHOW_VALUES)
+      if (validDeviceIndex(getDeviceIndex_from_TaskIndex(x)) &&
+          validPluginID_fullcheck(pluginID)) {
+        struct EventStruct TempEvent(x);
+
+        for (uint8_t varNr = 0; varNr < descr.valueCount; varNr++) {
+          addHtml(descr.valuePrefix[varNr]);
+          const String value(formatUserVarNoCheck(&TempEvent, varNr));
+
+          if (value.isEmpty()) {
+            addHtml('0'); // Return 0 for not-set values
+          } else {
+            addHtml(value);
           }
+          addHtml('\n');
         }
       }
     }
   }
 }
 
+# if FEATURE_TIMING_STATS
+
+void handle_metrics_timing_stats_label(const String& label) {
+  if (!label.isEmpty()) {
+    addHtml('{');
+    addHtml(label);
+    addHtml('}');
+  }
+  addHtml(' ');
+}
+
+// @param label  Optional label to add, e.g. queue="C001"
+void handle_metrics_timing_stats_series(const __FlashStringHelper *name,
+                                        const String             & label,
+                                        const TimingStats        & stats) {
+  uint32_t minVal{};
+  uint32_t maxVal{};
+  const uint32_t count = stats.getMinMax(minVal, maxVal);
+
+#if FEATURE_TIMING_STATS_HISTOGRAM
+  const uint8_t percentiles[] = { 50, 95, 99 };
+
+  for (size_t i = 0; i < NR_ELEMENTS(percentiles); ++i) {
+    addHtml(name);
+    addHtml('{');
+
+    if (!label.isEmpty()) {
+      addHtml(label);
+      addHtml(',');
+    }
+    addHtml(F("quantile=\"0."));
+    addHtmlInt(percentiles[i]);
+    addHtml(F("\"} "));
+    addHtmlInt(stats.getPercentile(percentiles[i]));
+    addHtml('\n');
+  }
+#endif // if FEATURE_TIMING_STATS_HISTOGRAM
+
+  addHtml(name);
+  addHtml(F("_sum"));
+  handle_metrics_timing_stats_label(label);
+  addHtmlInt(stats.getTotal());
+  addHtml('\n');
+  addHtml(name);
+  addHtml(F("_count"));
+  handle_metrics_timing_stats_label(label);
+  addHtmlInt(count);
+  addHtml('\n');
+}
+
+void handle_metrics_timing_stats() {
+  // Timing stats are only collected when enabled in the Advanced settings.
+  // Counters are reset when the timing stats page is viewed.
+  if (!Settings.EnableTimingStats()) { return; }
+
+  auto it = miscStats.find(TimingStatsElements::LOOP_STATS);
+
+  if (it != miscStats.end()) {
+    addHtml(F("# HELP espeasy_loop_duration_usec Duration of loop() in usec\n"
+              "# TYPE espeasy_loop_duration_usec summary\n"));
+    handle_metrics_timing_stats_series(F("espeasy_loop_duration_usec"), EMPTY_STRING, it->second);
+  }
+
+  it = miscStats.find(TimingStatsElements::RULES_PROCESSING);
+
+  if (it != miscStats.end()) {
+    addHtml(F("# HELP espeasy_rules_duration_usec Duration of processing an event in rules in usec\n"
+              "# TYPE espeasy_rules_duration_usec summary\n"));
+    handle_metrics_timing_stats_series(F("espeasy_rules_duration_usec"), EMPTY_STRING, it->second);
+  }
+
+  #  if FEATURE_SD
+  it = miscStats.find(TimingStatsElements::SD_VALUELOGGER_FLUSH);
+
+  if (it != miscStats.end()) {
+    addHtml(F("# HELP espeasy_sd_valuelogger_flush_usec Duration of writing buffered values to the SD card in usec\n"
+              "# TYPE espeasy_sd_valuelogger_flush_usec summary\n"));
+    handle_metrics_timing_stats_series(F("espeasy_sd_valuelogger_flush_usec"), EMPTY_STRING, it->second);
+  }
+  #  endif // if FEATURE_SD
+
+  bool headerSent = false;
+
+  for (it = miscStats.begin(); it != miscStats.end(); ++it) {
+    const TimingStatsElements stat = it->first;
+    String queue;
+
+    if (stat == TimingStatsElements::MQTT_DELAY_QUEUE) {
+      queue = F("MQTT");
+    } else if ((stat >= TimingStatsElements::C001_DELAY_QUEUE) &&
+               (stat <= TimingStatsElements::C025_DELAY_QUEUE)) {
+      queue = get_formatted_Controller_number(static_cast<cpluginID_t>(
+                                                static_cast<int>(stat) -
+                                                static_cast<int>(TimingStatsElements::C001_DELAY_QUEUE) + 1));
+    }
+
+    if (!queue.isEmpty()) {
+      if (!headerSent) {
+        addHtml(F("# HELP espeasy_controller_queue_duration_usec Duration of processing a controller queue in usec\n"
+                  "# TYPE espeasy_controller_queue_duration_usec summary\n"));
+        headerSent = true;
+      }
+      handle_metrics_timing_stats_series(
+        F("espeasy_controller_queue_duration_usec"),
+        strformat(F("queue=\"%s\""), queue.c_str()),
+        it->second);
+    }
+  }
+}
+
+# endif // if FEATURE_TIMING_STATS
+
 #endif // WEBSERVER_METRICS
@@ -7,6 +7,13 @@
 
 void handle_metrics();
 void handle_metrics_devices();
+#if FEATURE_TIMING_STATS
+void handle_metrics_timing_stats();
+#endif // if FEATURE_TIMING_STATS
+
+// Must be called when task names or value names have changed.
+void metrics_clearSeriesCache();
+void metrics_clearSeriesCache(taskIndex_t taskIndex);
 
 #endif    // ifdef WEBSERVER_METRICS
 
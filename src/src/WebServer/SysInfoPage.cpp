@@ -14,16 +14,22 @@
 #endif
 # include "../../ESPEasy/net/wifi/ESPEasyWifi.h"
 # include "../Commands/Diagnostic.h"
+# ifdef USE_RTOS_MULTITASKING
+#  include "../ESPEasyCore/ESPEasy_RTOS_tasks.h"
+# endif // ifdef USE_RTOS_MULTITASKING
 # include "../CustomBuild/CompiletimeDefines.h"
 # include "../DataStructs/RTCStruct.h"
 # include "../Globals/CRCValues.h"
 # include "../Globals/ESPEasy_time.h"
 # include "../Globals/RTC.h"
 # include "../Globals/Settings.h"
+# include "../Globals/Statistics.h"
 # include "../Helpers/Convert.h"
 # include "../Helpers/ESPEasyStatistics.h"
 # include "../Helpers/ESPEasy_Storage.h"
+# include "../Helpers/ESPEasy_time_calc.h"
 # include "../Helpers/Hardware_device_info.h"
+# include "../Helpers/I2C_BusScheduler.h"
 # include "../Helpers/KeyValueWriter_JSON.h"
 # include "../Helpers/Memory.h"
 # include "../Helpers/Misc.h"
@@ -296,6 +302,10 @@ void handle_sysinfo() {
 #  ifndef WEBSERVER_SYSINFO_MINIMAL
   handle_sysinfo_SystemStatus();
 
+#   if FEATURE_I2C_BUS_SCHEDULER
+  handle_sysinfo_I2C();
+#   endif // if FEATURE_I2C_BUS_SCHEDULER
+
   handle_sysinfo_NetworkServices();
 
   handle_sysinfo_ESP_Board();
@@ -557,10 +567,80 @@ void handle_sysinfo_SystemStatus() {
   };
 
   addRowLabelValues(labels);
+
+#   if FEATURE_SETTINGS_READ_BATCH
+  {
+    const SettingsReadBatchStats& stats = getBootSettingsReadBatchStats();
+    addRowLabel(F("Boot Settings Load"));
+    addHtml(strformat(F("%u ms (%u reads, %u file opens)"), stats.duration_msec, stats.reads, stats.fileOpens));
+  }
+#   endif // if FEATURE_SETTINGS_READ_BATCH
+  addRowLabel(F("Boot to First Sensor Read"));
+
+  if (firstSensorReadMoment == 0) {
+    addHtml('-');
+  } else {
+    addHtmlInt(firstSensorReadMoment);
+    addUnit(F("ms"));
+  }
+#   ifdef USE_RTOS_MULTITASKING
+
+  if (RTOS_getServerTaskCore() >= 0) {
+    addRowLabel(F("Main Loop Core"));
+    addHtmlInt(RTOS_getMainLoopCore());
+
+    addRowLabel(F("Main Loop Load"));
+    addHtmlFloat(RTOS_getMainLoopLoad() / 10.0f, 1);
+    addUnit('%');
+
+    addRowLabel(F("Server Task Core"));
+    addHtmlInt(RTOS_getServerTaskCore());
+
+    addRowLabel(F("Server Task Load"));
+    addHtmlFloat(RTOS_getServerTaskLoad() / 10.0f, 1);
+    addUnit('%');
+  }
+#   endif // ifdef USE_RTOS_MULTITASKING
 }
 
 #  endif // ifndef WEBSERVER_SYSINFO_MINIMAL
 
+#  if !defined(WEBSERVER_SYSINFO_MINIMAL) && FEATURE_I2C_BUS_SCHEDULER
+
+void handle_sysinfo_I2C() {
+  if (Settings.getNrConfiguredI2C_buses() == 0) {
+    return;
+  }
+  addTableSeparator(F("I2C Bus Statistics"), 2, 3);
+
+  // All buses are cleared at the same moment, by initI2C() or the command I2CStatsReset
+  addRowLabel(F("Statistics Since"));
+  addHtml(format_msec_duration(timePassedSince(I2C_getBusStats(0).statsStart)));
+
+  for (uint8_t i2cBus = 0; i2cBus < getI2CBusCount() && i2cBus < I2C_BUS_SCHEDULER_MAX_BUS; ++i2cBus) {
+    if (!Settings.isI2CEnabled(i2cBus)) {
+      continue;
+    }
+    const I2C_bus_stats_t& stats = I2C_getBusStats(i2cBus);
+
+    addRowLabel(strformat(F("I2C Bus %u"), i2cBus));
+    addHtml(strformat(
+              F("Utilisation: %.1f %%<BR>Transactions: %u<BR>Latency avg/max: %u / %u usec"),
+              stats.getUtilisation() / 10.0f,
+              stats.transactions,
+              stats.getAvgLatency(),
+              stats.maxLatency_usec));
+    addHtml(strformat(
+              F("<BR>Clock changes: %u (skipped: %u)<BR>Mux writes: %u (skipped: %u)"),
+              stats.clockChanges,
+              stats.clockChangesSkipped,
+              stats.muxWrites,
+              stats.muxWritesSkipped));
+  }
+}
+
+#  endif // if !defined(WEBSERVER_SYSINFO_MINIMAL) && FEATURE_I2C_BUS_SCHEDULER
+
 #  ifndef WEBSERVER_SYSINFO_MINIMAL
 
 void handle_sysinfo_NetworkServices() {
@@ -662,6 +742,33 @@ void handle_sysinfo_Storage() {
   addRowLabel(F("Number of blocks"));
   addHtmlInt(SpiffsTotalBytes() / SpiffsBlocksize());
 
+#    if FEATURE_SETTINGS_DELTA_SAVE
+  {
+    const SettingsSaveStats& stats = getSettingsSaveStats();
+
+    addRowLabel(F("Settings Saves"));
+    addHtml(strformat(F("%u (%u skipped, not changed)"), stats.saves, stats.savesSkipped));
+
+    addRowLabel(F("Settings Bytes Written"));
+    addHtml(strformat(F("%u of %u"), stats.bytesWritten, stats.bytesRequested));
+
+    if (stats.bytesRequested != 0) {
+      addHtml(F(" ("));
+      addHtmlFloat(100.0f * stats.bytesWritten / stats.bytesRequested, 1);
+      addHtml(F("%)"));
+    }
+
+    if (stats.saves != 0) {
+      addRowLabel(F("Settings Save Duration"));
+      addHtml(F("avg: "));
+      addHtmlFloat(stats.duration_usec / (1000.0f * stats.saves), 1);
+      addHtml(F(" max: "));
+      addHtmlFloat(stats.maxDuration_usec / 1000.0f, 1);
+      addUnit(F("ms"));
+    }
+  }
+#    endif // if FEATURE_SETTINGS_DELTA_SAVE
+
   {
   #    if defined(ESP8266)
     fs::FSInfo fs_info;
@@ -36,6 +36,10 @@ void handle_sysinfo_Firmware();
 #ifndef WEBSERVER_SYSINFO_MINIMAL
 void handle_sysinfo_SystemStatus();
 
+#if FEATURE_I2C_BUS_SCHEDULER
+void handle_sysinfo_I2C();
+#endif
+
 void handle_sysinfo_NetworkServices();
 
 void handle_sysinfo_ESP_Board();
@@ -14,6 +14,7 @@
 
 #include "../Globals/Device.h"
 
+#include "../Helpers/Misc.h"
 #include "../Helpers/_Plugin_init.h"
 
 
@@ -37,6 +38,11 @@ void handle_timingstats() {
       F("duty (%)"),
       F("min (ms)"),
       F("Avg (ms)"),
+#if FEATURE_TIMING_STATS_HISTOGRAM
+      F("P50 (ms)"),
+      F("P95 (ms)"),
+      F("P99 (ms)"),
+#endif // if FEATURE_TIMING_STATS_HISTOGRAM
       F("max (ms)")};
     for (unsigned int i = 0; i < NR_ELEMENTS(headers); ++i) {
       html_table_header(headers[i]);
@@ -44,6 +50,10 @@ void handle_timingstats() {
   }
 
 
+  // Read before the stats are cleared
+  const uint32_t formattedBytes     = formatUserVar_bytes;
+  const uint32_t formattedCacheHits = formatUserVar_cacheHits;
+
   const int32_t timeSinceLastReset = stream_timing_statistics(true);
   html_end_table();
 
@@ -57,6 +67,14 @@ void handle_timingstats() {
   addRowLabel(F("Time span"));
   addHtmlFloat(timespan);
   addHtml(F(" sec"));
+  addRowLabel(F("Formatted task values"));
+
+  if (timespan > 0.0f) {
+    addHtmlFloat(formattedBytes / timespan, 1);
+  }
+  addHtml(F(" [B/s] "));
+  addHtmlInt(formattedCacheHits);
+  addHtml(F(" reused"));
   addRowLabel(F("*"));
   addHtml(F("Duty cycle based on average < 1 msec is highly unreliable"));
   html_end_table();
@@ -109,6 +127,14 @@ void stream_html_timing_stats(const TimingStats& stats, int32_t timeSinceLastRes
   html_TD();
   format_using_threshhold(avg);
   html_TD();
+#if FEATURE_TIMING_STATS_HISTOGRAM
+  format_using_threshhold(stats.getPercentile(50));
+  html_TD();
+  format_using_threshhold(stats.getPercentile(95));
+  html_TD();
+  format_using_threshhold(stats.getPercentile(99));
+  html_TD();
+#endif // if FEATURE_TIMING_STATS_HISTOGRAM
   format_using_threshhold(maxVal);
 }
 
@@ -138,6 +164,40 @@ int32_t stream_timing_statistics(bool clearStats) {
     }
   }
 
+  for (taskIndex_t x = 0; x < TASKS_MAX; ++x) {
+    if (!taskStats[x].isEmpty()) {
+      if (taskStats[x].thresholdExceeded(TIMING_STATS_THRESHOLD)) {
+        html_TR_TD_highlight();
+      } else {
+        html_TR_TD();
+      }
+      addHtml(F("Task "));
+      addHtmlInt(x + 1);
+      addHtml(' ');
+      addHtml(getTaskDeviceName(x));
+      html_TD();
+      addHtml(F("All"));
+      stream_html_timing_stats(taskStats[x], timeSinceLastReset);
+    }
+  }
+
+  for (taskIndex_t x = 0; x < TASKS_MAX; ++x) {
+    if (!taskFormulaStats[x].isEmpty()) {
+      if (taskFormulaStats[x].thresholdExceeded(TIMING_STATS_THRESHOLD)) {
+        html_TR_TD_highlight();
+      } else {
+        html_TR_TD();
+      }
+      addHtml(F("Task "));
+      addHtmlInt(x + 1);
+      addHtml(' ');
+      addHtml(getTaskDeviceName(x));
+      html_TD();
+      addHtml(F("Formula"));
+      stream_html_timing_stats(taskFormulaStats[x], timeSinceLastReset);
+    }
+  }
+
   for (auto& x: controllerStats) {
     if (!x.second.isEmpty()) {
       const int ProtocolIndex = x.first >> 8;
@@ -172,10 +232,7 @@ int32_t stream_timing_statistics(bool clearStats) {
   }
 
   if (clearStats) {
-    pluginStats.clear();
-    controllerStats.clear();
-    miscStats.clear();
-    timingstats_last_reset = millis();
+    resetTimingStats();
   }
   return timeSinceLastReset;
 }
@@ -0,0 +1,178 @@
+// Check of ADC_reduce_t (src/src/Helpers/ADC_reduce.cpp), used by P002 for continuous sampling.
+//
+// Checked against a reference computed in double per sample:
+// - Mean, AC RMS, RMS, min and max of a sine wave with DC offset and noise.
+// - A small AC component on a large DC value, and a constant signal (AC RMS must be 0).
+// - Blocks of more than 65536 samples of the max. value, which must not overflow the block sum.
+// - Merging reduced blocks gives the same result as adding all samples at once.
+// Shown is the time per sample of add().
+
+#include "src/Helpers/ADC_reduce.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+int failures = 0;
+
+void check(bool ok, const char *scenario, const char *what) {
+  if (!ok) {
+    ++failures;
+    printf("  %s: %s FAILED\n", scenario, what);
+  }
+}
+
+void result(const char *scenario, int failuresBefore) {
+  printf("%-40s %s\n", scenario, failures == failuresBefore ? "OK" : "FAILED");
+}
+
+struct Reference {
+  explicit Reference(const std::vector<uint16_t>& samples) {
+    for (uint16_t s : samples) { mean += s; }
+    mean /= samples.size();
+
+    for (uint16_t s : samples) {
+      rmsAC += (s - mean) * (s - mean);
+      rms   += static_cast<double>(s) * s;
+    }
+    rmsAC = sqrt(rmsAC / samples.size());
+    rms   = sqrt(rms / samples.size());
+  }
+
+  double mean  = 0.0;
+  double rmsAC = 0.0;
+  double rms   = 0.0;
+};
+
+// Relative to the value, or absolute for values near 0
+bool near(double value, double expected, double tolerance) {
+  return fabs(value - expected) <= tolerance * std::max(1.0, fabs(expected));
+}
+
+void compare(const std::vector<uint16_t>& samples, const ADC_reduce_t& reduced, const char *scenario) {
+  const Reference ref(samples);
+
+  check(reduced.count == samples.size(), scenario, "count");
+  check(near(reduced.getMean(), ref.mean, 1e-6), scenario, "mean");
+  check(near(reduced.getRMS_AC(), ref.rmsAC, 1e-5), scenario, "AC RMS");
+  check(near(reduced.getRMS(), ref.rms, 1e-6), scenario, "RMS");
+  check(reduced.minValue == *std::min_element(samples.begin(), samples.end()), scenario, "min");
+  check(reduced.maxValue == *std::max_element(samples.begin(), samples.end()), scenario, "max");
+}
+
+// 50 Hz sine sampled at 20 kHz, 12 bit ADC
+std::vector<uint16_t> sine(size_t count, double dc, double amplitude, double noise, int seed) {
+  std::mt19937 rnd(seed);
+  std::normal_distribution<double> gauss(0.0, noise);
+  std::vector<uint16_t> res(count);
+
+  for (size_t i = 0; i < count; ++i) {
+    const double value = dc + amplitude * sin(2 * M_PI * 50.0 * i / 20000.0) + (noise > 0 ? gauss(rnd) : 0.0);
+    res[i] = static_cast<uint16_t>(std::min(4095.0, std::max(0.0, round(value))));
+  }
+  return res;
+}
+
+void sine_wave() {
+  const char *scenario = "Sine with DC offset and noise";
+  const int   before   = failures;
+  const auto  samples  = sine(2000, 1850.0, 600.0, 5.0, 1);
+  ADC_reduce_t reduced;
+
+  reduced.add(samples.data(), samples.size());
+  compare(samples, reduced, scenario);
+  check(near(reduced.getRMS_AC(), 600.0 / sqrt(2.0), 0.01), scenario, "AC RMS of sine");
+  result(scenario, before);
+}
+
+void small_ac() {
+  const char *scenario = "Small AC on large DC, constant";
+  const int   before   = failures;
+  const auto  samples  = sine(20000, 4000.0, 2.0, 0.0, 2);
+  ADC_reduce_t reduced;
+
+  reduced.add(samples.data(), samples.size());
+  compare(samples, reduced, scenario);
+
+  const std::vector<uint16_t> constant(20000, 4000);
+  ADC_reduce_t flat;
+
+  flat.add(constant.data(), constant.size());
+  check(flat.getRMS_AC() == 0.0f, scenario, "constant AC RMS is 0");
+  check(flat.getMean() == 4000.0f, scenario, "constant mean");
+
+  ADC_reduce_t empty;
+
+  empty.add(nullptr, 10);
+  check(empty.count == 0 && empty.getMean() == 0.0f && empty.getRMS_AC() == 0.0f, scenario, "empty");
+  result(scenario, before);
+}
+
+void large_blocks() {
+  const char *scenario = "Blocks > 65536 samples of 65535";
+  const int   before   = failures;
+  std::vector<uint16_t> samples(200000, 65535);
+
+  samples[123456] = 0;
+  ADC_reduce_t reduced;
+
+  reduced.add(samples.data(), samples.size());
+  compare(samples, reduced, scenario);
+  check(reduced.sum == 65535ull * (samples.size() - 1), scenario, "sum");
+  result(scenario, before);
+}
+
+void merge() {
+  const char *scenario = "Merge of blocks";
+  const int   before   = failures;
+  const auto  samples  = sine(20000, 1000.0, 300.0, 20.0, 3);
+  ADC_reduce_t all;
+  ADC_reduce_t merged;
+
+  all.add(samples.data(), samples.size());
+
+  // Blocks like the DMA frames drained per poll
+  for (size_t pos = 0; pos < samples.size(); pos += 1000) {
+    ADC_reduce_t block;
+    block.add(&samples[pos], std::min<size_t>(1000, samples.size() - pos));
+    merged.merge(block);
+  }
+  merged.merge(ADC_reduce_t());
+  check(merged.count == all.count && merged.sum == all.sum && merged.sumSq == all.sumSq &&
+        merged.minValue == all.minValue && merged.maxValue == all.maxValue, scenario, "same as add");
+  compare(samples, merged, scenario);
+
+  merged.clear();
+  check(merged.count == 0 && merged.minValue == UINT16_MAX && merged.maxValue == 0, scenario, "clear");
+  result(scenario, before);
+}
+
+void benchmark() {
+  const auto   samples = sine(2000, 1850.0, 600.0, 5.0, 4);
+  ADC_reduce_t reduced;
+  const int    rounds = 5000;
+  const auto   start  = std::chrono::steady_clock::now();
+
+  for (int r = 0; r < rounds; ++r) {
+    reduced.add(samples.data(), samples.size());
+  }
+  const auto end = std::chrono::steady_clock::now();
+
+  printf("add(): %.2f ns per sample (mean %.1f)\n",
+         std::chrono::duration<double, std::nano>(end - start).count() / (rounds * samples.size()),
+         reduced.getMean());
+}
+} // namespace
+
+int main() {
+  sine_wave();
+  small_ac();
+  large_blocks();
+  merge();
+  benchmark();
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,111 @@
+// Simulation of ClockDiscipline, as used by ESPEasy_time.
+//
+// The local clock runs with a constant frequency error (drift).
+// now_() is called every second and applies getCorrection().
+// At each time sync the measured offset (with noise) is passed to processOffset(),
+// and applied as a step when requested.
+//
+// Checked per scenario, over the second half of the simulated period:
+// - The estimated drift is close to the actual drift.
+// - The max. error of the system time stays within the limit.
+// - The system time never runs backwards.
+
+#include "DataStructs/ClockDiscipline.h"
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+struct Scenario {
+  const char *name;
+  double      drift_ppm;       // Actual frequency error, > 0: local clock runs slow
+  double      noise_usec;      // Std. deviation of the measured offset
+  int64_t     initialError_usec;
+  int         syncInterval_sec;
+  int         hours;
+  double      maxDriftError_ppm;
+  double      maxError_usec;
+};
+
+static bool run(const Scenario& sc)
+{
+  ClockDiscipline cd;
+  std::mt19937    gen(1);
+  std::normal_distribution<double> noise(0.0, sc.noise_usec);
+
+  uint64_t sysMicros   = 1;
+  int64_t  sysOffset   = 0;                           // System time = sysMicros + sysOffset
+  double   trueTime    = sc.initialError_usec;        // Reference time in usec
+  double   maxError    = 0.0;
+  int64_t  prevSysTime = 0;
+  bool     backwards   = false;
+  int      steps       = 0;
+  const int totalSec   = sc.hours * 3600;
+
+  cd.timeStepped(sysMicros, true);
+
+  for (int sec = 1; sec <= totalSec; ++sec) {
+    sysMicros += 1000000;
+    trueTime  += 1000000.0 * (1.0 + sc.drift_ppm * 1e-6);
+    sysOffset += cd.getCorrection(sysMicros);
+
+    const int64_t sysTime = static_cast<int64_t>(sysMicros) + sysOffset;
+
+    if (sysTime <= prevSysTime) { backwards = true; }
+    prevSysTime = sysTime;
+
+    if ((sec % sc.syncInterval_sec) == 0) {
+      const int64_t measured = static_cast<int64_t>(trueTime - sysTime + noise(gen));
+
+      if (cd.processOffset(measured, sysMicros, true)) {
+        sysOffset += measured;
+        cd.timeStepped(sysMicros, true);
+        prevSysTime = static_cast<int64_t>(sysMicros) + sysOffset;
+        ++steps;
+      }
+    }
+
+    if (sec > (totalSec / 2)) {
+      const double error = std::fabs(trueTime - static_cast<double>(sysMicros + sysOffset));
+
+      if (error > maxError) { maxError = error; }
+    }
+  }
+
+  const double driftError = std::fabs(cd.getDrift_ppm() - sc.drift_ppm);
+  const bool   ok         = !backwards &&
+                            (driftError <= sc.maxDriftError_ppm) &&
+                            (maxError <= sc.maxError_usec);
+
+  printf("%-28s drift: %7.2f ppm (est. %7.2f)  max. error: %7.2f ms  steps: %d%s  %s\n",
+         sc.name,
+         sc.drift_ppm,
+         cd.getDrift_ppm(),
+         maxError / 1000.0,
+         steps,
+         backwards ? "  RUNS BACKWARDS" : "",
+         ok ? "OK" : "FAIL");
+  return ok;
+}
+
+int main()
+{
+  const Scenario scenarios[] = {
+    // name                       drift  noise  init.err  sync    hours  max drift err  max err
+    { "42 ppm, hourly NTP",          42.0, 2000,        0, 3600,   48,    2.0,           10000 },
+    { "-42 ppm, hourly NTP",        -42.0, 2000,        0, 3600,   48,    2.0,           10000 },
+    { "0 ppm, hourly NTP",            0.0, 2000,        0, 3600,   48,    2.0,           10000 },
+    { "150 ppm, hourly NTP",        150.0, 2000,        0, 3600,   48,    2.0,           10000 },
+    { "42 ppm, 500 ms initial",      42.0, 2000,   500000, 3600,   48,    2.0,           10000 },
+    { "42 ppm, 100 ms initial",      42.0, 2000,   100000, 3600,   48,    2.0,           10000 },
+    { "42 ppm, 6 hour sync",         42.0, 2000,        0, 21600, 240,    2.0,           20000 },
+    { "42 ppm, 10 ms noise",         42.0, 10000,       0, 3600,   96,    5.0,           50000 },
+  };
+
+  bool ok = true;
+
+  for (const Scenario& sc : scenarios) {
+    if (!run(sc)) { ok = false; }
+  }
+  return ok ? 0 : 1;
+}
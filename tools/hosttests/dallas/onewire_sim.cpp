@@ -0,0 +1,615 @@
+// Simulation of a 1-Wire bus with DS18B20 sensors, to check the shared bus conversions of P004.
+//
+// The GPIO pin of Dallas1WireHelper.cpp is connected to a bit level model of the bus:
+// the master pulls the bus low (output low) or releases it, the sensors pull it low
+// for a presence pulse or to send a 0 bit. Time is simulated, each call to micros() takes 1 usec.
+// The sensors decode reset, ROM and function commands from the length of the low pulses,
+// like the real devices do.
+//
+// Tasks are run like the PLUGIN_READ of P004: initiate_read(), wait for the timer, collect_values().
+// Checked per scenario:
+// - The values read match the temperature at the moment of the conversion.
+// - The number of Convert T commands on the bus.
+// - Shared conversions are not used after a sensor failed (power-on reset, CRC error, removed),
+//   nor after the task which started it was deleted.
+
+#include "PluginStructs/P004_data_struct.h"
+
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+namespace {
+constexpr uint32_t BUS_PIN = 4;
+
+uint8_t crc8(const uint8_t *data, size_t len)
+{
+  uint8_t crc = 0;
+
+  for (size_t i = 0; i < len; ++i) {
+    uint8_t inbyte = data[i];
+
+    for (int b = 0; b < 8; ++b) {
+      const uint8_t mix = (crc ^ inbyte) & 0x01;
+      crc >>= 1;
+
+      if (mix) { crc ^= 0x8C; }
+      inbyte >>= 1;
+    }
+  }
+  return crc;
+}
+
+struct SimBus;
+
+class SimSensor {
+public:
+
+  explicit SimSensor(uint8_t serial) {
+    rom[0] = 0x28;
+
+    for (int i = 1; i < 7; ++i) { rom[i] = serial * (i + 1); }
+    rom[7] = crc8(rom, 7);
+    powerOnReset();
+  }
+
+  void powerOnReset() {
+    // 85 degree C and the configuration from EEPROM
+    const uint8_t init[8] = { 0x50, 0x05, ee_th, ee_tl, ee_config, 0xFF, 0x0C, 0x10 };
+
+    memcpy(scratchpad, init, 8);
+    scratchpad[8] = crc8(scratchpad, 8);
+    converting    = false;
+    state         = State::Idle;
+  }
+
+  // Finish a conversion when its time has passed
+  void update(uint64_t now) {
+    if (converting && (now >= conversionDone)) {
+      const int res = 9 + ((scratchpad[4] >> 5) & 3);
+      int16_t   raw = static_cast<int16_t>(std::lround(temperature * 16.0f));
+
+      raw          &= ~((1 << (12 - res)) - 1);
+      scratchpad[0] = raw & 0xFF;
+      scratchpad[1] = (raw >> 8) & 0xFF;
+      scratchpad[8] = crc8(scratchpad, 8);
+      converting    = false;
+    }
+  }
+
+  bool pullsLow(uint64_t now) const {
+    return present && (now >= pullStart) && (now < pullEnd);
+  }
+
+  // Master pulls the bus low: start of a time slot
+  void slotStart(uint64_t now) {
+    update(now);
+    readSlot = transmitting();
+
+    if (readSlot && !nextTxBit()) {
+      // Send 0: keep the bus low for 30 usec
+      pullStart = now;
+      pullEnd   = now + 30;
+    }
+  }
+
+  // Master releases the bus after a low pulse of given duration
+  void slotEnd(SimBus& bus, uint64_t now, uint64_t low_usec);
+
+  uint8_t  rom[8]{};
+  float    temperature = 20.0f;
+  bool     present     = true;
+  int      corruptReads{}; // Nr of next scratchpad reads to corrupt
+  uint32_t conversions{};
+
+private:
+
+  enum class State {
+    Idle,
+    RomCmd,
+    MatchRom,
+    SearchRom,
+    FuncCmd,
+    WriteScratchpad,
+    Transmit
+  };
+
+  bool transmitting() const {
+    return (state == State::Transmit) || ((state == State::SearchRom) && (searchPhase < 2));
+  }
+
+  bool romBit(int bit) const {
+    return (rom[bit / 8] >> (bit % 8)) & 1;
+  }
+
+  bool nextTxBit() {
+    if (state == State::SearchRom) {
+      const bool bit = romBit(searchBit);
+      return (searchPhase++ == 0) ? bit : !bit;
+    }
+
+    if (txPos < (tx.size() * 8)) {
+      const bool bit = (tx[txPos / 8] >> (txPos % 8)) & 1;
+      ++txPos;
+      return bit;
+    }
+    return true;
+  }
+
+  void transmit(const uint8_t *data, size_t len) {
+    tx.assign(data, data + len);
+    txPos = 0;
+    state = State::Transmit;
+  }
+
+  void receiveBit(SimBus& bus, bool bit, uint64_t now);
+
+  uint8_t  ee_th     = 0x4B;
+  uint8_t  ee_tl     = 0x46;
+  uint8_t  ee_config = 0x7F;
+  uint8_t  scratchpad[9]{};
+  bool     converting{};
+  uint64_t conversionDone{};
+
+  State                state = State::Idle;
+  uint64_t             rxValue{};
+  int                  rxBits{};
+  std::vector<uint8_t> tx;
+  size_t               txPos{};
+  int                  searchBit{};
+  int                  searchPhase{};
+  bool                 readSlot{};
+  uint64_t             pullStart{};
+  uint64_t             pullEnd{};
+};
+
+struct SimBus {
+  void pinChanged() {
+    const bool     low = output && !level;
+    const uint64_t now = HostClock::now_usec;
+
+    if (low && !masterLow) {
+      lowStart = now;
+
+      for (SimSensor *s : sensors) {
+        if (s->present) { s->slotStart(now); }
+      }
+    } else if (!low && masterLow) {
+      const uint64_t duration = now - lowStart;
+
+      if (duration >= 480) { ++resets; }
+
+      for (SimSensor *s : sensors) {
+        if (s->present) { s->slotEnd(*this, now, duration); }
+      }
+    }
+    masterLow = low;
+  }
+
+  bool read() const {
+    const uint64_t now = HostClock::now_usec;
+
+    if (masterLow) { return false; }
+
+    for (const SimSensor *s : sensors) {
+      if (s->pullsLow(now)) { return false; }
+    }
+    return true;
+  }
+
+  std::vector<SimSensor *> sensors;
+  bool     output{};
+  bool     level = true;
+  bool     masterLow{};
+  uint64_t lowStart{};
+
+  // Statistics
+  uint32_t resets{};
+  uint32_t convertCommands{};   // Convert T commands, counted once per bus reset
+  uint32_t lastConvertReset{};
+  uint32_t scratchpadReads{};
+};
+
+SimBus bus;
+
+void SimSensor::slotEnd(SimBus& simBus, uint64_t now, uint64_t low_usec)
+{
+  if (low_usec >= 480) {
+    // Reset pulse, answer with a presence pulse
+    state     = State::RomCmd;
+    rxValue   = 0;
+    rxBits    = 0;
+    pullStart = now + 30;
+    pullEnd   = now + 150;
+    return;
+  }
+
+  if (!readSlot && (state != State::Idle) && !transmitting()) {
+    // Write slot: a short low pulse is a 1, a long one a 0
+    receiveBit(simBus, low_usec < 15, now);
+  }
+}
+
+void SimSensor::receiveBit(SimBus& simBus, bool bit, uint64_t now)
+{
+  if (state == State::SearchRom) {
+    // Direction chosen by the master, drop out when it does not match our ROM
+    if (bit != romBit(searchBit)) {
+      state = State::Idle;
+    } else if (++searchBit == 64) {
+      state = State::Idle;
+    }
+    searchPhase = 0;
+    return;
+  }
+
+  if (bit) { rxValue |= (1ull << rxBits); }
+  ++rxBits;
+
+  switch (state) {
+    case State::RomCmd:
+
+      if (rxBits == 8) {
+        const uint8_t cmd = rxValue;
+        rxValue = 0;
+        rxBits  = 0;
+
+        switch (cmd) {
+          case 0xCC: state = State::FuncCmd; break;   // Skip ROM
+          case 0x55: state = State::MatchRom; break;  // Match ROM
+          case 0xF0:                                  // Search ROM
+            state       = State::SearchRom;
+            searchBit   = 0;
+            searchPhase = 0;
+            break;
+          case 0x33: transmit(rom, 8); break; // Read ROM
+          default: state = State::Idle; break;
+        }
+      }
+      break;
+    case State::MatchRom:
+
+      if (rxBits == 64) {
+        uint64_t own{};
+        memcpy(&own, rom, 8);
+        state   = (own == rxValue) ? State::FuncCmd : State::Idle;
+        rxValue = 0;
+        rxBits  = 0;
+      }
+      break;
+    case State::FuncCmd:
+
+      if (rxBits == 8) {
+        const uint8_t cmd = rxValue;
+        rxValue = 0;
+        rxBits  = 0;
+        state   = State::Idle;
+
+        switch (cmd) {
+          case 0x44: // Convert T
+          {
+            const int res = 9 + ((scratchpad[4] >> 5) & 3);
+            converting     = true;
+            conversionDone = now + (750000ull >> (12 - res));
+            ++conversions;
+
+            if (simBus.lastConvertReset != simBus.resets) {
+              simBus.lastConvertReset = simBus.resets;
+              ++simBus.convertCommands;
+            }
+            break;
+          }
+          case 0xBE: // Read scratchpad
+          {
+            uint8_t data[9];
+            memcpy(data, scratchpad, 9);
+
+            if (corruptReads > 0) {
+              --corruptReads;
+              data[0] ^= 0x04;
+            }
+            ++simBus.scratchpadReads;
+            transmit(data, 9);
+            break;
+          }
+          case 0x4E: state = State::WriteScratchpad; break;
+          case 0x48: // Copy scratchpad to EEPROM
+            ee_th     = scratchpad[2];
+            ee_tl     = scratchpad[3];
+            ee_config = scratchpad[4];
+            break;
+          case 0xB4: // Read power supply, externally powered
+            transmit(nullptr, 0);
+            break;
+        }
+      }
+      break;
+    case State::WriteScratchpad:
+
+      if (rxBits == 24) {
+        scratchpad[2] = rxValue & 0xFF;
+        scratchpad[3] = (rxValue >> 8) & 0xFF;
+        scratchpad[4] = ((rxValue >> 16) & 0x60) | 0x1F;
+        scratchpad[8] = crc8(scratchpad, 8);
+        state         = State::Idle;
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+// A task like P004 with its PLUGIN_READ
+struct SimTask {
+  SimTask(taskIndex_t taskIndex, std::vector<SimSensor *> taskSensors, bool shared, unsigned long offset_ms)
+    : sensors(taskSensors), nextRun(offset_ms)
+  {
+    data.reset(new P004_data_struct(taskIndex, BUS_PIN, BUS_PIN, 12, false, shared));
+
+    for (size_t i = 0; i < sensors.size(); ++i) {
+      data->add_addr(sensors[i]->rom, i);
+    }
+    data->init();
+  }
+
+  // @retval true when values were collected
+  bool run() {
+    if (!timeOutReached(data->get_timer())) {
+      nextRun = data->get_timer();
+      return false;
+    }
+
+    if (!data->measurement_active()) {
+      if (data->initiate_read()) {
+        nextRun = data->get_timer();
+        return false;
+      }
+    } else {
+      data->collect_values();
+
+      for (size_t i = 0; i < sensors.size(); ++i) {
+        float value{};
+        values[i] = data->read_temp(value, i) ? value : NAN;
+      }
+      data->set_measurement_inactive();
+    }
+
+    // Like Scheduler.reschedule_task_device_timer(), stay in sync with the interval
+    nextRun = data->get_measurement_start() + interval_ms;
+    return true;
+  }
+
+  std::vector<SimSensor *>          sensors;
+  std::unique_ptr<P004_data_struct> data;
+  unsigned long                     nextRun;
+  unsigned long                     interval_ms = 10000;
+  float                             values[VARS_PER_TASK]{};
+};
+
+void runUntil(std::vector<SimTask *>& tasks, unsigned long end_ms)
+{
+  while (true) {
+    SimTask *next = nullptr;
+
+    for (SimTask *t : tasks) {
+      if ((next == nullptr) || (timeDiff(t->nextRun, next->nextRun) > 0)) { next = t; }
+    }
+
+    if ((next == nullptr) || (timeDiff(end_ms, next->nextRun) >= 0)) { break; }
+
+    if (timeDiff(millis(), next->nextRun) > 0) {
+      HostClock::now_usec = next->nextRun * 1000ull;
+    }
+    next->run();
+  }
+}
+
+bool checkValue(const char *name, float value, float expected)
+{
+  if (std::isnan(value) || (std::fabs(value - expected) > 0.0625f)) {
+    printf("  %s: read %.4f, expected %.4f\n", name, value, expected);
+    return false;
+  }
+  return true;
+}
+
+bool report(const char *name, bool ok)
+{
+  printf("%-44s resets: %5u  convert: %3u  scratchpad reads: %4u  %s\n",
+         name, bus.resets, bus.convertCommands, bus.scratchpadReads, ok ? "OK" : "FAIL");
+  return ok;
+}
+
+void resetBus(std::vector<SimSensor *> sensors)
+{
+  bus         = SimBus();
+  bus.sensors = sensors;
+}
+
+// Two tasks on one bus, read at the same interval
+bool scenarioSharedRounds(bool shared, const char *name, uint32_t expectedConvertPerRound)
+{
+  SimSensor a(1), b(2), c(3);
+
+  resetBus({ &a, &b, &c });
+  const unsigned long start = millis() + 1000;
+  SimTask t1(0, { &a, &b }, shared, start);
+  SimTask t2(1, { &c }, shared, start + 100);
+  std::vector<SimTask *> tasks{ &t1, &t2 };
+
+  bool ok = true;
+  const uint32_t convertBefore = bus.convertCommands;
+
+  for (int round = 0; round < 20; ++round) {
+    a.temperature = 20.0f + round * 0.5f;
+    b.temperature = -10.25f - round;
+    c.temperature = 50.0f + round * 0.0625f;
+    runUntil(tasks, start + (round + 1) * 10000);
+    ok &= checkValue("a", t1.values[0], a.temperature);
+    ok &= checkValue("b", t1.values[1], b.temperature);
+    ok &= checkValue("c", t2.values[0], c.temperature);
+  }
+
+  if ((bus.convertCommands - convertBefore) != (20 * expectedConvertPerRound)) {
+    printf("  Convert T commands: %u, expected %u\n", bus.convertCommands - convertBefore, 20 * expectedConvertPerRound);
+    ok = false;
+  }
+
+  if (shared) {
+    const Dallas_BusStats *stats = Dallas_get_bus_stats(BUS_PIN);
+    ok &= (stats != nullptr) && (stats->conversions_shared >= 20) && (stats->crc_errors == 0);
+  }
+  return report(name, ok);
+}
+
+// CRC errors are retried, counted in the bus statistics and the next task does not share the conversion
+bool scenarioCRCErrors()
+{
+  SimSensor a(1), b(2);
+
+  resetBus({ &a, &b });
+  const unsigned long start = millis() + 1000;
+  SimTask t1(2, { &a }, true, start);
+  SimTask t2(3, { &b }, true, start + 100);
+  std::vector<SimTask *> tasks{ &t1, &t2 };
+
+  const Dallas_BusStats *stats = Dallas_get_bus_stats(BUS_PIN);
+  const uint32_t crcBefore     = stats ? stats->crc_errors : 0;
+  bool ok                      = true;
+
+  for (int round = 0; round < 10; ++round) {
+    a.temperature = 21.0f + round;
+    b.temperature = 22.0f + round;
+
+    // One corrupted read is recovered by the retry in collect_value()
+    a.corruptReads = (round % 2) ? 1 : 0;
+    runUntil(tasks, start + (round + 1) * 10000);
+    ok &= checkValue("a", t1.values[0], a.temperature);
+    ok &= checkValue("b", t2.values[0], b.temperature);
+  }
+  stats = Dallas_get_bus_stats(BUS_PIN);
+  ok   &= (stats != nullptr) && ((stats->crc_errors - crcBefore) == 5);
+  return report("CRC errors, retried", ok);
+}
+
+// A sensor which lost its conversion (power-on reset) must not let later tasks share it
+bool scenarioPowerOnReset()
+{
+  SimSensor a(1), b(2);
+
+  resetBus({ &a, &b });
+  const unsigned long start = millis() + 1000;
+
+  // t2 starts its read after t1 collected, but still within the share window
+  SimTask t1(4, { &a }, true, start);
+  SimTask t2(5, { &b }, true, start + 900);
+  std::vector<SimTask *> tasks{ &t1, &t2 };
+
+  runUntil(tasks, start + 10000);
+  const uint32_t sharedConversion = bus.convertCommands;
+
+  // Reset of sensor a while the conversion of the next round is running
+  a.temperature = 30.0f;
+  b.temperature = 31.0f;
+  runUntil(tasks, start + 10000 + 200);
+  a.powerOnReset();
+  runUntil(tasks, start + 20000);
+
+  bool ok = std::isnan(t1.values[0]) && checkValue("b", t2.values[0], b.temperature);
+
+  // t1 invalidated the conversion, so t2 must have started its own.
+  ok &= (bus.convertCommands - sharedConversion) == 2;
+
+  // Sensor a is re-checked and read again in the next round
+  a.temperature = 32.0f;
+  runUntil(tasks, start + 30000);
+  ok &= checkValue("a", t1.values[0], a.temperature);
+  return report("Power-on reset invalidates conversion", ok);
+}
+
+// A removed sensor does not block the other sensors of the task
+bool scenarioSensorRemoved()
+{
+  SimSensor a(1), b(2);
+
+  resetBus({ &a, &b });
+  const unsigned long start = millis() + 1000;
+  SimTask t1(6, { &a, &b }, true, start);
+  std::vector<SimTask *> tasks{ &t1 };
+
+  b.present = false;
+  bool ok = true;
+
+  for (int round = 0; round < 5; ++round) {
+    a.temperature = 15.0f + round;
+    runUntil(tasks, start + (round + 1) * 10000);
+    ok &= checkValue("a", t1.values[0], a.temperature) && std::isnan(t1.values[1]);
+  }
+  b.present = true;
+  b.powerOnReset();
+  b.temperature = 16.5f;
+  runUntil(tasks, start + 70000);
+  ok &= checkValue("b", t1.values[1], b.temperature);
+  return report("Sensor removed and reconnected", ok);
+}
+
+// Deleting a task invalidates its conversion, e.g. when the resolution was changed
+bool scenarioTaskDeleted()
+{
+  SimSensor a(1);
+
+  resetBus({ &a });
+  const unsigned long start = millis() + 1000;
+  std::unique_ptr<SimTask> t1(new SimTask(7, { &a }, true, start));
+  std::vector<SimTask *> tasks{ t1.get() };
+
+  runUntil(tasks, start + 10);
+  const uint32_t convertBefore = bus.convertCommands;
+
+  t1.reset();
+  a.temperature = 40.0f;
+  SimTask t2(7, { &a }, true, millis() + 10);
+  tasks = { &t2 };
+  runUntil(tasks, millis() + 5000);
+
+  const bool ok = (bus.convertCommands - convertBefore == 1) && checkValue("a", t2.values[0], a.temperature);
+  return report("Task deleted invalidates conversion", ok);
+}
+} // namespace
+
+void OneWireSim_pinMode(uint32_t pin, bool output)
+{
+  if (pin != BUS_PIN) { return; }
+  bus.output = output;
+  bus.pinChanged();
+}
+
+void OneWireSim_pinWrite(uint32_t pin, bool level)
+{
+  if (pin != BUS_PIN) { return; }
+  bus.level = level;
+  bus.pinChanged();
+}
+
+bool OneWireSim_pinRead(uint32_t pin)
+{
+  return (pin == BUS_PIN) ? bus.read() : true;
+}
+
+int main()
+{
+  bool ok = true;
+
+  // Tasks on the same bus share a single Skip ROM + Convert T per round
+  ok &= scenarioSharedRounds(true, "Shared conversion, 3 sensors in 2 tasks", 1);
+
+  // Without sharing, each sensor gets its own Match ROM + Convert T
+  ok &= scenarioSharedRounds(false, "Per sensor conversion, 3 sensors in 2 tasks", 3);
+  ok &= scenarioCRCErrors();
+  ok &= scenarioPowerOnReset();
+  ok &= scenarioSensorRemoved();
+  ok &= scenarioTaskDeleted();
+
+  return ok ? 0 : 1;
+}
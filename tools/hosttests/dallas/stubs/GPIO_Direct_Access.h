@@ -0,0 +1,24 @@
+#ifndef GPIO_DIRECT_ACCESS_H
+#define GPIO_DIRECT_ACCESS_H
+
+// Host build replacement for lib/GPIO_Direct_Access
+// The pins are connected to the simulated 1-Wire bus in onewire_sim.cpp
+
+#include <stdint.h>
+
+void OneWireSim_pinMode(uint32_t pin,
+                        bool     output);
+void OneWireSim_pinWrite(uint32_t pin,
+                         bool     level);
+bool OneWireSim_pinRead(uint32_t pin);
+
+#define DIRECT_PINMODE_INPUT(pin)       OneWireSim_pinMode(pin, false)
+#define DIRECT_PINMODE_INPUT_ISR(pin)   OneWireSim_pinMode(pin, false)
+#define DIRECT_PINMODE_OUTPUT(pin)      OneWireSim_pinMode(pin, true)
+#define DIRECT_PINMODE_OUTPUT_ISR(pin)  OneWireSim_pinMode(pin, true)
+#define DIRECT_pinWrite(pin, val)       OneWireSim_pinWrite(pin, val)
+#define DIRECT_pinWrite_ISR(pin, val)   OneWireSim_pinWrite(pin, val)
+#define DIRECT_pinRead(pin)             OneWireSim_pinRead(pin)
+#define DIRECT_pinRead_ISR(pin)         OneWireSim_pinRead(pin)
+
+#endif // ifndef GPIO_DIRECT_ACCESS_H
@@ -0,0 +1,94 @@
+#ifndef PLUGIN_HELPER_H
+#define PLUGIN_HELPER_H
+
+// Host build replacement for src/_Plugin_Helper.h
+// Only what Dallas1WireHelper.cpp and P004_data_struct.cpp need.
+
+#include "ESPEasy_common.h"
+
+#include "src/DataTypes/PluginID.h"
+#include "src/DataTypes/TaskIndex.h"
+#include "src/ESPEasyCore/ESPEasy_Log.h"
+#include "src/Helpers/ESPEasy_time_calc.h"
+
+#define VARS_PER_TASK 4
+
+struct PluginTaskData_base {
+  virtual ~PluginTaskData_base() = default;
+};
+
+// Web page output is not used
+template<typename ... Args>
+void addRowLabel(Args...) {}
+
+template<typename ... Args>
+void addHtml(Args...) {}
+
+template<typename ... Args>
+void addHtmlInt(Args...) {}
+
+template<typename ... Args>
+void addHtmlFloat(Args...) {}
+
+template<typename ... Args>
+void addUnit(Args...) {}
+
+template<typename ... Args>
+void addSelector_Head(Args...) {}
+
+template<typename ... Args>
+void addSelector_Item(Args...) {}
+
+template<typename ... Args>
+void addSelector_Foot(Args...) {}
+
+template<typename ... Args>
+void addFormSeparator(Args...) {}
+
+template<typename ... Args>
+void addFormSelector(Args...) {}
+
+template<typename ... Args>
+void addEnabled(Args...) {}
+
+template<typename ... Args>
+String strformat(Args...) { return String(); }
+
+template<typename ... Args>
+String concat(Args...) { return String(); }
+
+template<typename ... Args>
+int getFormItemInt(Args...) { return -1; }
+
+inline const char* jsonBool(bool value) { return value ? "true" : "false"; }
+
+String formatToHex(unsigned long value, unsigned int minimal_hex_digits = 0);
+void   appendHexChar(uint8_t data, String& string);
+
+// Task settings, no tasks are configured
+inline bool   validTaskIndex(taskIndex_t index) { return index < 32; }
+inline String getTaskDeviceName(taskIndex_t) { return String(); }
+inline uint8_t getValueCountForTask(taskIndex_t) { return 0; }
+inline void   LoadTaskSettings(taskIndex_t) {}
+
+struct SettingsStruct {
+  pluginID_t getPluginID_for_task(taskIndex_t) const { return INVALID_PLUGIN_ID; }
+};
+
+extern SettingsStruct Settings;
+
+struct ExtraTaskSettingsStruct {
+  long TaskDevicePluginConfigLong[8]{};
+};
+
+extern ExtraTaskSettingsStruct ExtraTaskSettings;
+
+struct Caches {
+  String getTaskDeviceValueName(taskIndex_t, uint8_t) const { return String(); }
+  long   getTaskDevicePluginConfigLong(taskIndex_t, uint8_t) const { return 0; }
+  void   updateExtraTaskSettingsCache() {}
+};
+
+extern Caches Cache;
+
+#endif // ifndef PLUGIN_HELPER_H
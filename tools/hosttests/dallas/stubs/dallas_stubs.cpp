@@ -0,0 +1,26 @@
+// Implementation of the stubs in _Plugin_Helper.h
+
+#include "_Plugin_Helper.h"
+
+SettingsStruct          Settings;
+ExtraTaskSettingsStruct ExtraTaskSettings;
+Caches                  Cache;
+
+const taskIndex_t INVALID_TASK_INDEX = 255;
+const pluginID_t  INVALID_PLUGIN_ID;
+
+String formatToHex(unsigned long value, unsigned int minimal_hex_digits)
+{
+  char buf[20];
+
+  snprintf(buf, sizeof(buf), "0x%0*lX", minimal_hex_digits, value);
+  return buf;
+}
+
+void appendHexChar(uint8_t data, String& string)
+{
+  char buf[3];
+
+  snprintf(buf, sizeof(buf), "%02X", data);
+  string += buf;
+}
@@ -0,0 +1,3 @@
+#pragma once
+
+// Host build replacement, not used by the code under test.
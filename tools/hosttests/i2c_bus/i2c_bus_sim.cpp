@@ -0,0 +1,529 @@
+// Simulation of I2C buses with multiplexers, to check the I2C bus scheduler.
+//
+// Hardware_I2C.cpp and I2C_BusScheduler.cpp run on a mock bus backend (Wire and I2C_access):
+// the Wire interface is switched between the buses by its pins, like on ESP8266,
+// and each bus has a TCA9548A multiplexer which keeps its output register.
+// Tasks are called like PluginCall() does, see prepareTask() and postTask().
+//
+// Checked per scenario:
+// - Each I2C task finds its bus, only its multiplexer channel(s) and its clock speed selected.
+// - Each non-I2C task and the end of each round find all buses in their default state:
+//   no multiplexer channel selected and the normal clock speed.
+// - The tasks are called in task order.
+// - The bus statistics match the mock bus.
+// Shown are the multiplexer writes and clock changes for rounds of task calls with and
+// without a batch, like the periodic calls and task reads which are due at the same moment.
+
+#include "src/Helpers/Hardware_I2C.h"
+#include "src/Helpers/I2C_BusScheduler.h"
+#include "src/Helpers/msecTimerHandlerStruct.h"
+
+#include "src/Globals/Settings.h"
+#include "src/Globals/Statistics.h"
+#include "src/Helpers/I2C_access.h"
+
+#include <Wire.h>
+
+#include <cstdarg>
+#include <cstdio>
+#include <vector>
+
+SettingsStruct Settings;
+uint8_t lastBootCause = 0;
+const taskIndex_t INVALID_TASK_INDEX = 255;
+
+TwoWire Wire;
+
+namespace {
+constexpr uint8_t MUX_ADDR      = 0x70;
+constexpr uint8_t NR_BUSES      = 2;
+constexpr uint8_t NON_I2C       = 0xFF;
+constexpr uint8_t NO_MUX        = 0xFE;
+constexpr uint32_t TASK_DURATION_USEC = 400;
+
+struct MockBus {
+  // Power on of the multiplexers, the Wire interface keeps its state like I2CBegin() does
+  void reset() {
+    MockBus res;
+
+    res.current = current;
+    res.clock   = clock;
+    *this       = res;
+  }
+
+  // Bus selected by the pins of Wire.begin(), -1 = none
+  int      current = -1;
+  uint32_t clock   = 0;
+
+  // Output register of the multiplexer of each bus
+  uint8_t  mux[NR_BUSES]{};
+
+  // Nr. of multiplexer writes to NACK
+  int      failMuxWrites = 0;
+
+  uint32_t muxWrites   = 0;
+  uint32_t clockSets   = 0;
+  uint32_t errors      = 0;
+  bool     quiet       = false; // Errors are expected
+  std::vector<taskIndex_t> callOrder;
+};
+
+MockBus bus;
+
+void error(const char *fmt, ...)
+{
+  if (!bus.quiet && (bus.errors < 5)) {
+    va_list args;
+    va_start(args, fmt);
+    printf("  ");
+    vprintf(fmt, args);
+    printf("\n");
+    va_end(args);
+  }
+  ++bus.errors;
+}
+
+} // namespace
+
+/********************************************************************************************\
+   Mock bus backend
+ \*********************************************************************************************/
+void TwoWire::begin(int sda, int scl)
+{
+  bus.current = -1;
+
+  for (uint8_t i2cBus = 0; i2cBus < NR_BUSES; ++i2cBus) {
+    if ((Settings.bus[i2cBus].sda == sda) && (Settings.bus[i2cBus].scl == scl)) {
+      bus.current = i2cBus;
+    }
+  }
+}
+
+void TwoWire::setClock(uint32_t frequency)
+{
+  bus.clock = frequency;
+  ++bus.clockSets;
+}
+
+bool I2C_write8(uint8_t i2caddr, uint8_t value)
+{
+  if ((bus.current < 0) || (i2caddr != MUX_ADDR) || (Settings.bus[bus.current].muxAddr != MUX_ADDR)) {
+    return true;
+  }
+
+  if (bus.failMuxWrites > 0) {
+    --bus.failMuxWrites;
+    return false;
+  }
+  bus.mux[bus.current] = value;
+  ++bus.muxWrites;
+  return true;
+}
+
+bool I2C_write8_reg(uint8_t i2caddr, uint8_t reg, uint8_t value) { return true; }
+
+uint8_t I2C_read8(uint8_t i2caddr, bool *is_ok)
+{
+  if (is_ok) { *is_ok = false; }
+  return 0;
+}
+
+unsigned char I2C_wakeup(uint8_t i2caddr) { return 0; }
+
+namespace {
+
+/********************************************************************************************\
+   Tasks
+ \*********************************************************************************************/
+struct SimTask {
+  uint8_t i2cBus;
+  uint8_t channel; // NON_I2C, NO_MUX or the multiplexer channel
+  bool    slow;
+};
+
+std::vector<SimTask> tasks;
+
+void setupBuses(uint8_t nrBuses)
+{
+  Settings = SettingsStruct();
+
+  for (uint8_t i2cBus = 0; i2cBus < nrBuses; ++i2cBus) {
+    Settings.bus[i2cBus].sda         = 4 + 2 * i2cBus;
+    Settings.bus[i2cBus].scl         = 5 + 2 * i2cBus;
+    Settings.bus[i2cBus].muxType     = I2C_MULTIPLEXER_TCA9548A;
+    Settings.bus[i2cBus].muxAddr     = MUX_ADDR;
+    Settings.bus[i2cBus].muxResetPin = 12 + i2cBus;
+  }
+  tasks.clear();
+  bus.reset();
+  initI2C();
+}
+
+void addTask(uint8_t i2cBus, uint8_t channel, bool slow = false)
+{
+  const taskIndex_t taskIndex = tasks.size();
+
+  tasks.push_back({ i2cBus, channel, slow });
+  Settings.I2C_interface[taskIndex]           = i2cBus;
+  Settings.I2C_Multiplexer_Channel[taskIndex] = (channel < 8) ? channel : -1;
+  Settings.I2C_SPI_bus_Flags[taskIndex]       = slow ? (1 << I2C_FLAGS_SLOW_SPEED) : 0;
+}
+
+bool isI2C(taskIndex_t taskIndex) { return tasks[taskIndex].channel != NON_I2C; }
+
+uint32_t expectedClock(uint8_t i2cBus, bool slow)
+{
+  return slow ? Settings.bus[i2cBus].clockSpeedSlow : Settings.bus[i2cBus].clockSpeed;
+}
+
+// All buses without a multiplexer channel selected and the current bus on its normal clock speed
+void checkDefaultState(const char *when)
+{
+  for (uint8_t i2cBus = 0; i2cBus < NR_BUSES; ++i2cBus) {
+    if (Settings.isI2CEnabled(i2cBus) && (bus.mux[i2cBus] != 0)) {
+      error("%s: multiplexer of bus %u not off", when, i2cBus);
+    }
+  }
+
+  if ((bus.current >= 0) && (bus.clock != expectedClock(bus.current, false))) {
+    error("%s: clock %u is not the normal speed", when, bus.clock);
+  }
+}
+
+void deviceAccess(taskIndex_t taskIndex)
+{
+  const SimTask& task = tasks[taskIndex];
+
+  if (bus.current != task.i2cBus) {
+    error("task %u: bus %d selected instead of %u", taskIndex, bus.current, task.i2cBus);
+    return;
+  }
+  const uint8_t expectedMux = (task.channel < 8) ? (1 << task.channel) : 0;
+
+  if (bus.mux[task.i2cBus] != expectedMux) {
+    error("task %u: multiplexer 0x%02x instead of 0x%02x", taskIndex, bus.mux[task.i2cBus], expectedMux);
+  }
+
+  if (bus.clock != expectedClock(task.i2cBus, task.slow)) {
+    error("task %u: clock %u instead of %u", taskIndex, bus.clock, expectedClock(task.i2cBus, task.slow));
+  }
+}
+
+// Same as prepare_I2C_by_taskIndex() in src/src/Globals/Plugins.cpp
+bool prepareTask(taskIndex_t taskIndex)
+{
+  if (!isI2C(taskIndex)) {
+    // Make sure the bus is in its default state, like after a non-batched I2C task call
+    I2C_flushDeferredPostTask();
+    return true;
+  }
+  const uint8_t i2cBus = Settings.getI2CInterface(taskIndex);
+
+  I2C_flushDeferredPostTaskOnOtherBus(i2cBus);
+
+  if (bitRead(Settings.I2C_SPI_bus_Flags[taskIndex], I2C_FLAGS_SLOW_SPEED)) {
+    I2CSelectLowClockSpeed(i2cBus);  // Set to slow, also switch the bus
+  } else {
+    I2CSelectHighClockSpeed(i2cBus); // Set to normal, also switch the bus
+  }
+
+  if (!I2CMultiplexerPortSelectedForTask(taskIndex)) {
+    // A previous task in the same batch may have left a channel selected.
+    I2CMultiplexerOff(i2cBus);
+  }
+  I2CMultiplexerSelectByTaskIndex(taskIndex);
+  I2C_startTransaction(i2cBus);
+  return true;
+}
+
+// Same as post_I2C_by_taskIndex() in src/src/Globals/Plugins.cpp
+void postTask(taskIndex_t taskIndex)
+{
+  if (!isI2C(taskIndex)) {
+    return;
+  }
+  const uint8_t i2cBus = Settings.getI2CInterface(taskIndex);
+
+  I2C_endTransaction(i2cBus);
+
+  if (I2C_deferPostTask(i2cBus)) {
+    // Next task in the batch may use the same bus state
+    return;
+  }
+  I2CMultiplexerOff(i2cBus);
+  I2CSelectHighClockSpeed(i2cBus); // Reset, stay on current bus
+}
+
+void callTask(taskIndex_t taskIndex)
+{
+  prepareTask(taskIndex);
+  bus.callOrder.push_back(taskIndex);
+
+  if (isI2C(taskIndex)) {
+    deviceAccess(taskIndex);
+  } else {
+    checkDefaultState("non-I2C task");
+  }
+  HostClock::advance_usec(TASK_DURATION_USEC);
+  postTask(taskIndex);
+}
+
+// Like the periodic calls to all tasks in PluginCall()
+void callAllTasks(bool batch)
+{
+  if (batch) { I2C_beginBatch(); }
+
+  for (taskIndex_t taskIndex = 0; taskIndex < tasks.size(); ++taskIndex) {
+    callTask(taskIndex);
+  }
+
+  if (batch) { I2C_endBatch(); }
+  checkDefaultState("end of round");
+}
+
+struct RunResult {
+  uint32_t muxWrites = 0;
+  uint32_t clockSets = 0;
+};
+
+bool checkCallOrder()
+{
+  for (size_t i = 0; i < bus.callOrder.size(); ++i) {
+    if (bus.callOrder[i] != (i % tasks.size())) {
+      error("call %u: task %u called instead of %u",
+            static_cast<unsigned>(i), bus.callOrder[i], static_cast<unsigned>(i % tasks.size()));
+      return false;
+    }
+  }
+  return true;
+}
+
+bool checkStats(uint32_t expectedTransactions)
+{
+  uint32_t transactions = 0;
+  uint32_t clockChanges = 0;
+
+  for (uint8_t i2cBus = 0; i2cBus < NR_BUSES; ++i2cBus) {
+    const I2C_bus_stats_t& stats = I2C_getBusStats(i2cBus);
+    transactions += stats.transactions;
+    clockChanges += stats.clockChanges;
+
+    if (stats.transactions && (stats.getAvgLatency() < TASK_DURATION_USEC)) {
+      error("bus %u: avg latency %u usec below task duration %u", i2cBus, stats.getAvgLatency(), TASK_DURATION_USEC);
+    }
+  }
+
+  if ((transactions != expectedTransactions) || (clockChanges != bus.clockSets)) {
+    error("statistics: %u transactions, expected %u", transactions, expectedTransactions);
+    error("statistics: %u clock changes, mock bus: %u", clockChanges, bus.clockSets);
+    return false;
+  }
+  return true;
+}
+
+RunResult runRounds(bool batch, int rounds)
+{
+  const uint32_t muxWrites = bus.muxWrites;
+  const uint32_t clockSets = bus.clockSets;
+
+  for (int i = 0; i < rounds; ++i) {
+    callAllTasks(batch);
+  }
+  return { bus.muxWrites - muxWrites, bus.clockSets - clockSets };
+}
+
+bool report(const char *name, const RunResult& batched, const RunResult& unbatched)
+{
+  const bool ok = bus.errors == 0;
+
+  printf("%-36s mux writes: %4u (unbatched %4u)  clock changes: %4u (unbatched %4u)  %s\n",
+         name, batched.muxWrites, unbatched.muxWrites, batched.clockSets, unbatched.clockSets,
+         ok ? "OK" : "FAIL");
+  return ok;
+}
+
+// Run 10 rounds without and with a batch and check the results
+bool runScenario(const char *name)
+{
+  constexpr int ROUNDS = 10;
+
+  bus.callOrder.clear();
+  I2C_clearBusStats();
+  bus.clockSets = 0;
+
+  const RunResult unbatched = runRounds(false, ROUNDS);
+  const RunResult batched   = runRounds(true, ROUNDS);
+
+  uint32_t i2cTasks = 0;
+
+  for (taskIndex_t taskIndex = 0; taskIndex < tasks.size(); ++taskIndex) {
+    if (isI2C(taskIndex)) { ++i2cTasks; }
+  }
+  checkCallOrder();
+  checkStats(2 * ROUNDS * i2cTasks);
+
+  if (batched.muxWrites > unbatched.muxWrites) {
+    error("more multiplexer writes with batch: %u > %u", batched.muxWrites, unbatched.muxWrites);
+  }
+  return report(name, batched, unbatched);
+}
+
+/********************************************************************************************\
+   Scenarios
+ \*********************************************************************************************/
+bool grouped()
+{
+  // 20 sensors behind 3 multiplexer channels, tasks grouped per channel
+  setupBuses(1);
+
+  for (int i = 0; i < 20; ++i) {
+    addTask(0, i * 3 / 20);
+  }
+  return runScenario("20 tasks, 3 channels, grouped");
+}
+
+bool interleaved()
+{
+  setupBuses(1);
+
+  for (int i = 0; i < 20; ++i) {
+    addTask(0, i % 3);
+  }
+  return runScenario("20 tasks, 3 channels, interleaved");
+}
+
+bool mixed()
+{
+  // Slow clock, without multiplexer channel and non-I2C tasks
+  setupBuses(1);
+  addTask(0, 0);
+  addTask(0, 0, true);
+  addTask(0, NO_MUX);
+  addTask(0, NON_I2C);
+  addTask(0, 1);
+  addTask(0, 1);
+  addTask(0, NO_MUX, true);
+  addTask(0, 2, true);
+  addTask(0, 2, true);
+  addTask(0, NON_I2C);
+  return runScenario("Slow clock, no channel, non-I2C");
+}
+
+bool twoBuses()
+{
+  setupBuses(2);
+
+  for (int i = 0; i < 12; ++i) {
+    addTask(i / 6, (i / 2) % 3);
+  }
+  addTask(0, 3);
+  addTask(1, 3);
+  addTask(0, NON_I2C);
+  addTask(1, 4);
+  return runScenario("2 buses with multiplexer");
+}
+
+bool muxWriteFails()
+{
+  // A failed write leaves the multiplexer state unknown, so it is written again for the next task.
+  setupBuses(1);
+
+  for (int i = 0; i < 6; ++i) {
+    addTask(0, i / 2);
+  }
+  I2C_beginBatch();
+  bus.failMuxWrites = 1;
+  bus.quiet         = true;
+
+  for (taskIndex_t taskIndex = 0; taskIndex < tasks.size(); ++taskIndex) {
+    callTask(taskIndex);
+  }
+  I2C_endBatch();
+
+  // Only the task which had its channel selection failing accessed the wrong channel
+  const bool ok = bus.errors == 1;
+  bus.errors = 0;
+  bus.quiet  = false;
+  checkDefaultState("after failed write");
+
+  printf("%-36s failed accesses: %u (expected 1)  %s\n", "Multiplexer write fails",
+         ok ? 1 : 0, ok && bus.errors == 0 ? "OK" : "FAIL");
+  return ok && bus.errors == 0;
+}
+
+bool muxReset()
+{
+  // A multiplexer reset in the middle of a batch, e.g. by a plugin, makes the cached state invalid.
+  setupBuses(1);
+
+  for (int i = 0; i < 4; ++i) {
+    addTask(0, 0);
+  }
+  I2C_beginBatch();
+  callTask(0);
+  callTask(1);
+  bus.mux[0] = 0; // Reset of the chip
+  I2CMultiplexerReset(0);
+  callTask(2);
+  callTask(3);
+  I2C_endBatch();
+  checkDefaultState("after multiplexer reset");
+
+  const bool ok = bus.errors == 0;
+
+  printf("%-36s %s\n", "Multiplexer reset during batch", ok ? "OK" : "FAIL");
+  return ok;
+}
+
+bool schedulerBatch()
+{
+  // Timers which are due are taken in order, like ESPEasy_Scheduler::process_task_device_timer_batch()
+  msecTimerHandlerStruct timers;
+  const unsigned long    now = millis();
+
+  timers.setEcoMode(false);
+  timers.registerAt(3, now + 20);
+  timers.registerAt(1, now + 10);
+  timers.registerAt(2, now + 10);
+  timers.registerAt(4, now + 1000);
+  HostClock::advance_usec(30 * 1000);
+
+  std::vector<unsigned long> order;
+  unsigned long timer = 0;
+  unsigned long id    = timers.getNextId(timer);
+
+  while (id != 0) {
+    order.push_back(id);
+
+    if (timers.peekNextId() == 0) { break; }
+    const unsigned long peeked = timers.peekNextId();
+    id = timers.getNextId(timer);
+
+    if (peeked != id) { order.push_back(0); }
+  }
+
+  // Id 4 is not due yet and must stay scheduled
+  unsigned long timer4 = 0;
+  const bool    ok     = (order.size() == 3) && (order[0] != 3) && (order[1] != 3) && (order[2] == 3) &&
+                         timers.getTimerForId(4, timer4) && (timer4 == now + 1000);
+
+  printf("%-36s %s\n", "Scheduler batch of due timers", ok ? "OK" : "FAIL");
+  return ok;
+}
+
+} // namespace
+
+int main()
+{
+  bool ok = true;
+
+  ok &= grouped();
+  ok &= interleaved();
+  ok &= mixed();
+  ok &= twoBuses();
+  ok &= muxWriteFails();
+  ok &= muxReset();
+  ok &= schedulerBatch();
+
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,22 @@
+#ifndef WIRE_H
+#define WIRE_H
+
+// Host build replacement for the Wire library of the ESP8266 core.
+// The bus is selected by its pins, see MockBus in i2c_bus_sim.cpp
+
+#include "Arduino.h"
+
+class TwoWire {
+public:
+
+  void begin(int sda,
+             int scl);
+
+  void setClock(uint32_t frequency);
+
+  void setClockStretchLimit(uint32_t limit) {}
+};
+
+extern TwoWire Wire;
+
+#endif // ifndef WIRE_H
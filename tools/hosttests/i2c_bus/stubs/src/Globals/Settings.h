@@ -0,0 +1,83 @@
+#ifndef GLOBALS_SETTINGS_H
+#define GLOBALS_SETTINGS_H
+
+// Host build replacement for src/src/Globals/Settings.h
+// Only the I2C settings used by Hardware_I2C.cpp and I2C_BusScheduler.cpp.
+
+#include "../../ESPEasy_common.h"
+
+#include "../DataTypes/TaskIndex.h"
+#include "../ESPEasyCore/ESPEasy_Log.h"
+
+#define TASKS_MAX 32
+
+// From src/src/Globals/Plugins.h
+#define validTaskIndex(X) ((X) < (TASKS_MAX))
+
+// From src/src/DataStructs/DeviceStruct.h
+#define I2C_MULTIPLEXER_NONE       -1
+#define I2C_MULTIPLEXER_TCA9548A   0
+#define I2C_MULTIPLEXER_TCA9546A   1
+#define I2C_MULTIPLEXER_TCA9543A   2
+#define I2C_MULTIPLEXER_PCA9540    3
+
+#define I2C_FLAGS_SLOW_SPEED       0
+#define I2C_FLAGS_MUX_MULTICHANNEL 1
+
+struct I2C_bus_settings_t {
+  int8_t   sda            = -1;
+  int8_t   scl            = -1;
+  uint32_t clockSpeed     = 400000;
+  uint32_t clockSpeedSlow = 100000;
+  uint32_t clockStretch   = 0;
+  int8_t   muxType        = I2C_MULTIPLEXER_NONE;
+  int8_t   muxAddr        = -1;
+  int8_t   muxResetPin    = -1;
+};
+
+struct SettingsStruct {
+  bool     isI2CEnabled(uint8_t i2cBus) const { return bus[i2cBus].sda != -1 && bus[i2cBus].scl != -1; }
+
+  uint8_t  getNrConfiguredI2C_buses() const {
+    uint8_t res = 0;
+
+    for (uint8_t i2cBus = 0; i2cBus < 3; ++i2cBus) {
+      if (isI2CEnabled(i2cBus)) { ++res; }
+    }
+    return res;
+  }
+
+  uint8_t  getI2CInterface(taskIndex_t TaskIndex) const { return I2C_interface[TaskIndex]; }
+
+  int8_t   getI2CSdaPin(uint8_t i2cBus) const { return bus[i2cBus].sda; }
+
+  int8_t   getI2CSclPin(uint8_t i2cBus) const { return bus[i2cBus].scl; }
+
+  uint32_t getI2CClockSpeed(uint8_t i2cBus) const { return bus[i2cBus].clockSpeed; }
+
+  uint32_t getI2CClockSpeedSlow(uint8_t i2cBus) const { return bus[i2cBus].clockSpeedSlow; }
+
+  uint32_t getI2CClockStretch(uint8_t i2cBus) const { return bus[i2cBus].clockStretch; }
+
+  uint8_t  getI2CInterfaceWDT() const { return 0; }
+
+  int8_t   getI2CMultiplexerType(uint8_t i2cBus) const { return bus[i2cBus].muxType; }
+
+  int8_t   getI2CMultiplexerAddr(uint8_t i2cBus) const { return bus[i2cBus].muxAddr; }
+
+  int8_t   getI2CMultiplexerResetPin(uint8_t i2cBus) const { return bus[i2cBus].muxResetPin; }
+
+  bool     EnableClearHangingI2Cbus() const { return false; }
+
+  uint8_t WDI2CAddress = 0;
+  int8_t  I2C_Multiplexer_Channel[TASKS_MAX]{};
+  uint8_t I2C_SPI_bus_Flags[TASKS_MAX]{};
+
+  // Not in SettingsStruct, the bus of a task is stored in I2C_SPI_bus_Flags
+  uint8_t            I2C_interface[TASKS_MAX]{};
+  I2C_bus_settings_t bus[3];
+};
+
+extern SettingsStruct Settings;
+
+#endif // ifndef GLOBALS_SETTINGS_H
@@ -0,0 +1,12 @@
+#ifndef GLOBALS_STATISTICS_H
+#define GLOBALS_STATISTICS_H
+
+// Host build replacement for src/src/Globals/Statistics.h
+
+#include "../../ESPEasy_common.h"
+
+#define BOOT_CAUSE_EXT_WD 10
+
+extern uint8_t lastBootCause;
+
+#endif // ifndef GLOBALS_STATISTICS_H
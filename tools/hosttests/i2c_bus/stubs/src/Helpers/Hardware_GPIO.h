@@ -0,0 +1,10 @@
+#ifndef HELPERS_HARDWARE_GPIO_H
+#define HELPERS_HARDWARE_GPIO_H
+
+// Host build replacement for src/src/Helpers/Hardware_GPIO.h
+
+#include "../../ESPEasy_common.h"
+
+inline bool validGpio(int gpio) { return gpio >= 0 && gpio <= 16; }
+
+#endif // ifndef HELPERS_HARDWARE_GPIO_H
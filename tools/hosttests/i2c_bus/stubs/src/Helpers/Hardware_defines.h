@@ -0,0 +1,3 @@
+#pragma once
+
+// Host build replacement for src/src/Helpers/Hardware_defines.h, not used.
@@ -0,0 +1,10 @@
+#ifndef HELPERS_HARDWARE_DEVICE_INFO_H
+#define HELPERS_HARDWARE_DEVICE_INFO_H
+
+// Host build replacement for src/src/Helpers/Hardware_device_info.h
+
+#include "../../ESPEasy_common.h"
+
+constexpr uint8_t getI2CBusCount() { return 2u; }
+
+#endif // ifndef HELPERS_HARDWARE_DEVICE_INFO_H
@@ -0,0 +1,21 @@
+#ifndef HELPERS_I2C_ACCESS_H
+#define HELPERS_I2C_ACCESS_H
+
+// Host build replacement for src/src/Helpers/I2C_access.h
+// The functions access the mock bus of i2c_bus_sim.cpp
+
+#include "../../ESPEasy_common.h"
+
+unsigned char I2C_wakeup(uint8_t i2caddr);
+
+bool          I2C_write8(uint8_t i2caddr,
+                         uint8_t value);
+
+bool          I2C_write8_reg(uint8_t i2caddr,
+                             uint8_t reg,
+                             uint8_t value);
+
+uint8_t       I2C_read8(uint8_t i2caddr,
+                        bool   *is_ok);
+
+#endif // ifndef HELPERS_I2C_ACCESS_H
@@ -0,0 +1,15 @@
+#ifndef HELPERS_STRINGCONVERTER_H
+#define HELPERS_STRINGCONVERTER_H
+
+// Host build replacement for src/src/Helpers/StringConverter.h
+// Only used for log messages, which are dropped.
+
+#include "../../ESPEasy_common.h"
+
+template<typename ... Args>
+String strformat(Args...) { return String(); }
+
+template<typename ... Args>
+String concat(Args...) { return String(); }
+
+#endif // ifndef HELPERS_STRINGCONVERTER_H
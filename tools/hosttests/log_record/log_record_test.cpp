@@ -0,0 +1,152 @@
+// Check of the deferred log formatting of addLogFormat() (src/src/DataStructs/LogRecord.cpp),
+// and of LogEntry_t / LogBuffer holding such a record.
+//
+// Checked:
+// - LogRecord_format() gives the same result as snprintf() for the supported conversions,
+//   incl. flags, width, precision, '*' arguments, 64 bit integers and string arguments.
+// - The record is allocated with the size of argsSize(), long strings are not truncated.
+// - A LogRecord in the LogBuffer is formatted only once, when read by several log destinations.
+// Shown are the size of LogRecord_writer and of the record vs. the formatted line for an EVENT: log.
+
+#include "src/DataStructs/LogBuffer.h"
+#include "src/DataStructs/LogRecord.h"
+
+#include <cstdio>
+#include <string>
+
+namespace {
+int failures = 0;
+
+void check(bool ok, const char *scenario, const char *what) {
+  if (!ok) {
+    ++failures;
+    printf("  %s: %s FAILED\n", scenario, what);
+  }
+}
+
+void result(const char *scenario, int failuresBefore) {
+  printf("%-40s %s\n", scenario, failures == failuresBefore ? "OK" : "FAILED");
+}
+
+template<typename ... Args>
+std::string formatRecord(const char *format, const Args&... args) {
+  LogRecord_writer record(F(format), LogRecord_writer::argsSize(args ...));
+
+  record.add(args ...);
+  return LogRecord_format(record.data(), record.size()).str();
+}
+
+template<typename ... Args>
+void checkFormat(const char *scenario, const char *expected, const char *format, const Args&... args) {
+  const std::string res = formatRecord(format, args ...);
+
+  if (res != expected) {
+    printf("  \"%s\": \"%s\" expected \"%s\"\n", format, res.c_str(), expected);
+  }
+  check(res == expected, scenario, format);
+}
+
+// Compare with snprintf() of the same arguments
+#define CHECK_FORMAT(FMT, ...)                         \
+  do {                                                 \
+    char expected[256];                                \
+    snprintf(expected, sizeof(expected), FMT, __VA_ARGS__); \
+    checkFormat(scenario, expected, FMT, __VA_ARGS__); \
+  } while (0)
+
+void conversions() {
+  const char *scenario = "Conversions vs. snprintf";
+  const int   before   = failures;
+
+  CHECK_FORMAT("%d %i %d", 42, -7, INT32_MIN);
+  CHECK_FORMAT("%u %x %X %o", 4000000000u, 0xbeefu, 0xbeefu, 8u);
+  CHECK_FORMAT("[%5d] [%-5d] [%05d] [%+d]", 12, 12, -12, 12);
+  CHECK_FORMAT("%#x %#o", 255u, 8u);
+  CHECK_FORMAT("%f %.2f %8.3f %-8.1f|", 3.14159, 2.5f, -1.0 / 3, 1e3);
+  CHECK_FORMAT("%e %E %g %G", 12345.678, 0.000123, 0.0001, 1e20);
+  CHECK_FORMAT("%lld %llu", static_cast<long long>(-(1ll << 40)), static_cast<unsigned long long>(UINT64_MAX));
+  CHECK_FORMAT("%ld %lu", -123456789l, 123456789ul);
+  CHECK_FORMAT("%c%c %%", 'o', 'k');
+  CHECK_FORMAT("[%*d] [%-*d] [%.*f]", 6, 42, 6, 42, 3, 2.0 / 3);
+  CHECK_FORMAT("%s %10s [%-10s] %.3s", "abc", "right", "left", "truncate");
+  CHECK_FORMAT("%hhu %hd", 200, -5);
+
+  // String and flash string arguments
+  checkFormat(scenario, "EVENT: Clock#Time=Mon,12:00", "EVENT: %s", String("Clock#Time=Mon,12:00"));
+  checkFormat(scenario, "[flash] [    flash]", "[%s] [%9s]", F("flash"), F("flash"));
+
+  // Integers formatted as string, missing argument
+  checkFormat(scenario, "12 -3", "%s %s", 12, -3);
+  checkFormat(scenario, "1 ?", "%d %d", 1);
+  result(scenario, before);
+}
+
+void record_size() {
+  const char *scenario = "Record size, long strings";
+  const int   before   = failures;
+  const std::string event = "Rules#Long=" + std::string(2000, 'x');
+  const String str(event);
+
+  const size_t argsSize = LogRecord_writer::argsSize(str, 1, 2.0, F("f"), static_cast<uint64_t>(1), "abc");
+  LogRecord_writer record(F("%s %d %f %s %llu %s"), argsSize);
+
+  record.add(str, 1, 2.0, F("f"), static_cast<uint64_t>(1), "abc");
+  check(record.size() == sizeof(PGM_P) + argsSize, scenario, "record size");
+
+  check(formatRecord("EVENT: %s", str) == "EVENT: " + event, scenario, "long string not truncated");
+  check(formatRecord("EVENT: %s Processing: %d ms", str, 3) == "EVENT: " + event + " Processing: 3 ms",
+        scenario, "argument after long string");
+  result(scenario, before);
+
+  LogRecord_writer eventRecord(F("EVENT: %s"), LogRecord_writer::argsSize(String("Clock#Time=Mon,12:00")));
+
+  eventRecord.add(String("Clock#Time=Mon,12:00"));
+  printf("  LogRecord_writer: %u bytes  EVENT: record %u bytes (formatted %u)\n",
+         static_cast<unsigned>(sizeof(LogRecord_writer)),
+         static_cast<unsigned>(eventRecord.size()),
+         static_cast<unsigned>(formatRecord("EVENT: %s", String("Clock#Time=Mon,12:00")).size()));
+}
+
+void format_once() {
+  const char *scenario = "Formatted once for all destinations";
+  const int   before   = failures;
+  LogBuffer   buffer;
+
+  // The format string is changed after the first read,
+  // so formatting it again would give a different line
+  char format[] = "EVENT: %s";
+
+  {
+    LogRecord_writer record(F(format), LogRecord_writer::argsSize(String("System#Boot")));
+
+    record.add(String("System#Boot"));
+    LogEntry_t entry(LOG_LEVEL_INFO, std::move(record));
+
+    check(record.data() == nullptr, scenario, "record moved to entry");
+    entry.setSubscribers();
+    buffer.add(std::move(entry));
+  }
+
+  uint32_t timestamp{};
+  uint8_t  loglevel{};
+  String   message;
+
+  check(buffer.getNext(LOG_TO_SERIAL, timestamp, message, loglevel), scenario, "read by serial");
+  check(message == "EVENT: System#Boot", scenario, "serial message");
+  format[0] = 'X';
+
+  check(buffer.getNext(LOG_TO_WEBLOG, timestamp, message, loglevel), scenario, "read by weblog");
+  check(message == "EVENT: System#Boot", scenario, "weblog message");
+  check(buffer.getNext(LOG_TO_SYSLOG, timestamp, message, loglevel), scenario, "read by syslog");
+  check(message == "EVENT: System#Boot", scenario, "syslog message");
+  check(!buffer.getNext(LOG_TO_SYSLOG, timestamp, message, loglevel), scenario, "read once per destination");
+  result(scenario, before);
+}
+} // namespace
+
+int main() {
+  conversions();
+  record_size();
+  format_once();
+  return failures == 0 ? 0 : 1;
+}
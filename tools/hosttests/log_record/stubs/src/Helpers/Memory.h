@@ -0,0 +1,10 @@
+#ifndef HELPERS_MEMORY_H
+#define HELPERS_MEMORY_H
+
+// Host build replacement for src/src/Helpers/Memory.h
+
+#include "../../ESPEasy_common.h"
+
+inline void* special_calloc(size_t num, size_t size) { return calloc(num, size); }
+
+#endif // ifndef HELPERS_MEMORY_H
@@ -0,0 +1,29 @@
+#ifndef HELPERS_STRINGCONVERTER_H
+#define HELPERS_STRINGCONVERTER_H
+
+// Host build replacement for src/src/Helpers/StringConverter.h
+
+#include "../../ESPEasy_common.h"
+
+#include "../DataTypes/LogLevels.h"
+#include "../Helpers/Memory.h"
+#include "../Helpers/StringConverter_Numerical.h"
+
+template<typename ... Args>
+String strformat(const String& format, Args... args) {
+  const int len = snprintf(nullptr, 0, format.c_str(), args ...);
+
+  if (len <= 0) { return String(); }
+  std::string res(len + 1, '\0');
+
+  snprintf(&res[0], res.size(), format.c_str(), args ...);
+  res.resize(len);
+  return String(res);
+}
+
+// From src/src/ESPEasyCore/ESPEasy_Log.h, all log levels active
+inline bool loglevelActiveFor(uint8_t) { return true; }
+
+inline bool loglevelActiveFor(LogDestination, uint8_t) { return true; }
+
+#endif // ifndef HELPERS_STRINGCONVERTER_H
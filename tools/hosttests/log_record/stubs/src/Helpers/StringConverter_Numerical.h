@@ -0,0 +1,16 @@
+#ifndef HELPERS_STRINGCONVERTER_NUMERICAL_H
+#define HELPERS_STRINGCONVERTER_NUMERICAL_H
+
+// Host build replacement for src/src/Helpers/StringConverter_Numerical.h
+
+#include "../../ESPEasy_common.h"
+
+inline String ull2String(uint64_t value, uint8_t base = 10) {
+  return String(static_cast<unsigned long long>(value), base);
+}
+
+inline String ll2String(int64_t value, uint8_t base = 10) {
+  return String(static_cast<long long>(value), base);
+}
+
+#endif // ifndef HELPERS_STRINGCONVERTER_NUMERICAL_H
@@ -0,0 +1,294 @@
+// Simulation of the OLED displays used by P036, to check the partial display updates
+// of SSD1306Wire and SH1106Wire (lib/esp8266-oled-ssd1306).
+//
+// The I2C transmissions are decoded by a model of the display controller:
+// - SSD1306: horizontal addressing mode, with the column and page range set by COLUMNADDR/PAGEADDR.
+// - SH1106:  page addressing mode, 132 columns of which 2..129 are visible.
+// After each display() the display RAM must match the pixel buffer.
+// Shown are the data bytes sent per display() vs. a single bounding box around all changes
+// (as sent before only the changed columns per page were sent), and the total I2C bytes.
+
+#include "OLEDDisplay.h"
+#include "SH1106Wire.h"
+#include "SSD1306Wire.h"
+
+#include <cstdio>
+#include <random>
+#include <string>
+
+TwoWire Wire;
+
+namespace {
+constexpr uint8_t RAM_COLUMNS = 132;
+constexpr uint8_t RAM_PAGES   = 8;
+
+struct Controller {
+  void reset(bool pageAddressing) {
+    *this          = Controller();
+    pageMode       = pageAddressing;
+    std::mt19937 rnd(1);
+
+    // Display RAM is not cleared at power on
+    for (uint8_t p = 0; p < RAM_PAGES; ++p) {
+      for (uint8_t c = 0; c < RAM_COLUMNS; ++c) {
+        ram[p][c] = rnd();
+      }
+    }
+  }
+
+  void command(uint8_t cmd) {
+    if (argsPending > 0) {
+      args[argPos++] = cmd;
+
+      if (--argsPending == 0) {
+        if (pendingCmd == COLUMNADDR) {
+          colStart = args[0];
+          colEnd   = args[1];
+          col      = colStart;
+        } else if (pendingCmd == PAGEADDR) {
+          pageStart = args[0];
+          pageEnd   = args[1];
+          page      = pageStart;
+        }
+      }
+      return;
+    }
+
+    switch (cmd) {
+      case COLUMNADDR:
+      case PAGEADDR:
+        argsPending = 2;
+        break;
+      case SETCONTRAST:
+      case CHARGEPUMP:
+      case SETMULTIPLEX:
+      case SETDISPLAYOFFSET:
+      case SETDISPLAYCLOCKDIV:
+      case SETPRECHARGE:
+      case SETCOMPINS:
+      case SETVCOMDETECT:
+      case MEMORYMODE:
+      case SH1106_SET_PUMP_MODE:
+        argsPending = 1;
+        break;
+      default:
+
+        if (pageMode) {
+          if ((cmd >= 0xB0) && (cmd < 0xB0 + RAM_PAGES)) {
+            page = cmd - 0xB0;
+          } else if (cmd <= 0x0F) {
+            col = (col & 0xF0) | cmd;
+          } else if (cmd <= 0x1F) {
+            col = (col & 0x0F) | ((cmd & 0x0F) << 4);
+          }
+        }
+        break;
+    }
+    pendingCmd = cmd;
+    argPos     = 0;
+  }
+
+  void data(uint8_t value) {
+    ++dataBytes;
+
+    if (pageMode) {
+      if (col < RAM_COLUMNS) {
+        ram[page][col++] = value;
+      }
+      return;
+    }
+    ram[page][col] = value;
+
+    if (col == colEnd) {
+      col  = colStart;
+      page = (page == pageEnd) ? pageStart : page + 1;
+    } else {
+      ++col;
+    }
+  }
+
+  bool    pageMode = false;
+  uint8_t ram[RAM_PAGES][RAM_COLUMNS]{};
+  uint8_t col       = 0;
+  uint8_t page      = 0;
+  uint8_t colStart  = 0;
+  uint8_t colEnd    = 127;
+  uint8_t pageStart = 0;
+  uint8_t pageEnd   = 7;
+
+  uint8_t pendingCmd  = 0;
+  uint8_t argsPending = 0;
+  uint8_t argPos      = 0;
+  uint8_t args[2]{};
+
+  uint32_t dataBytes = 0;
+
+  // Incl. the address byte
+  uint32_t i2cBytes = 0;
+};
+
+Controller controller;
+} // namespace
+
+uint8_t TwoWire::endTransmission() {
+  controller.i2cBytes += data.size() + 1;
+
+  if (data.empty()) { return 0; }
+
+  if (data[0] == 0x80) {
+    for (size_t i = 1; i < data.size(); ++i) {
+      controller.command(data[i]);
+    }
+  } else if (data[0] == 0x40) {
+    for (size_t i = 1; i < data.size(); ++i) {
+      controller.data(data[i]);
+    }
+  }
+  return 0;
+}
+
+namespace {
+int failures = 0;
+
+struct DisplayType {
+  const char *name;
+  bool        sh1106;
+  int         height;
+};
+
+// Data bytes a single bounding box around all changes would need
+uint32_t boundingBoxBytes(const OLEDDisplay& display, int width, int height) {
+  int minX = width, maxX = -1, minY = height, maxY = -1;
+
+  for (int page = 0; page < height / 8; ++page) {
+    for (int x = 0; x < width; ++x) {
+      const int i = x + page * width;
+
+      if (display.buffer[i] != display.buffer_back[i]) {
+        minX = std::min(minX, x);
+        maxX = std::max(maxX, x);
+        minY = std::min(minY, page);
+        maxY = std::max(maxY, page);
+      }
+    }
+  }
+  return maxX < 0 ? 0 : (maxX - minX + 1) * (maxY - minY + 1);
+}
+
+bool ramMatches(const OLEDDisplay& display, const DisplayType& type) {
+  const int width     = 128;
+  const int x_offset  = type.sh1106 ? 2 : 0;
+
+  for (int page = 0; page < type.height / 8; ++page) {
+    for (int x = 0; x < width; ++x) {
+      if (controller.ram[page][x + x_offset] != display.buffer[x + page * width]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+std::string clockText(int minutes) {
+  char buf[8];
+
+  snprintf(buf, sizeof(buf), "%02d:%02d", (minutes / 60) % 24, minutes % 60);
+  return buf;
+}
+
+// P036 like screen: header with clock, 4 (or 2) lines, page indicator at the bottom
+void drawScreen(OLEDDisplay& display, const DisplayType& type, int step, int scenario) {
+  const int lines = type.height == 64 ? 4 : 2;
+
+  display.clear();
+  display.drawString(0, 0, "ESPEasy");
+  display.drawString(96, 0, clockText(scenario == 0 ? step : 0));
+
+  for (int line = 0; line < lines; ++line) {
+    std::string text = "Value " + std::to_string(line) + ": ";
+
+    if ((scenario == 2) && (line == 1)) {
+      text += std::to_string(20.0 + step / 10.0).substr(0, 4);
+    } else if (scenario == 3) {
+      text += std::to_string((step * 37 + line * 11) % 1000);
+    } else {
+      text += "21.5";
+    }
+    display.drawString(0, 12 + line * (type.height == 64 ? 12 : 8), text.c_str());
+  }
+
+  if (scenario == 1) {
+    // Page indicator, active page changes
+    for (int p = 0; p < 4; ++p) {
+      if (p == step % 4) {
+        display.fillRect(52 + p * 6, type.height - 3, 3, 3);
+      } else {
+        display.drawRect(52 + p * 6, type.height - 3, 3, 3);
+      }
+    }
+    display.drawString(96, 0, clockText(step));
+  }
+}
+
+void run(const DisplayType& type) {
+  const char *scenarios[] = {
+    "clock",
+    "clock + page indicator",
+    "one line value",
+    "all lines",
+    "random rectangles",
+  };
+
+  for (int scenario = 0; scenario < 5; ++scenario) {
+    controller.reset(type.sh1106);
+    OLEDDisplay *display = type.sh1106
+                           ? static_cast<OLEDDisplay *>(new SH1106Wire(0x3c, 0, 0))
+                           : static_cast<OLEDDisplay *>(new SSD1306Wire(0x3c, 0, 0, 128, type.height));
+
+    display->init();
+    bool ok = ramMatches(*display, type);
+
+    std::mt19937 rnd(scenario);
+    uint32_t sent     = 0;
+    uint32_t boundBox = 0;
+    const uint32_t i2cStart = controller.i2cBytes;
+    const int steps = 100;
+
+    for (int step = 1; step <= steps; ++step) {
+      if (scenario == 4) {
+        display->setColor(INVERSE);
+        display->fillRect(rnd() % 128, rnd() % type.height, 1 + rnd() % 20, 1 + rnd() % 20);
+        display->setColor(WHITE);
+      } else {
+        drawScreen(*display, type, step, scenario);
+      }
+      boundBox += boundingBoxBytes(*display, 128, type.height);
+      display->display();
+      sent += display->lastDisplayBytes;
+
+      if (!ramMatches(*display, type)) {
+        ok = false;
+      }
+    }
+
+    if (!ok) { ++failures; }
+    printf("%-14s %-24s data bytes: %6u (bounding box %6u)  I2C bytes: %6u  %s\n",
+           type.name, scenarios[scenario], sent, boundBox,
+           controller.i2cBytes - i2cStart, ok ? "OK" : "FAILED");
+    delete display;
+  }
+}
+} // namespace
+
+int main() {
+  const DisplayType types[] = {
+    { "SSD1306 128x64", false, 64 },
+    { "SSD1306 128x32", false, 32 },
+    { "SH1106 128x64",  true,  64 },
+  };
+
+  for (const DisplayType& type : types) {
+    run(type);
+  }
+  return failures == 0 ? 0 : 1;
+}
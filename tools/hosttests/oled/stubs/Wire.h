@@ -0,0 +1,30 @@
+#ifndef WIRE_H
+#define WIRE_H
+
+// Host build replacement for the Wire library.
+// Transmissions are passed to the display controller model in oled_display_sim.cpp
+
+#include "Arduino.h"
+
+#include <vector>
+
+class TwoWire {
+public:
+
+  void beginTransmission(uint8_t address) {
+    data.clear();
+  }
+
+  size_t write(uint8_t value) {
+    data.push_back(value);
+    return 1;
+  }
+
+  uint8_t endTransmission();
+
+  std::vector<uint8_t> data;
+};
+
+extern TwoWire Wire;
+
+#endif // ifndef WIRE_H
@@ -0,0 +1,8 @@
+#ifndef PGMSPACE_H
+#define PGMSPACE_H
+
+// Host build replacement for pgmspace.h, see Arduino.h
+
+#include "Arduino.h"
+
+#endif // ifndef PGMSPACE_H
@@ -0,0 +1,252 @@
+// Check of the P128 (NeoPixelBusFX) effects, using P128_data_struct.cpp and the color classes of NeoPixelBus.
+//
+// The LED strip is replaced by an in-memory pixel buffer (stubs/NeoPixelBus.h),
+// NeoPixelBrightnessBus.h of the library is used unchanged on top of it.
+// Checked:
+// - All commands and effects run with 0..300 pixels, without a division by zero.
+//   With 0 pixels the commands are rejected and nothing is shown.
+// - fade (integer blend) matches RgbColor::LinearBlend, also with a fade delay per pixel.
+// - rainbow (8.8 fixed-point step) matches the wheel position i * 256 / pixelCount.
+// - kitt and comet halve the brightness scaled pixel buffer.
+// Shown is the time per fade frame of 300 pixels, vs. the float LinearBlend per pixel it replaced.
+
+#include "src/PluginStructs/P128_data_struct.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace {
+int failures = 0;
+
+void check(bool ok, const char *scenario, const std::string& what) {
+  if (!ok) {
+    ++failures;
+    printf("  %s: %s FAILED\n", scenario, what.c_str());
+  }
+}
+
+void result(const char *scenario, int failuresBefore) {
+  printf("%-44s %s\n", scenario, failures == failuresBefore ? "OK" : "FAILED");
+}
+
+// Like the command parser, Par1 .. Par5 are the numerical values of the arguments after the command
+bool command(P128_data_struct& p128, const std::string& cmd) {
+  EventStruct event;
+  int *pars[] = { &event.Par1, &event.Par2, &event.Par3, &event.Par4, &event.Par5 };
+
+  for (uint8_t i = 0; i < 5; ++i) {
+    *pars[i] = parseString(String(cmd.c_str()), i + 2).toInt();
+  }
+  return p128.plugin_write(&event, String(cmd.c_str()));
+}
+
+void tick(P128_data_struct& p128, int count = 1) {
+  EventStruct event;
+
+  for (int i = 0; i < count; ++i) {
+    p128.plugin_fifty_per_second(&event);
+  }
+}
+
+RgbColor pixel(uint16_t index) {
+  return NeoGrbFeature::retrievePixelColor(NeoHostBus::pixels, index);
+}
+
+int maxDiff(const RgbColor& a, const RgbColor& b) {
+  return std::max({ std::abs(a.R - b.R), std::abs(a.G - b.G), std::abs(a.B - b.B) });
+}
+
+void all_modes() {
+  const char *scenario = "All effects, 0 .. 300 pixels";
+  const int   before   = failures;
+  const char *commands[] = {
+    "nfx on",                 "nfx off",                "nfx fade ff0000 500",     "nfx all 00ff00",
+    "nfx rgb 0000ff",         "nfx hsv 120 100 50",     "nfx one 1 ff00ff",        "nfx hsvone 1 240 100 100",
+    "nfx line 1 3 ffffff",    "nfx hsvline 1 3 60 100 100", "nfx tick 4 ffffff",   "nfx rainbow",
+    "nfx colorfade ff0000 0000ff", "nfx kitt ff0000",   "nfx comet 00ff00",        "nfx theatre ff0000 000000 2",
+    "nfx scan ff0000",        "nfx dualscan ff0000",    "nfx twinkle ff0000",      "nfx twinklefade ff0000",
+    "nfx sparkle ffffff 000000", "nfx wipe ff0000",     "nfx dualwipe 00ff00",     "nfx fire",
+    "nfx fireflicker",        "nfx simpleclock",        "nfx speed -10",           "nfx kitt ff0000",
+    "nfx comet 00ff00",       "nfx wipe ff0000",        "nfx dualwipe 00ff00",     "nfx dim 100",
+    "nfx stop",               "nfx statusrequest",
+  };
+  const uint16_t pixelCounts[] = { 0, 1, 2, 3, 10, 60, 300 };
+
+  for (uint16_t pixelCount : pixelCounts) {
+    P128_data_struct p128(2, pixelCount, 255);
+    const uint32_t   shows = NeoHostBus::shows;
+
+    for (const char *cmd : commands) {
+      const bool accepted = command(p128, cmd);
+      check(accepted == (pixelCount > 0), scenario, std::to_string(pixelCount) + " pixels: " + cmd);
+      tick(p128, 120);
+    }
+    check((NeoHostBus::shows > shows) == (pixelCount > 0), scenario, std::to_string(pixelCount) + " pixels shown");
+  }
+  result(scenario, before);
+}
+
+void fade() {
+  const char *scenario = "Fade vs. LinearBlend";
+  const int   before   = failures;
+  const uint16_t pixelCount = 60;
+  P128_data_struct p128(2, pixelCount, 255);
+
+  struct Fade {
+    RgbColor    from;
+    RgbColor    to;
+    int         fadedelay;
+    const char *cmd;
+  };
+  const Fade fades[] = {
+    { RgbColor(0x20, 0x40, 0x80), RgbColor(0xff, 0xa0, 0x10), 0,   "nfx fade ffa010 1000 0" },
+    { RgbColor(0xff, 0xa0, 0x10), RgbColor(0x00, 0x00, 0xff), 40,  "nfx fade 0000ff 700 40" },
+    { RgbColor(0x00, 0x00, 0xff), RgbColor(0x01, 0xfe, 0x80), -20, "nfx fade 01fe80 1500 -20" },
+  };
+
+  command(p128, "nfx all 204080 20");
+  tick(p128, 5);
+  int worst = 0;
+
+  for (const Fade& f : fades) {
+    const int fadetime = parseString(f.cmd, 4).toInt();
+    command(p128, f.cmd);
+
+    for (int k = 1; k <= fadetime / 20 + pixelCount * abs(f.fadedelay) / 20 + 1; ++k) {
+      tick(p128);
+
+      for (uint16_t i = 0; i < pixelCount; ++i) {
+        const int   order    = f.fadedelay < 0 ? pixelCount - i - 1 : i;
+        const int   counter  = 20 * (k - order * abs(f.fadedelay) / 20);
+        const float progress = constrain(static_cast<float>(counter) / fadetime, 0.0f, 1.0f);
+        const int   diff     = maxDiff(pixel(i), RgbColor::LinearBlend(f.from, f.to, progress));
+        worst = std::max(worst, diff);
+      }
+    }
+
+    for (uint16_t i = 0; i < pixelCount; ++i) {
+      check(maxDiff(pixel(i), f.to) == 0, scenario, std::string(f.cmd) + ": target reached");
+    }
+  }
+  check(worst <= 1, scenario, "max. deviation " + std::to_string(worst));
+  result(scenario, before);
+  printf("  max. deviation per color: %d\n", worst);
+}
+
+// P128_data_struct::Wheel()
+RgbColor wheel(uint8_t pos) {
+  pos = 255 - pos;
+
+  if (pos < 85) { return RgbColor(255 - pos * 3, 0, pos * 3); }
+
+  if (pos < 170) {
+    pos -= 85;
+    return RgbColor(0, pos * 3, 255 - pos * 3);
+  }
+  pos -= 170;
+  return RgbColor(pos * 3, 255 - pos * 3, 0);
+}
+
+void rainbow() {
+  const char *scenario = "Rainbow vs. i * 256 / pixelCount";
+  const int   before   = failures;
+  int worst            = 0;
+
+  for (uint16_t pixelCount : { 1, 7, 60, 150, 255, 299, 300 }) {
+    P128_data_struct p128(2, pixelCount, 255);
+    uint32_t counter20ms = 0;
+
+    // Not from off, as that fades in the brightness
+    command(p128, "nfx stop");
+    command(p128, "nfx rainbow 7");
+
+    for (int k = 0; k < 100; ++k) {
+      tick(p128);
+      ++counter20ms;
+
+      for (uint16_t i = 0; i < pixelCount; ++i) {
+        const uint32_t expected = (i * 256 / pixelCount) + counter20ms * 7 / 10;
+        int deviation           = -1;
+
+        for (int d = 0; d <= 2 && deviation < 0; ++d) {
+          if (maxDiff(pixel(i), wheel((expected - d) & 255)) == 0) { deviation = d; }
+        }
+        worst = (deviation < 0) ? 99 : std::max(worst, deviation);
+      }
+    }
+  }
+  check(worst <= 1, scenario, "max. wheel position deviation " + std::to_string(worst));
+  result(scenario, before);
+  printf("  max. wheel position deviation: %d\n", worst);
+}
+
+void halve() {
+  const char *scenario = "Kitt/comet tail, brightness 100";
+  const int   before   = failures;
+  const uint16_t pixelCount = 20;
+  P128_data_struct p128(2, pixelCount, 100);
+
+  for (const char *cmd : { "nfx kitt ffc080 50", "nfx comet 40ff20 -50" }) {
+    command(p128, cmd);
+
+    for (int k = 0; k < 50; ++k) {
+      const std::vector<uint8_t> previous(NeoHostBus::pixels, NeoHostBus::pixels + NeoHostBus::pixelsSize);
+      tick(p128);
+      int changed = 0;
+
+      for (size_t i = 0; i < previous.size(); ++i) {
+        if (NeoHostBus::pixels[i] != (previous[i] >> 1)) { ++changed; }
+      }
+
+      // Only the head is set, the rest is halved
+      check(changed <= 3, scenario, std::string(cmd) + ": " + std::to_string(changed) + " bytes not halved");
+    }
+  }
+  result(scenario, before);
+}
+
+void benchmark() {
+  const uint16_t pixelCount = 300;
+  const int      frames     = 2000;
+  P128_data_struct p128(2, pixelCount, 255);
+
+  command(p128, "nfx fade ffa010 60000 0");
+  auto start = std::chrono::steady_clock::now();
+
+  tick(p128, frames);
+  const double integerBlend = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+  // Per pixel as done before: float progress and LinearBlend
+  NeoPixelBrightnessBus<NeoGrbFeature, NeoEsp8266Uart1800KbpsMethod> bus(pixelCount);
+  std::vector<RgbColor> from(pixelCount, RgbColor(0x20, 0x40, 0x80));
+  const RgbColor to(0xff, 0xa0, 0x10);
+  volatile uint32_t fadetime = 60000;
+
+  start = std::chrono::steady_clock::now();
+
+  for (int k = 0; k < frames; ++k) {
+    for (uint16_t i = 0; i < pixelCount; ++i) {
+      const long  counter  = 20 * k;
+      const float progress = constrain(static_cast<float>(counter) / fadetime, 0.0f, 1.0f);
+      bus.SetPixelColor(i, RgbColor::LinearBlend(from[i], to, progress));
+    }
+    bus.Show();
+  }
+  const double floatBlend = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+  printf("Fade frame of %u pixels: %.0f ns (float LinearBlend: %.0f ns)\n",
+         pixelCount, integerBlend / frames, floatBlend / frames);
+}
+} // namespace
+
+int main() {
+  all_modes();
+  fade();
+  rainbow();
+  halve();
+  benchmark();
+  return failures == 0 ? 0 : 1;
+}
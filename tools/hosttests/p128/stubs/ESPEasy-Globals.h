@@ -0,0 +1,7 @@
+#ifndef ESPEASY_GLOBALS_H_
+#define ESPEASY_GLOBALS_H_
+
+// Host build replacement for src/ESPEasy-Globals.h
+// Declared in _Plugin_Helper.h of this test.
+
+#endif // ifndef ESPEASY_GLOBALS_H_
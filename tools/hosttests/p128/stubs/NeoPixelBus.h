@@ -0,0 +1,126 @@
+#ifndef NEOPIXELBUS_H
+#define NEOPIXELBUS_H
+
+// Host build replacement for lib/NeoPixelBus/src/NeoPixelBus.h
+// The color classes and color features are the ones of the library,
+// the bus keeps the pixels in memory like the library does, but sends them nowhere.
+// NeoPixelBrightnessBus.h of the library is used unchanged on top of it.
+
+#include <Arduino.h>
+
+#ifndef PGM_VOID_P
+# define PGM_VOID_P const void *
+#endif // ifndef PGM_VOID_P
+
+#include "internal/NeoHueBlend.h"
+#include "internal/NeoSettings.h"
+#include "internal/RgbColor.h"
+#include "internal/Rgb16Color.h"
+#include "internal/Rgb48Color.h"
+#include "internal/HslColor.h"
+#include "internal/HsbColor.h"
+#include "internal/HtmlColor.h"
+#include "internal/RgbwColor.h"
+#include "internal/NeoColorFeatures.h"
+#include "internal/NeoBusChannel.h"
+
+#include <vector>
+
+// Pixel buffer of the last created bus, for the test to inspect
+struct NeoHostBus {
+  static uint8_t *pixels;
+  static size_t   pixelsSize;
+  static uint32_t shows;
+};
+
+// Method types selected by P128_data_struct.h, not used on the host
+class NeoEsp8266Uart1800KbpsMethod {};
+class NeoWs2812xMethod {};
+
+template<typename T_COLOR_FEATURE, typename T_METHOD> class NeoPixelBus {
+public:
+
+  NeoPixelBus(uint16_t countPixels, uint8_t) : NeoPixelBus(countPixels) {}
+
+  NeoPixelBus(uint16_t countPixels) :
+    _countPixels(countPixels),
+    _data(countPixels * T_COLOR_FEATURE::PixelSize)
+  {
+    NeoHostBus::pixels     = _data.data();
+    NeoHostBus::pixelsSize = _data.size();
+  }
+
+  virtual ~NeoPixelBus()
+  {
+    NeoHostBus::pixels     = nullptr;
+    NeoHostBus::pixelsSize = 0;
+  }
+
+  void Begin() { ClearTo(0); }
+
+  void Show()
+  {
+    if (_dirty) {
+      ++NeoHostBus::shows;
+      _dirty = false;
+    }
+  }
+
+  bool     CanShow() const    { return true; }
+  void     Dirty()            { _dirty = true; }
+  uint8_t* Pixels()           { return _data.data(); }
+  size_t   PixelsSize() const { return _data.size(); }
+  uint16_t PixelCount() const { return _countPixels; }
+
+  void SetPixelColor(uint16_t indexPixel, typename T_COLOR_FEATURE::ColorObject color)
+  {
+    if (indexPixel < _countPixels) {
+      T_COLOR_FEATURE::applyPixelColor(_data.data(), indexPixel, color);
+      Dirty();
+    }
+  }
+
+  typename T_COLOR_FEATURE::ColorObject GetPixelColor(uint16_t indexPixel) const
+  {
+    if (indexPixel < _countPixels) {
+      return T_COLOR_FEATURE::retrievePixelColor(_data.data(), indexPixel);
+    }
+    return 0;
+  }
+
+  void ClearTo(typename T_COLOR_FEATURE::ColorObject color)
+  {
+    for (uint16_t i = 0; i < _countPixels; ++i) {
+      T_COLOR_FEATURE::applyPixelColor(_data.data(), i, color);
+    }
+    Dirty();
+  }
+
+  void RotateLeft(uint16_t rotationCount, uint16_t first, uint16_t last)
+  {
+    if ((first < _countPixels) && (last < _countPixels) && (first < last) && ((last - first) >= rotationCount)) {
+      std::vector<typename T_COLOR_FEATURE::ColorObject> colors;
+
+      for (uint16_t i = first; i <= last; ++i) { colors.push_back(GetPixelColor(i)); }
+
+      for (uint16_t i = first; i <= last; ++i) {
+        SetPixelColor(i, colors[(i - first + rotationCount) % colors.size()]);
+      }
+    }
+  }
+
+  void RotateRight(uint16_t rotationCount, uint16_t first, uint16_t last)
+  {
+    if ((first < _countPixels) && (last < _countPixels) && (first < last) && ((last - first) >= rotationCount)) {
+      RotateLeft((last - first + 1) - rotationCount, first, last);
+    }
+  }
+
+protected:
+
+  const uint16_t       _countPixels;
+  std::vector<uint8_t> _data;
+  bool                 _dirty = false;
+};
+
+#endif // ifndef NEOPIXELBUS_H
@@ -0,0 +1,81 @@
+#ifndef PLUGIN_HELPER_H
+#define PLUGIN_HELPER_H
+
+// Host build replacement for src/_Plugin_Helper.h
+// Only what P128_data_struct.cpp needs.
+
+#include "ESPEasy_common.h"
+
+#include "src/ESPEasyCore/ESPEasy_Log.h"
+
+#define A0 17
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+struct PluginTaskData_base {
+  virtual ~PluginTaskData_base() = default;
+};
+
+struct EventStruct {
+  uint8_t TaskIndex    = 0;
+  uint8_t BaseVarIndex = 0;
+  int     Par1         = 0;
+  int     Par2         = 0;
+  int     Par3         = 0;
+  int     Par4         = 0;
+  int     Par5         = 0;
+};
+
+struct UserVarStruct {
+  void  setFloat(uint8_t taskIndex, uint8_t varNr, float value) { values[taskIndex * 4 + varNr] = value; }
+  float operator[](unsigned int index) const                   { return values[index]; }
+
+  float values[4]{};
+};
+
+extern UserVarStruct UserVar;
+
+// Time of day for the simple clock
+struct NodeTime {
+  int hour() const   { return hours; }
+  int minute() const { return minutes; }
+  int second() const { return seconds; }
+
+  int hours   = 0;
+  int minutes = 0;
+  int seconds = 0;
+};
+
+extern NodeTime node_time;
+
+extern bool printToWeb;
+extern bool printToWebJSON;
+
+inline void SendStatus(struct EventStruct *, const String&) {}
+
+template<typename ... Args>
+String strformat(Args...) { return String(); }
+
+template<typename ... Args>
+String concat(Args...) { return String(); }
+
+inline bool equals(const String& str, const __FlashStringHelper *f_str) { return str == String(f_str); }
+
+// Lower case argument nr. index (1 based), separated by comma or space
+String parseString(const String& string, uint8_t index);
+
+// Index of needle in the '|' separated list haystack, or -1
+int    GetCommandCode(const char *needle, const char *haystack);
+
+String formatToHex_no_prefix(unsigned long value, unsigned int minimal_hex_digits = 0);
+
+long   HwRandom(long howbig);
+long   HwRandom(long howsmall, long howbig);
+inline void randomSeed(unsigned long) {}
+inline int  analogRead(uint8_t) { return 0; }
+
+inline long map(long x, long in_min, long in_max, long out_min, long out_max) {
+  return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+#endif // ifndef PLUGIN_HELPER_H
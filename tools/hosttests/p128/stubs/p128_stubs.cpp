@@ -0,0 +1,77 @@
+// Implementation of the ESPEasy functions declared in the _Plugin_Helper.h stub of this test.
+
+#include "_Plugin_Helper.h"
+#include "NeoPixelBus.h"
+
+#include <ctype.h>
+#include <random>
+
+uint8_t *NeoHostBus::pixels     = nullptr;
+size_t   NeoHostBus::pixelsSize = 0;
+uint32_t NeoHostBus::shows      = 0;
+
+UserVarStruct UserVar;
+NodeTime node_time;
+bool printToWeb     = false;
+bool printToWebJSON = false;
+
+String parseString(const String& string, uint8_t index)
+{
+  const std::string str(string.c_str());
+  std::string res;
+  uint8_t     current = 1;
+
+  for (size_t i = 0; i < str.size(); ++i) {
+    const char c = str[i];
+
+    if ((c == ',') || (c == ' ')) {
+      ++current;
+      continue;
+    }
+
+    if (current == index) {
+      res += static_cast<char>(tolower(c));
+    }
+  }
+  return String(res.c_str());
+}
+
+int GetCommandCode(const char *needle, const char *haystack)
+{
+  const std::string list(haystack);
+  size_t start = 0;
+  int    index = 0;
+
+  while (start <= list.size()) {
+    size_t end = list.find('|', start);
+
+    if (end == std::string::npos) { end = list.size(); }
+
+    if (list.compare(start, end - start, needle) == 0) { return index; }
+    start = end + 1;
+    ++index;
+  }
+  return -1;
+}
+
+String formatToHex_no_prefix(unsigned long value, unsigned int minimal_hex_digits)
+{
+  char buf[20];
+
+  snprintf(buf, sizeof(buf), "%0*lx", minimal_hex_digits, value);
+  return buf;
+}
+
+namespace {
+std::mt19937 rnd(1);
+}
+
+long HwRandom(long howbig)
+{
+  return howbig <= 0 ? 0 : static_cast<long>(rnd() % howbig);
+}
+
+long HwRandom(long howsmall, long howbig)
+{
+  return howsmall >= howbig ? howsmall : howsmall + HwRandom(howbig - howsmall);
+}
@@ -0,0 +1,33 @@
+#ifndef HELPERS_KEYVALUEWRITER_JSON_H
+#define HELPERS_KEYVALUEWRITER_JSON_H
+
+// Host build replacement for src/src/Helpers/KeyValueWriter_JSON.h
+// The JSON status output is not checked, only the values are accepted.
+
+#include "../../ESPEasy_common.h"
+
+class PrintToString {
+public:
+
+  void          reserve(unsigned int size) { _str.reserve(size); }
+  const String& get() const                { return _str; }
+
+private:
+
+  String _str;
+};
+
+struct KeyValueStruct {
+  template<typename T>
+  KeyValueStruct(const __FlashStringHelper *, const T&) {}
+};
+
+class KeyValueWriter_JSON {
+public:
+
+  KeyValueWriter_JSON(bool, PrintToString *) {}
+
+  void write(const KeyValueStruct&) {}
+};
+
+#endif // ifndef HELPERS_KEYVALUEWRITER_JSON_H
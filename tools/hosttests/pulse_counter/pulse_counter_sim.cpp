@@ -0,0 +1,215 @@
+// Simulation of the P003 pulse counter (src/src/Helpers/_Internal_GPIO_pulseHelper.cpp), ESP32 build,
+// comparing the GPIO interrupt path with the PCNT hardware counter path for the edge modes.
+//
+// The signal is fed to the GPIO interrupt handler and to a model of the PCNT peripheral
+// (stubs/driver/pulse_cnt.h), while the helper is polled 50x per second like by PLUGIN_FIFTY_PER_SECOND.
+// Checked:
+// - Both paths count the same edges of a clean signal, incl. PCNT counter wrap at high rates,
+//   and report about the same pulse time.
+// - With a Debounce Time of 1 msec or more the PCNT cannot filter contact bounce,
+//   so the interrupt path must be used.
+// - Fallback to the interrupt path when no PCNT unit is available, and the unit is freed again.
+// Shown are the counts, the pulse time and the nr. of interrupts handled.
+
+#include "src/Helpers/_Internal_GPIO_pulseHelper.h"
+
+#include "driver/pulse_cnt.h"
+#include "GPIO_Direct_Access.h"
+
+#include <cstdio>
+#include <vector>
+
+namespace {
+int failures = 0;
+
+void check(bool ok, const char *scenario, const char *what) {
+  if (!ok) {
+    ++failures;
+    printf("  %s: %s FAILED\n", scenario, what);
+  }
+}
+
+void result(const char *scenario, int failuresBefore) {
+  printf("%-40s %s\n", scenario, failures == failuresBefore ? "OK" : "FAILED");
+}
+
+constexpr uint8_t GPIO = 4;
+
+struct Change {
+  uint64_t time_usec;
+  bool     level;
+};
+
+// Square wave, each rising edge (contact closing) followed by bounces of the given length.
+// Starts at a readout, so the last readout includes the last edges.
+std::vector<Change> square(double freqHz, double duration_sec, int bounces, uint32_t bounce_usec) {
+  std::vector<Change> res;
+  const double   period = 1e6 / freqHz;
+  const uint64_t start  = 0;
+
+  for (uint64_t i = 0; i < duration_sec * freqHz; ++i) {
+    for (int half = 0; half < 2; ++half) {
+      const uint64_t t     = start + static_cast<uint64_t>(i * period + half * period / 2);
+      const bool     level = half == 0;
+
+      res.push_back({ t, level });
+
+      for (int b = 0; level && b < bounces; ++b) {
+        res.push_back({ t + (2 * b + 1) * bounce_usec, !level });
+        res.push_back({ t + (2 * b + 2) * bounce_usec, level });
+      }
+    }
+  }
+  return res;
+}
+
+struct Result {
+  unsigned long counter   = 0;
+  unsigned long total     = 0;
+  float         pulseTime = 0.0f;
+  uint32_t      interrupts = 0;
+  bool          pcnt      = false;
+};
+
+bool triggers(int mode, bool level) {
+  return mode == CHANGE || (mode == RISING && level) || (mode == FALLING && !level);
+}
+
+Result run(Internal_GPIO_pulseHelper::GPIOtriggerMode mode,
+           uint16_t                                   debounce_msec,
+           bool                                       usePCNT,
+           const std::vector<Change>                & signal) {
+  Internal_GPIO_pulseHelper::pulseCounterConfig config;
+
+  config.gpio             = GPIO;
+  config.taskIndex        = 0;
+  config.interruptPinMode = mode;
+  config.usePCNT          = usePCNT;
+  config.setDebounceTime(debounce_msec);
+
+  // Signal starts 1 sec after boot
+  const uint64_t boot = 1000000;
+
+  HostClock::now_usec    = boot;
+  HostClock::tick_usec   = 0;
+  HostInterrupt::handler = nullptr;
+  hostPinLevel           = false;
+  HostPCNT::signal(GPIO, false);
+
+  Result   res;
+  uint64_t nextPoll = boot + 20000;
+  {
+    Internal_GPIO_pulseHelper helper(config);
+    helper.init();
+    res.pcnt = helper.usingPCNT();
+
+    auto pollUntil = [&](uint64_t time) {
+                       while (nextPoll <= time) {
+                         HostClock::now_usec = nextPoll;
+                         helper.doPulseStepProcessing(GPIO_PULSE_HELPER_PROCESSING_STEP_0);
+                         nextPoll += 20000;
+                       }
+                     };
+
+    for (const Change& change : signal) {
+      pollUntil(boot + change.time_usec);
+      HostClock::now_usec = boot + change.time_usec;
+      hostPinLevel        = change.level;
+      HostPCNT::signal(GPIO, change.level);
+
+      if ((HostInterrupt::handler != nullptr) && triggers(HostInterrupt::mode, change.level)) {
+        HostInterrupt::handler(HostInterrupt::arg);
+        ++res.interrupts;
+      }
+    }
+    pollUntil(boot + signal.back().time_usec);
+    HostClock::now_usec = nextPoll;
+    helper.getPulseCounters(res.counter, res.total, res.pulseTime);
+  }
+  return res;
+}
+
+void show(const char *path, const Result& res) {
+  printf("  %-10s count %7lu  pulse time %8.4f ms  interrupts %7u%s\n",
+         path, res.counter, res.pulseTime, res.interrupts, res.pcnt ? "" : "  (no PCNT)");
+}
+
+// The interrupt path is only run when the edges are at least 1 usec apart,
+// above that rate the ISR cannot keep up anyway.
+void clean_signal(const char *scenario, double freqHz, double duration_sec,
+                  Internal_GPIO_pulseHelper::GPIOtriggerMode mode, unsigned long expected) {
+  const int    before = failures;
+  const auto   signal = square(freqHz, duration_sec, 0, 0);
+  const bool   change = mode == Internal_GPIO_pulseHelper::GPIOtriggerMode::Change;
+  const float  expectedTime = 1000.0f / freqHz / (change ? 2 : 1);
+  const bool   runISR = expectedTime >= 0.001f;
+  const Result pcnt   = run(mode, 0, true, signal);
+  Result isr;
+
+  if (runISR) {
+    isr = run(mode, 0, false, signal);
+    check(isr.counter == expected, scenario, "interrupt count");
+    check(fabs(isr.pulseTime - expectedTime) <= 0.001f + 0.01f * expectedTime, scenario, "interrupt pulse time");
+  }
+  check(pcnt.pcnt, scenario, "PCNT used");
+  check(pcnt.counter == expected && pcnt.total == expected, scenario, "PCNT count");
+  check(pcnt.interrupts == 0, scenario, "no interrupts with PCNT");
+  check(fabs(pcnt.pulseTime - expectedTime) <= 0.001f + 0.01f * expectedTime, scenario, "PCNT pulse time");
+  result(scenario, before);
+
+  if (runISR) { show("interrupt", isr); }
+  show("PCNT", pcnt);
+}
+
+void bouncing_contact() {
+  const char *scenario = "Bouncing contact 10 Hz, debounce 5 ms";
+  const int   before   = failures;
+
+  // Each closing of the contact bounces 3 times with 200 usec
+  const auto signal = square(10, 2.0, 3, 200);
+  const Result isr        = run(Internal_GPIO_pulseHelper::GPIOtriggerMode::Rising, 5, false, signal);
+  const Result requested  = run(Internal_GPIO_pulseHelper::GPIOtriggerMode::Rising, 5, true, signal);
+  const Result pcntNoDeb  = run(Internal_GPIO_pulseHelper::GPIOtriggerMode::Rising, 0, true, signal);
+
+  check(isr.counter == 20, scenario, "interrupt count");
+  check(!requested.pcnt, scenario, "interrupt used instead of PCNT");
+  check(requested.counter == 20, scenario, "count with PCNT requested");
+  check(pcntNoDeb.counter > 20, scenario, "PCNT without debounce counts bounces");
+  result(scenario, before);
+  show("interrupt", isr);
+  show("requested", requested);
+  show("PCNT", pcntNoDeb);
+}
+
+void no_unit() {
+  const char *scenario = "No PCNT unit available";
+  const int   before   = failures;
+  const auto  signal   = square(100, 1.0, 0, 0);
+
+  HostPCNT::unitsFree = 0;
+  const Result res = run(Internal_GPIO_pulseHelper::GPIOtriggerMode::Falling, 0, true, signal);
+
+  HostPCNT::unitsFree = 4;
+  check(!res.pcnt, scenario, "interrupt used");
+  check(res.counter == 100, scenario, "count");
+
+  // Unit must be freed by the helper
+  run(Internal_GPIO_pulseHelper::GPIOtriggerMode::Falling, 0, true, signal);
+  check(HostPCNT::unitsFree == 4, scenario, "unit freed");
+  result(scenario, before);
+}
+} // namespace
+
+int main() {
+  clean_signal("Clean 1 kHz, rising edge", 1000, 2.0,
+               Internal_GPIO_pulseHelper::GPIOtriggerMode::Rising, 2000);
+  clean_signal("Clean 100 kHz, both edges", 100000, 1.0,
+               Internal_GPIO_pulseHelper::GPIOtriggerMode::Change, 200000);
+
+  // 30000 edges per poll, close to the PCNT high limit of 32767
+  clean_signal("Clean 750 kHz, both edges (wrap)", 750000, 0.2,
+               Internal_GPIO_pulseHelper::GPIOtriggerMode::Change, 300000);
+  bouncing_contact();
+  no_unit();
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,13 @@
+#ifndef GPIO_DIRECT_ACCESS_H
+#define GPIO_DIRECT_ACCESS_H
+
+// Host build replacement for lib/GPIO_Direct_Access
+
+#include "ESPEasy_common.h"
+
+// Pin level, set by the test
+extern bool hostPinLevel;
+
+inline bool DIRECT_pinRead(uint8_t) { return hostPinLevel; }
+
+#endif // ifndef GPIO_DIRECT_ACCESS_H
@@ -0,0 +1,64 @@
+#ifndef DRIVER_PULSE_CNT_H
+#define DRIVER_PULSE_CNT_H
+
+// Host build replacement for the ESP-IDF 5 PCNT driver: a model of the pulse counter,
+// fed with the signal by the test via HostPCNT::signal().
+// - Counts the edges with action PCNT_CHANNEL_EDGE_ACTION_INCREASE.
+// - Resets to 0 when reaching high_limit.
+// - Glitch filter: a level change which does not last max_glitch_ns is ignored.
+
+#include "ESPEasy_common.h"
+
+typedef int esp_err_t;
+#define ESP_OK    0
+#define ESP_FAIL  -1
+
+typedef enum {
+  PCNT_CHANNEL_EDGE_ACTION_HOLD,
+  PCNT_CHANNEL_EDGE_ACTION_INCREASE,
+  PCNT_CHANNEL_EDGE_ACTION_DECREASE,
+} pcnt_channel_edge_action_t;
+
+typedef struct {
+  int low_limit;
+  int high_limit;
+} pcnt_unit_config_t;
+
+typedef struct {
+  uint32_t max_glitch_ns;
+} pcnt_glitch_filter_config_t;
+
+typedef struct {
+  int edge_gpio_num;
+  int level_gpio_num;
+} pcnt_chan_config_t;
+
+struct pcnt_unit_t;
+struct pcnt_chan_t;
+typedef pcnt_unit_t *pcnt_unit_handle_t;
+typedef pcnt_chan_t *pcnt_channel_handle_t;
+
+esp_err_t pcnt_new_unit(const pcnt_unit_config_t *config, pcnt_unit_handle_t *ret_unit);
+esp_err_t pcnt_del_unit(pcnt_unit_handle_t unit);
+esp_err_t pcnt_unit_set_glitch_filter(pcnt_unit_handle_t unit, const pcnt_glitch_filter_config_t *config);
+esp_err_t pcnt_new_channel(pcnt_unit_handle_t unit, const pcnt_chan_config_t *config, pcnt_channel_handle_t *ret_chan);
+esp_err_t pcnt_del_channel(pcnt_channel_handle_t chan);
+esp_err_t pcnt_channel_set_edge_action(pcnt_channel_handle_t chan,
+                                       pcnt_channel_edge_action_t pos_act,
+                                       pcnt_channel_edge_action_t neg_act);
+esp_err_t pcnt_unit_enable(pcnt_unit_handle_t unit);
+esp_err_t pcnt_unit_disable(pcnt_unit_handle_t unit);
+esp_err_t pcnt_unit_start(pcnt_unit_handle_t unit);
+esp_err_t pcnt_unit_stop(pcnt_unit_handle_t unit);
+esp_err_t pcnt_unit_clear_count(pcnt_unit_handle_t unit);
+esp_err_t pcnt_unit_get_count(pcnt_unit_handle_t unit, int *value);
+
+struct HostPCNT {
+  // Nr. of units which can still be allocated
+  static int unitsFree;
+
+  // Level change of a GPIO pin at the current HostClock time
+  static void signal(int gpio, bool level);
+};
+
+#endif // ifndef DRIVER_PULSE_CNT_H
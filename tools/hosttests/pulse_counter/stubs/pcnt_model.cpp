@@ -0,0 +1,143 @@
+#include "driver/pulse_cnt.h"
+
+#include <algorithm>
+#include <vector>
+
+struct pcnt_chan_t {
+  pcnt_unit_t               *unit;
+  int                        gpio;
+  pcnt_channel_edge_action_t pos = PCNT_CHANNEL_EDGE_ACTION_HOLD;
+  pcnt_channel_edge_action_t neg = PCNT_CHANNEL_EDGE_ACTION_HOLD;
+};
+
+struct pcnt_unit_t {
+  int          highLimit;
+  uint32_t     glitchNs = 0;
+  bool         running  = false;
+  int          count    = 0;
+  pcnt_chan_t *chan     = nullptr;
+
+  // Filtered level and a level change which may still be a glitch
+  bool         level        = false;
+  bool         pending      = false;
+  uint64_t     pendingSince = 0;
+
+  void apply(bool newLevel) {
+    level = newLevel;
+
+    if (!running || (chan == nullptr)) { return; }
+
+    if ((newLevel ? chan->pos : chan->neg) == PCNT_CHANNEL_EDGE_ACTION_INCREASE) {
+      if (++count >= highLimit) { count = 0; }
+    }
+  }
+
+  // Accept the pending level change when it lasted longer than the filter
+  void settle() {
+    if (pending && ((HostClock::now_usec - pendingSince) * 1000 >= glitchNs)) {
+      pending = false;
+      apply(!level);
+    }
+  }
+};
+
+int HostPCNT::unitsFree = 4;
+
+namespace {
+std::vector<pcnt_unit_t *> units;
+}
+
+void HostPCNT::signal(int gpio, bool newLevel)
+{
+  for (pcnt_unit_t *unit : units) {
+    if ((unit->chan == nullptr) || (unit->chan->gpio != gpio)) { continue; }
+    unit->settle();
+
+    if (unit->pending) {
+      // Back to the filtered level within the glitch time
+      unit->pending = false;
+    } else if (newLevel != unit->level) {
+      unit->pending      = true;
+      unit->pendingSince = HostClock::now_usec;
+      unit->settle();
+    }
+  }
+}
+
+esp_err_t pcnt_new_unit(const pcnt_unit_config_t *config, pcnt_unit_handle_t *ret_unit)
+{
+  if (HostPCNT::unitsFree == 0) { return ESP_FAIL; }
+  --HostPCNT::unitsFree;
+  *ret_unit              = new pcnt_unit_t();
+  (*ret_unit)->highLimit = config->high_limit;
+  units.push_back(*ret_unit);
+  return ESP_OK;
+}
+
+esp_err_t pcnt_del_unit(pcnt_unit_handle_t unit)
+{
+  units.erase(std::find(units.begin(), units.end(), unit));
+  delete unit;
+  ++HostPCNT::unitsFree;
+  return ESP_OK;
+}
+
+esp_err_t pcnt_unit_set_glitch_filter(pcnt_unit_handle_t unit, const pcnt_glitch_filter_config_t *config)
+{
+  // 1023 APB clock cycles
+  if (config->max_glitch_ns > 12787) { return ESP_FAIL; }
+  unit->glitchNs = config->max_glitch_ns;
+  return ESP_OK;
+}
+
+esp_err_t pcnt_new_channel(pcnt_unit_handle_t unit, const pcnt_chan_config_t *config, pcnt_channel_handle_t *ret_chan)
+{
+  *ret_chan   = new pcnt_chan_t{ unit, config->edge_gpio_num };
+  unit->chan  = *ret_chan;
+  return ESP_OK;
+}
+
+esp_err_t pcnt_del_channel(pcnt_channel_handle_t chan)
+{
+  chan->unit->chan = nullptr;
+  delete chan;
+  return ESP_OK;
+}
+
+esp_err_t pcnt_channel_set_edge_action(pcnt_channel_handle_t chan,
+                                       pcnt_channel_edge_action_t pos_act,
+                                       pcnt_channel_edge_action_t neg_act)
+{
+  chan->pos = pos_act;
+  chan->neg = neg_act;
+  return ESP_OK;
+}
+
+esp_err_t pcnt_unit_enable(pcnt_unit_handle_t) { return ESP_OK; }
+
+esp_err_t pcnt_unit_disable(pcnt_unit_handle_t) { return ESP_OK; }
+
+esp_err_t pcnt_unit_start(pcnt_unit_handle_t unit)
+{
+  unit->running = true;
+  return ESP_OK;
+}
+
+esp_err_t pcnt_unit_stop(pcnt_unit_handle_t unit)
+{
+  unit->running = false;
+  return ESP_OK;
+}
+
+esp_err_t pcnt_unit_clear_count(pcnt_unit_handle_t unit)
+{
+  unit->count = 0;
+  return ESP_OK;
+}
+
+esp_err_t pcnt_unit_get_count(pcnt_unit_handle_t unit, int *value)
+{
+  unit->settle();
+  *value = unit->count;
+  return ESP_OK;
+}
@@ -0,0 +1,7 @@
+#include "GPIO_Direct_Access.h"
+#include "src/Globals/ESPEasy_Scheduler.h"
+
+bool hostPinLevel = false;
+ESPEasy_Scheduler Scheduler;
+
+const taskIndex_t INVALID_TASK_INDEX = 255;
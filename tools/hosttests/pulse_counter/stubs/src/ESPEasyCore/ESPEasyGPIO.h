@@ -0,0 +1,12 @@
+#ifndef ESPEASYCORE_ESPEASYGPIO_H
+#define ESPEASYCORE_ESPEASYGPIO_H
+
+// Host build replacement for src/src/ESPEasyCore/ESPEasyGPIO.h
+
+#include "../../ESPEasy_common.h"
+
+#define PLUGIN_GPIO 1
+
+inline bool checkValidPortRange(int, int port) { return port >= 0 && port < 40; }
+
+#endif // ifndef ESPEASYCORE_ESPEASYGPIO_H
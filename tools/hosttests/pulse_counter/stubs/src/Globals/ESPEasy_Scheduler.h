@@ -0,0 +1,17 @@
+#ifndef GLOBALS_ESPEASY_SCHEDULER_H
+#define GLOBALS_ESPEASY_SCHEDULER_H
+
+// Host build replacement for src/src/Globals/ESPEasy_Scheduler.h
+// Only the edge modes are simulated, which do not use the task timer.
+
+#include "../../ESPEasy_common.h"
+
+#include "../DataTypes/TaskIndex.h"
+
+struct ESPEasy_Scheduler {
+  void setPluginTaskTimer(unsigned long, taskIndex_t, int) {}
+};
+
+extern ESPEasy_Scheduler Scheduler;
+
+#endif // ifndef GLOBALS_ESPEASY_SCHEDULER_H
@@ -0,0 +1,14 @@
+#ifndef WEBSERVER_MARKUP_FORMS_H
+#define WEBSERVER_MARKUP_FORMS_H
+
+// Host build replacement for src/src/WebServer/Markup_Forms.h
+
+#include "../../ESPEasy_common.h"
+
+struct FormSelectorOptions {
+  FormSelectorOptions(int, const __FlashStringHelper **, const int *) {}
+
+  void addFormSelector(const __FlashStringHelper *, const __FlashStringHelper *, int) const {}
+};
+
+#endif // ifndef WEBSERVER_MARKUP_FORMS_H
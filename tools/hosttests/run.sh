@@ -0,0 +1,194 @@
+#!/bin/bash
+#
+# Build and run host-side tests of ESPEasy source files, without the ESP toolchain.
+#
+# Usage: run.sh [test ...]
+#   Without arguments all tests are run.
+#
+# Each test has its own directory <test>/ with the test program.
+# The sources under test are copied from src/ into a temporary directory
+# next to the stub headers replacing the Arduino/ESPEasy dependencies:
+# first the common stubs/, then <test>/stubs/ (if present).
+#
+
+set -e
+
+HERE="$(cd "$(dirname "$0")" && pwd)"
+SRC="$HERE/../../src"
+LIB="$HERE/../../lib"
+CXX="${CXX:-g++}"
+CXXFLAGS="${CXXFLAGS:--std=c++17 -O2 -Wall}"
+
+BUILD_ROOT="$(mktemp -d)"
+trap 'rm -rf "$BUILD_ROOT"' EXIT
+
+# copy_src <path relative to src/> ...
+copy_src() {
+  for f in "$@"; do
+    mkdir -p "$BUILD/$(dirname "$f")"
+    cp "$SRC/$f" "$BUILD/$f"
+  done
+}
+
+# copy_lib <library> <file> ...
+# Library files are copied to the top of the build directory, like the library include paths.
+copy_lib() {
+  local lib="$1"
+  shift
+  for f in "$@"; do
+    cp "$LIB/$lib/$f" "$BUILD/$f"
+  done
+}
+
+# compile <test> <extra flags and sources relative to $BUILD> ...
+# The test program <test>/*.cpp and all stub sources are added.
+compile() {
+  local name="$1"
+  shift
+  local args=()
+  for a in "$@"; do
+    case "$a" in
+      -*) args+=("$a") ;;
+      *)  args+=("$BUILD/$a") ;;
+    esac
+  done
+  "$CXX" $CXXFLAGS -I"$BUILD" -I"$BUILD/src" -o "$BUILD/$name" \
+    "$HERE/$name"/*.cpp "$BUILD"/*.cpp "${args[@]}"
+}
+
+build_clock_discipline() {
+  copy_src src/DataStructs/ClockDiscipline.h src/DataStructs/ClockDiscipline.cpp
+  compile "$1" src/DataStructs/ClockDiscipline.cpp
+}
+
+build_time_zone() {
+  copy_src src/Helpers/ESPEasy_time_zone.h src/Helpers/ESPEasy_time_zone.cpp \
+    src/DataStructs/TimeChangeRule.h src/DataStructs/TimeChangeRule.cpp
+  compile "$1" -DBUILD_NO_DEBUG \
+    src/Helpers/ESPEasy_time_zone.cpp src/DataStructs/TimeChangeRule.cpp
+}
+
+build_dallas() {
+  copy_src src/Helpers/Dallas1WireHelper.h src/Helpers/Dallas1WireHelper.cpp \
+    src/PluginStructs/P004_data_struct.h src/PluginStructs/P004_data_struct.cpp \
+    src/DataTypes/PluginID.h src/DataTypes/TaskIndex.h src/Helpers/ESPEasy_time_calc.h
+  compile "$1" -DBUILD_NO_DEBUG -DFEATURE_DALLAS_HELPER=1 -DUSES_P004 \
+    src/Helpers/Dallas1WireHelper.cpp src/PluginStructs/P004_data_struct.cpp
+}
+
+build_i2c_bus() {
+  copy_src src/Helpers/Hardware_I2C.h src/Helpers/Hardware_I2C.cpp \
+    src/Helpers/I2C_BusScheduler.h src/Helpers/I2C_BusScheduler.cpp \
+    src/Helpers/msecTimerHandlerStruct.h src/Helpers/msecTimerHandlerStruct.cpp \
+    src/DataStructs/timer_id_couple.h src/DataStructs/timer_id_couple.cpp \
+    src/DataTypes/TaskIndex.h src/Helpers/ESPEasy_time_calc.h
+  compile "$1" -DFEATURE_I2C_BUS_SCHEDULER=1 -DFEATURE_I2CMULTIPLEXER=1 -DFEATURE_I2C_MULTIPLE=1 \
+    src/Helpers/Hardware_I2C.cpp src/Helpers/I2C_BusScheduler.cpp \
+    src/Helpers/msecTimerHandlerStruct.cpp src/DataStructs/timer_id_couple.cpp
+}
+
+build_serial_frame_reader() {
+  copy_src src/Helpers/SerialFrameReader.h src/Helpers/SerialFrameReader.cpp \
+    src/Helpers/ESPEasy_time_calc.h
+  compile "$1" -DFEATURE_SERIAL_FRAME_READER=1 src/Helpers/SerialFrameReader.cpp
+}
+
+build_oled() {
+  copy_lib esp8266-oled-ssd1306 OLEDDisplay.h OLEDDisplay.cpp OLEDDisplayFonts.h OLEDDisplayFonts.cpp \
+    SSD1306Wire.h SSD1306Wire.cpp SH1106Wire.h SH1106Wire.cpp
+  # The library sources are compiled as part of $BUILD/*.cpp
+  compile "$1" -Wno-narrowing
+}
+
+build_p128() {
+  copy_src src/PluginStructs/P128_data_struct.h src/PluginStructs/P128_data_struct.cpp
+  copy_lib NeoPixelBus src/NeoPixelBrightnessBus.h
+  mkdir -p "$BUILD/src/internal"
+  for f in NeoHueBlend.h NeoSettings.h NeoColorFeatures.h NeoBusChannel.h RgbColorBase.h RgbColorBase.cpp \
+    RgbColor.h RgbColor.cpp Rgb16Color.h Rgb48Color.h Rgb48Color.cpp RgbwColor.h RgbwColor.cpp \
+    HslColor.h HslColor.cpp HsbColor.h HsbColor.cpp HtmlColor.h HtmlColor.cpp; do
+    copy_lib NeoPixelBus "src/internal/$f"
+  done
+  compile "$1" -DUSES_P128 src/PluginStructs/P128_data_struct.cpp \
+    src/internal/RgbColorBase.cpp src/internal/RgbColor.cpp src/internal/Rgb48Color.cpp \
+    src/internal/RgbwColor.cpp src/internal/HslColor.cpp src/internal/HsbColor.cpp src/internal/HtmlColor.cpp
+}
+
+build_timing_stats() {
+  copy_src src/DataStructs/TimingStats.h src/DataStructs/TimingStats.cpp \
+    src/DataTypes/ESPEasy_plugin_functions.h src/DataTypes/DeviceIndex.h src/DataTypes/ProtocolIndex.h \
+    src/DataTypes/TaskIndex.h src/DataTypes/CPluginID.h src/Helpers/ESPEasy_time_calc.h \
+    ESPEasy/net/DataTypes/NetworkDriverIndex.h ESPEasy/net/DataTypes/NetworkDriverIndex.cpp
+  compile "$1" -DFEATURE_TIMING_STATS=1 -DFEATURE_TIMING_STATS_HISTOGRAM=1 \
+    src/DataStructs/TimingStats.cpp ESPEasy/net/DataTypes/NetworkDriverIndex.cpp
+}
+
+build_sd_value_logger() {
+  copy_src src/Helpers/SD_ValueLogger.h src/Helpers/SD_ValueLogger.cpp \
+    src/DataStructs/TimingStats.h src/DataTypes/TaskIndex.h src/Helpers/ESPEasy_time_calc.h
+  compile "$1" -DESP32 -DFEATURE_SD=1 -DFEATURE_TIMING_STATS=0 -DFEATURE_EXTENDED_TASK_VALUE_TYPES=1 \
+    -DSD_VALUELOGGER_BUFFER_SIZE=512 -DSD_VALUELOGGER_MAX_FILE_SIZE=8192 \
+    src/Helpers/SD_ValueLogger.cpp
+}
+
+build_adc_reduce() {
+  copy_src src/Helpers/ADC_reduce.h src/Helpers/ADC_reduce.cpp
+  compile "$1" src/Helpers/ADC_reduce.cpp
+}
+
+build_pulse_counter() {
+  copy_src src/Helpers/_Internal_GPIO_pulseHelper.h src/Helpers/_Internal_GPIO_pulseHelper.cpp \
+    src/DataTypes/TaskIndex.h src/Helpers/ESPEasy_time_calc.h
+  compile "$1" -DESP32 -DESP_IDF_VERSION_MAJOR=5 -DFEATURE_PULSE_PCNT=1 \
+    src/Helpers/_Internal_GPIO_pulseHelper.cpp
+}
+
+build_log_record() {
+  copy_src src/DataStructs/LogRecord.h src/DataStructs/LogRecord.cpp \
+    src/DataStructs/LogEntry.h src/DataStructs/LogEntry.cpp \
+    src/DataStructs/LogBuffer.h src/DataStructs/LogBuffer.cpp \
+    src/DataTypes/LogLevels.h src/Helpers/ESPEasy_time_calc.h
+  compile "$1" \
+    src/DataStructs/LogRecord.cpp src/DataStructs/LogEntry.cpp src/DataStructs/LogBuffer.cpp
+}
+
+build_syslog_tcp() {
+  copy_src src/Helpers/SyslogWriter.h src/Helpers/SyslogWriter.cpp \
+    src/Helpers/SyslogTCPClient.h src/Helpers/SyslogTCPClient.cpp \
+    src/Helpers/LogStreamWriter.h src/Helpers/LogStreamWriter.cpp \
+    src/DataTypes/LogLevels.h src/Helpers/ESPEasy_time_calc.h
+
+  # LogDestination is included via ESPEasy_common.h in the ESP build
+  compile "$1" -DESP32 -DFEATURE_SYSLOG=1 -DSYSLOG_RATE_LIMIT_BYTES_PER_SEC=0 \
+    -include src/DataTypes/LogLevels.h \
+    src/Helpers/SyslogWriter.cpp src/Helpers/SyslogTCPClient.cpp src/Helpers/LogStreamWriter.cpp
+}
+
+ALL_TESTS=(clock_discipline time_zone dallas i2c_bus serial_frame_reader oled p128 timing_stats sd_value_logger
+  adc_reduce pulse_counter log_record syslog_tcp)
+
+TESTS=("$@")
+if [ ${#TESTS[@]} -eq 0 ]; then
+  TESTS=("${ALL_TESTS[@]}")
+fi
+
+result=0
+for t in "${TESTS[@]}"; do
+  echo "=== $t"
+  BUILD="$BUILD_ROOT/$t"
+  mkdir -p "$BUILD"
+  cp -r "$HERE/stubs/." "$BUILD/"
+  if [ -d "$HERE/$t/stubs" ]; then
+    cp -r "$HERE/$t/stubs/." "$BUILD/"
+  fi
+  if ! "build_$t" "$t"; then
+    echo "$t: build failed"
+    result=1
+    continue
+  fi
+  if ! "$BUILD/$t"; then
+    echo "$t: FAILED"
+    result=1
+  fi
+done
+exit $result
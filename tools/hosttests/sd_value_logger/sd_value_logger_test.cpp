@@ -0,0 +1,297 @@
+// Check of the SD card value logger (src/src/Helpers/SD_ValueLogger.cpp), ESP32 build.
+//
+// The SD card is replaced by an in-memory file system (stubs/SD.h).
+// Checked:
+// - CSV lines are buffered and written in blocks, or when the oldest line is too old.
+// - Binary records: file header, task definition before the first values in each file
+//   and when it changed, values of all types and string values.
+// - Rotation when the date changes, named after the start time of the file.
+// - Rotation by size when the system time is not set: the file must not grow
+//   without limit and no data may be lost.
+// - A file of the same start time is not overwritten, a failed rename is logged.
+// Shown are the SD writes per logged line.
+
+#include "src/Helpers/SD_ValueLogger.h"
+
+#include "SD.h"
+#include "_Plugin_Helper.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+int failures = 0;
+
+void check(bool ok, const char *scenario, const char *what) {
+  if (!ok) {
+    ++failures;
+    printf("  %s: %s FAILED\n", scenario, what);
+  }
+}
+
+void result(const char *scenario, int failuresBefore) {
+  printf("%-40s %s\n", scenario, failures == failuresBefore ? "OK" : "FAILED");
+}
+
+void reset() {
+  SD_ValueLogger_close();
+  SD.files.clear();
+  SD.writes      = 0;
+  SD.failRename  = false;
+  lastErrorLog   = String();
+  node_time      = NodeTime();
+}
+
+void setTime(int year, int month, int day, int hour, int minute, int second, uint32_t unixTime) {
+  node_time.timeSet  = true;
+  node_time.tm_year  = year;
+  node_time.tm_mon   = month;
+  node_time.tm_mday  = day;
+  node_time.tm_hour  = hour;
+  node_time.tm_min   = minute;
+  node_time.tm_sec   = second;
+  node_time.unixTime = unixTime;
+  node_time.frac     = 0x80000000; // 500 msec
+}
+
+std::string file(const char *name) {
+  auto it = SD.files.find(name);
+
+  return it == SD.files.end() ? std::string() : it->second;
+}
+
+std::string csvLine(int nr) {
+  char buf[64];
+
+  snprintf(buf, sizeof(buf), "2026-10-19 12:00:%02d,1,bme,Temperature,%d.50\n", nr % 60, nr);
+  return buf;
+}
+
+struct Record {
+  char        type;
+  std::string payload;
+};
+
+// Records of a binary file, false when the file is not valid
+bool parse(const std::string& data, std::vector<Record>& records) {
+  records.clear();
+
+  if ((data.size() < 8) || (data.compare(0, 6, "ESPVL\x01") != 0)) { return false; }
+  size_t pos = 8;
+
+  while (pos < data.size()) {
+    if (pos + 3 > data.size()) { return false; }
+    uint16_t length;
+
+    memcpy(&length, &data[pos + 1], sizeof(length));
+
+    if (pos + 3 + length > data.size()) { return false; }
+    records.push_back({ data[pos], data.substr(pos + 3, length) });
+    pos += 3 + length;
+  }
+  return true;
+}
+
+std::string types(const std::vector<Record>& records) {
+  std::string res;
+
+  for (const Record& r : records) { res += r.type; }
+  return res;
+}
+
+template<typename T>
+T field(const std::string& payload, size_t pos) {
+  T res{};
+
+  if (pos + sizeof(T) <= payload.size()) { memcpy(&res, &payload[pos], sizeof(T)); }
+  return res;
+}
+
+template<typename T>
+void setValue(taskIndex_t task, uint8_t varNr, T value) {
+  memcpy(&hostTasks[task].values[varNr], &value, sizeof(value));
+}
+
+void setupTasks() {
+  HostTask& bme = hostTasks[0];
+
+  bme.sensorType    = Sensor_VType::SENSOR_TYPE_DUAL;
+  bme.valueCount    = 2;
+  bme.name          = "bme";
+  bme.valueNames[0] = "Temperature";
+  bme.valueNames[1] = "Humidity";
+  bme.decimals[0]   = 2;
+  bme.decimals[1]   = 1;
+  setValue<float>(0, 0, 21.25f);
+  setValue<float>(0, 1, 55.5f);
+
+  HostTask& counter = hostTasks[1];
+
+  counter.sensorType    = Sensor_VType::SENSOR_TYPE_INT64_SINGLE;
+  counter.valueCount    = 1;
+  counter.name          = "counter";
+  counter.valueNames[0] = "Count";
+  setValue<int64_t>(1, 0, -(1ll << 40));
+  Settings.Unit = 7;
+}
+
+void csv_buffering() {
+  const char *scenario = "CSV lines buffered";
+  const int   before   = failures;
+  std::string expected;
+
+  reset();
+
+  for (int i = 0; i < 100; ++i) {
+    const std::string line = csvLine(i);
+    SD_ValueLogger_add(line.c_str());
+    expected += line;
+  }
+  const std::string& written = file("/VALUES.CSV");
+
+  check(written.size() + SD_ValueLogger_bufferedBytes() == expected.size(), scenario, "written + buffered");
+  check(expected.compare(0, written.size(), written) == 0, scenario, "data written");
+  const uint32_t writes = SD.writes;
+
+  // Flushed by the loop when the oldest line is too old
+  HostClock::advance_usec((SD_VALUELOGGER_FLUSH_INTERVAL - 10) * 1000ull);
+  SD_ValueLogger_loop();
+  check(SD_ValueLogger_bufferedBytes() != 0, scenario, "kept before flush interval");
+  HostClock::advance_usec(10 * 1000ull);
+  SD_ValueLogger_loop();
+  check(SD_ValueLogger_bufferedBytes() == 0, scenario, "flushed after interval");
+  check(file("/VALUES.CSV") == expected, scenario, "all data written");
+  result(scenario, before);
+  printf("  SD writes: %u for 100 lines (%u bytes)\n", writes, static_cast<unsigned>(expected.size()));
+}
+
+void binary_records() {
+  const char *scenario = "Binary records";
+  const int   before   = failures;
+  std::vector<Record> records;
+
+  reset();
+  setupTasks();
+  setTime(2026, 10, 19, 23, 59, 50, 1792454390);
+
+  for (int i = 0; i < 3; ++i) {
+    SD_ValueLogger_addValues(0);
+  }
+  SD_ValueLogger_addStringValue(0, "dew", "11.5");
+  SD_ValueLogger_addValues(1);
+  SD_ValueLogger_flush();
+
+  check(parse(file("/VALUES.BIN"), records), scenario, "file format");
+  check(types(records) == "DVVVSDV", scenario, "record types");
+
+  if (types(records) == "DVVVSDV") {
+    const std::string& def = records[0].payload;
+
+    check(def.compare(0, 3, std::string("\x01\x07\x02", 3)) == 0, scenario, "definition task, unit, count");
+    check(def.compare(3, 4, "\x03" "bme") == 0, scenario, "definition task name");
+    check(def.compare(7, 14, "f\x02\x0bTemperature") == 0, scenario, "definition value");
+
+    const std::string& values = records[1].payload;
+    check(field<uint8_t>(values, 0) == 1, scenario, "values task nr");
+    check(field<uint32_t>(values, 1) == 1792454390, scenario, "values time");
+    check(field<uint16_t>(values, 5) == 500, scenario, "values msec");
+    check(field<float>(values, 7) == 21.25f, scenario, "value 1");
+    check(field<float>(values, 11) == 55.5f, scenario, "value 2");
+    check(values.size() == 15, scenario, "values size");
+
+    check(records[4].payload.compare(7, 10, std::string("\x03" "dew\x04\x00" "11.5", 10)) == 0, scenario, "string value");
+    check(field<int64_t>(records[6].payload, 7) == -(1ll << 40), scenario, "int64 value");
+  }
+
+  // Changed task definition must be written again
+  hostTasks[0].name = "bme280";
+  SD_ValueLogger_addValues(0);
+  SD_ValueLogger_addValues(0);
+  SD_ValueLogger_flush();
+  check(parse(file("/VALUES.BIN"), records) && types(records) == "DVVVSDVDVV", scenario, "changed definition");
+
+  // Date change: file is renamed after its start time, the new file starts with the definitions
+  node_time.tm_mday  = 20;
+  node_time.tm_hour  = 0;
+  node_time.unixTime += 20;
+  SD_ValueLogger_loop();
+  SD_ValueLogger_addValues(0);
+  SD_ValueLogger_flush();
+  check(parse(file("/VALUES_20261019_235950.BIN"), records) && records.size() == 10, scenario, "rotated on date change");
+  check(parse(file("/VALUES.BIN"), records) && types(records) == "DV", scenario, "new file with definition");
+  result(scenario, before);
+}
+
+// All data of the rotated VALUES_N<nr> files and the current file, in the order written
+std::string allCsvFiles(int& rotated) {
+  std::string res;
+
+  for (rotated = 0; SD.exists(String("/VALUES_N") + String(rotated + 1) + ".CSV"); ++rotated) {
+    res += file(("/VALUES_N" + std::to_string(rotated + 1) + ".CSV").c_str());
+  }
+  return res + file("/VALUES.CSV");
+}
+
+void size_rotation_no_time() {
+  const char *scenario = "Size rotation without system time";
+  const int   before   = failures;
+  std::string expected;
+  size_t maxSize = 0;
+
+  reset();
+
+  for (int i = 0; i < 2000; ++i) {
+    const std::string line = csvLine(i);
+    SD_ValueLogger_add(line.c_str());
+    SD_ValueLogger_loop();
+    expected += line;
+    maxSize   = std::max(maxSize, file("/VALUES.CSV").size());
+  }
+  SD_ValueLogger_close();
+
+  int rotated = 0;
+
+  check(allCsvFiles(rotated) == expected, scenario, "no data lost");
+  check(rotated + 1 >= static_cast<int>(expected.size() / (SD_VALUELOGGER_MAX_FILE_SIZE + SD_VALUELOGGER_BUFFER_SIZE + 64)),
+        scenario, "rotated files");
+  check(maxSize < SD_VALUELOGGER_MAX_FILE_SIZE + SD_VALUELOGGER_BUFFER_SIZE + 64, scenario, "max. file size");
+  result(scenario, before);
+  printf("  %u bytes in %d rotated files, max. size of VALUES.CSV %u\n",
+         static_cast<unsigned>(expected.size()), rotated, static_cast<unsigned>(maxSize));
+}
+
+void rename_conflict() {
+  const char *scenario = "Same start time, rename failure";
+  const int   before   = failures;
+  const std::string block(SD_VALUELOGGER_MAX_FILE_SIZE, 'x');
+
+  reset();
+  setTime(2026, 10, 19, 12, 0, 0, 1792411200);
+
+  // 2 files started in the same second
+  SD_ValueLogger_add(block.c_str());
+  SD_ValueLogger_add(block.c_str());
+  check(file("/VALUES_20261019_120000.CSV").size() == block.size(), scenario, "first file");
+  size_t rotated = 0;
+
+  for (const auto& f : SD.files) {
+    if ((f.first.compare(0, 9, "/VALUES_N") == 0) && (f.second.size() == block.size())) { ++rotated; }
+  }
+  check(rotated == 1, scenario, "second file not overwritten");
+  check(lastErrorLog.isEmpty(), scenario, "no error");
+
+  SD.failRename = true;
+  SD_ValueLogger_add(block.c_str());
+  check(lastErrorLog.startsWith("SD   : Could not rename /VALUES.CSV"), scenario, "error logged");
+  result(scenario, before);
+}
+} // namespace
+
+int main() {
+  csv_buffering();
+  binary_records();
+  size_rotation_no_time();
+  rename_conflict();
+  return failures == 0 ? 0 : 1;
+}
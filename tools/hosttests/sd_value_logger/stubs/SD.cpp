@@ -0,0 +1,33 @@
+#include "SD.h"
+
+fs::FS SD;
+
+namespace fs {
+size_t File::write(const uint8_t *buf, size_t size)
+{
+  if (_fs == nullptr) { return 0; }
+  ++_fs->writes;
+  _fs->files[_path.str()].append(reinterpret_cast<const char *>(buf), size);
+  return size;
+}
+
+size_t File::size() const
+{
+  if (_fs == nullptr) { return 0; }
+  return _fs->files[_path.str()].size();
+}
+
+File FS::open(const String& path, const char *)
+{
+  files[path.str()];
+  return File(this, path);
+}
+
+bool FS::rename(const String& pathFrom, const String& pathTo)
+{
+  if (failRename || !exists(pathFrom) || exists(pathTo)) { return false; }
+  files[pathTo.str()] = std::move(files[pathFrom.str()]);
+  files.erase(pathFrom.str());
+  return true;
+}
+} // namespace fs
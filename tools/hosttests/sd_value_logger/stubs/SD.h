@@ -0,0 +1,53 @@
+#ifndef SD_H
+#define SD_H
+
+// Host build replacement for the SD library: an in-memory file system.
+
+#include "ESPEasy_common.h"
+
+#include <map>
+#include <string>
+
+namespace fs {
+class FS;
+
+class File {
+public:
+
+  File() = default;
+  File(FS *fs, const String& path) : _fs(fs), _path(path) {}
+
+  explicit operator bool() const { return _fs != nullptr; }
+
+  size_t write(const uint8_t *buf, size_t size);
+  size_t size() const;
+  void   flush() {}
+  void   close() { _fs = nullptr; }
+
+private:
+
+  FS    *_fs = nullptr;
+  String _path;
+};
+
+class FS {
+public:
+
+  // Only append mode ("a+") is supported
+  File open(const String& path, const char *mode);
+  bool exists(const String& path) const { return files.count(path.str()) != 0; }
+  bool rename(const String& pathFrom, const String& pathTo);
+
+  std::map<std::string, std::string> files;
+
+  // Nr. of write() calls
+  uint32_t writes = 0;
+
+  // Let rename() fail, e.g. card removed
+  bool failRename = false;
+};
+} // namespace fs
+
+extern fs::FS SD;
+
+#endif // ifndef SD_H
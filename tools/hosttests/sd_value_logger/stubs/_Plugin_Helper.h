@@ -0,0 +1,145 @@
+#ifndef PLUGIN_HELPER_H
+#define PLUGIN_HELPER_H
+
+// Host build replacement for src/_Plugin_Helper.h
+// Only what SD_ValueLogger.cpp needs: tasks with their values and the system time,
+// set by the test.
+
+#include "ESPEasy_common.h"
+
+#include "src/DataTypes/TaskIndex.h"
+#include "src/ESPEasyCore/ESPEasy_Log.h"
+
+#include <string>
+
+#define TASKS_MAX     32
+#define VARS_PER_TASK 4
+
+// Subset of src/src/DataTypes/SensorVType.h
+enum class Sensor_VType : uint8_t {
+  SENSOR_TYPE_NONE        = 0,
+  SENSOR_TYPE_SINGLE      = 1,
+  SENSOR_TYPE_DUAL        = 5,
+  SENSOR_TYPE_ULONG       = 20,
+  SENSOR_TYPE_UINT32_DUAL = 31,
+  SENSOR_TYPE_INT32_DUAL  = 41,
+  SENSOR_TYPE_UINT64_SINGLE = 50,
+  SENSOR_TYPE_INT64_SINGLE  = 60,
+};
+
+inline bool isUInt32OutputDataType(Sensor_VType t) { return t == Sensor_VType::SENSOR_TYPE_UINT32_DUAL; }
+inline bool isInt32OutputDataType(Sensor_VType t)  { return t == Sensor_VType::SENSOR_TYPE_INT32_DUAL; }
+inline bool isUInt64OutputDataType(Sensor_VType t) { return t == Sensor_VType::SENSOR_TYPE_UINT64_SINGLE; }
+inline bool isInt64OutputDataType(Sensor_VType t)  { return t == Sensor_VType::SENSOR_TYPE_INT64_SINGLE; }
+inline bool isFloatOutputDataType(Sensor_VType t)  {
+  return t == Sensor_VType::SENSOR_TYPE_SINGLE || t == Sensor_VType::SENSOR_TYPE_DUAL;
+}
+
+// Task configuration and values, set by the test
+struct HostTask {
+  Sensor_VType sensorType = Sensor_VType::SENSOR_TYPE_NONE;
+  uint8_t      valueCount = 0;
+  String       name;
+  String       valueNames[VARS_PER_TASK];
+  uint8_t      decimals[VARS_PER_TASK]{};
+  uint64_t     values[VARS_PER_TASK]{}; // Raw bits of the value
+};
+
+extern HostTask hostTasks[TASKS_MAX];
+
+#define validTaskIndex(X) ((X) < (TASKS_MAX))
+
+struct EventStruct {
+  explicit EventStruct(taskIndex_t taskIndex) : TaskIndex(taskIndex) {}
+
+  Sensor_VType getSensorType() const { return hostTasks[TaskIndex].sensorType; }
+
+  taskIndex_t TaskIndex;
+};
+
+inline uint8_t getValueCountForTask(taskIndex_t TaskIndex) { return hostTasks[TaskIndex].valueCount; }
+
+inline const String& getTaskDeviceName(taskIndex_t TaskIndex) { return hostTasks[TaskIndex].name; }
+
+struct UserVarStruct {
+  template<typename T>
+  T get(taskIndex_t TaskIndex, taskVarIndex_t varNr) const {
+    T res;
+
+    memcpy(&res, &hostTasks[TaskIndex].values[varNr], sizeof(res));
+    return res;
+  }
+
+  float    getFloat(taskIndex_t t, taskVarIndex_t v) const  { return get<float>(t, v); }
+  uint32_t getUint32(taskIndex_t t, taskVarIndex_t v) const { return get<uint32_t>(t, v); }
+  int32_t  getInt32(taskIndex_t t, taskVarIndex_t v) const  { return get<int32_t>(t, v); }
+  uint64_t getUint64(taskIndex_t t, taskVarIndex_t v) const { return get<uint64_t>(t, v); }
+  int64_t  getInt64(taskIndex_t t, taskVarIndex_t v) const  { return get<int64_t>(t, v); }
+
+  // Stored in the first 2 values
+  uint32_t getSensorTypeLong(taskIndex_t t) const { return get<uint32_t>(t, 0); }
+};
+
+extern UserVarStruct UserVar;
+
+struct Caches {
+  uint8_t getTaskDeviceValueDecimals(taskIndex_t t, uint8_t v) const { return hostTasks[t].decimals[v]; }
+  String  getTaskDeviceValueName(taskIndex_t t, uint8_t v) const     { return hostTasks[t].valueNames[v]; }
+};
+
+extern Caches Cache;
+
+struct SettingsStruct {
+  uint8_t Unit = 0;
+};
+
+extern SettingsStruct Settings;
+
+// System time, set by the test
+struct NodeTime {
+  bool     systemTimePresent() const { return timeSet; }
+  int      year() const   { return tm_year; }
+  int      month() const  { return tm_mon; }
+  int      day() const    { return tm_mday; }
+  int      hour() const   { return tm_hour; }
+  int      minute() const { return tm_min; }
+  int      second() const { return tm_sec; }
+
+  uint32_t getUnixTime(uint32_t& unix_time_frac) const {
+    unix_time_frac = frac;
+    return unixTime;
+  }
+
+  bool     timeSet = false;
+  int      tm_year = 0, tm_mon = 0, tm_mday = 0, tm_hour = 0, tm_min = 0, tm_sec = 0;
+  uint32_t unixTime = 0;
+  uint32_t frac     = 0;
+};
+
+extern NodeTime node_time;
+
+template<typename ... Args>
+String strformat(const __FlashStringHelper *format, Args... args) {
+  char buf[256];
+
+  snprintf(buf, sizeof(buf), reinterpret_cast<const char *>(format), args ...);
+  return String(buf);
+}
+
+template<typename T, typename U>
+String concat(const T& a, const U& b) {
+  String res(a);
+
+  res += String(b);
+  return res;
+}
+
+// As on ESP32
+inline String patch_fname(const String& fname) {
+  if (fname.startsWith(F("/"))) {
+    return fname;
+  }
+  return String('/') + fname;
+}
+
+#endif // ifndef PLUGIN_HELPER_H
@@ -0,0 +1,17 @@
+#include "_Plugin_Helper.h"
+
+#include "src/Helpers/ESPEasy_time_calc.h"
+
+HostTask       hostTasks[TASKS_MAX];
+UserVarStruct  UserVar;
+Caches         Cache;
+SettingsStruct Settings;
+NodeTime       node_time;
+String         lastErrorLog;
+
+const taskIndex_t INVALID_TASK_INDEX = TASKS_MAX;
+
+uint32_t unix_time_frac_to_millis(uint32_t unix_time_frac)
+{
+  return (static_cast<uint64_t>(unix_time_frac) * 1000ull) >> 32;
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+// Host build replacement for src/src/ESPEasyCore/ESPEasy_Log.h
+// The last error is kept for the test.
+
+#include "../../ESPEasy_common.h"
+
+#define LOG_LEVEL_NONE      0
+#define LOG_LEVEL_ERROR     1
+#define LOG_LEVEL_INFO      2
+#define LOG_LEVEL_DEBUG     3
+#define LOG_LEVEL_DEBUG_MORE 4
+#define LOG_LEVEL_DEBUG_DEV 9
+
+extern String lastErrorLog;
+
+inline bool loglevelActiveFor(uint8_t logLevel) { return logLevel == LOG_LEVEL_ERROR; }
+
+inline void addLog(uint8_t logLevel, const String& str) {
+  if (logLevel == LOG_LEVEL_ERROR) { lastErrorLog = str; }
+}
+
+inline void addToLogMove(uint8_t logLevel, String&& str) { addLog(logLevel, str); }
+
+#define addLogMove(L, S) addToLogMove(L, std::move(S))
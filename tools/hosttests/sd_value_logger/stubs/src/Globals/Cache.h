@@ -0,0 +1,8 @@
+#ifndef GLOBALS_CACHE_H
+#define GLOBALS_CACHE_H
+
+// Host build replacement for src/src/Globals/Cache.h, see _Plugin_Helper.h
+
+#include "../../_Plugin_Helper.h"
+
+#endif // ifndef GLOBALS_CACHE_H
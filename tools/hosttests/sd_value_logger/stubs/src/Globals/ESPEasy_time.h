@@ -0,0 +1,8 @@
+#ifndef GLOBALS_ESPEASY_TIME_H
+#define GLOBALS_ESPEASY_TIME_H
+
+// Host build replacement for src/src/Globals/ESPEasy_time.h, see _Plugin_Helper.h
+
+#include "../../_Plugin_Helper.h"
+
+#endif // ifndef GLOBALS_ESPEASY_TIME_H
@@ -0,0 +1,8 @@
+#ifndef GLOBALS_RUNTIMEDATA_H
+#define GLOBALS_RUNTIMEDATA_H
+
+// Host build replacement for src/src/Globals/RuntimeData.h, see _Plugin_Helper.h
+
+#include "../../_Plugin_Helper.h"
+
+#endif // ifndef GLOBALS_RUNTIMEDATA_H
@@ -0,0 +1,8 @@
+#ifndef GLOBALS_SETTINGS_H
+#define GLOBALS_SETTINGS_H
+
+// Host build replacement for src/src/Globals/Settings.h, see _Plugin_Helper.h
+
+#include "../../_Plugin_Helper.h"
+
+#endif // ifndef GLOBALS_SETTINGS_H
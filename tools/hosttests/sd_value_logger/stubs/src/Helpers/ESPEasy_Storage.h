@@ -0,0 +1,8 @@
+#ifndef HELPERS_ESPEASY_STORAGE_H
+#define HELPERS_ESPEASY_STORAGE_H
+
+// Host build replacement for src/src/Helpers/ESPEasy_Storage.h, see _Plugin_Helper.h
+
+#include "../../_Plugin_Helper.h"
+
+#endif // ifndef HELPERS_ESPEASY_STORAGE_H
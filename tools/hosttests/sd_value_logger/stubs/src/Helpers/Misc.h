@@ -0,0 +1,8 @@
+#ifndef HELPERS_MISC_H
+#define HELPERS_MISC_H
+
+// Host build replacement for src/src/Helpers/Misc.h, see _Plugin_Helper.h
+
+#include "../../_Plugin_Helper.h"
+
+#endif // ifndef HELPERS_MISC_H
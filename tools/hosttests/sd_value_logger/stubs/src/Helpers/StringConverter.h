@@ -0,0 +1,8 @@
+#ifndef HELPERS_STRINGCONVERTER_H
+#define HELPERS_STRINGCONVERTER_H
+
+// Host build replacement for src/src/Helpers/StringConverter.h, see _Plugin_Helper.h
+
+#include "../../_Plugin_Helper.h"
+
+#endif // ifndef HELPERS_STRINGCONVERTER_H
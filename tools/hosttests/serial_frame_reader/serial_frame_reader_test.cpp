@@ -0,0 +1,219 @@
+// Check of SerialFrameReader, as used by the serial plugins.
+//
+// The serial port is replaced by a mock (stubs/ESPeasySerial.h) which counts the calls made.
+// Checked:
+// - The byte stream API (available/peek/read) returns the received data unchanged,
+//   also when data arrives while reading, and available() includes the buffered bytes.
+// - The P053 way of syncing on the start of a packet with peek() and read().
+// - The framing modes, incl. fixed length frames with skipped LF (P087 ASCII mode),
+//   start byte sync and the dropped/truncated frame counters.
+// Shown are the calls to the serial port per received byte, reading per byte vs. via the reader.
+
+#include "src/Helpers/SerialFrameReader.h"
+
+#include <cstdio>
+#include <string>
+
+namespace {
+int failures = 0;
+
+void check(bool ok, const char *scenario, const char *what) {
+  if (!ok) {
+    ++failures;
+    printf("  %s: %s FAILED\n", scenario, what);
+  }
+}
+
+void result(const char *scenario, int failuresBefore) {
+  printf("%-40s %s\n", scenario, failures == failuresBefore ? "OK" : "FAILED");
+}
+
+std::string testData(size_t length) {
+  std::string res;
+
+  for (size_t i = 0; i < length; ++i) {
+    res += static_cast<char>((i * 7) & 0xFF);
+  }
+  return res;
+}
+
+// Collect all frames currently available
+std::string frames(SerialFrameReader& reader, ESPeasySerial& serial) {
+  std::string res;
+
+  reader.fill(serial);
+  const uint8_t *frame = nullptr;
+  size_t length        = 0;
+
+  while (reader.getFrame(frame, length)) {
+    res.append(reinterpret_cast<const char *>(frame), length);
+    res += '|';
+    reader.consumeFrame();
+  }
+  return res;
+}
+
+void stream_read() {
+  const char *scenario = "Stream read, data arriving in chunks";
+  const int   before   = failures;
+  const std::string data = testData(1000);
+
+  // Per byte, like the plugins did
+  ESPeasySerial perByte;
+  std::string   out;
+
+  for (size_t pos = 0; pos < data.size(); pos += 100) {
+    perByte.receive(data.substr(pos, 100));
+
+    while (perByte.available()) {
+      out += static_cast<char>(perByte.read());
+    }
+  }
+  check(out == data, scenario, "per byte data");
+
+  ESPeasySerial serial;
+  SerialFrameReader *reader = SerialFrameReader::create();
+
+  check(reader != nullptr, scenario, "create");
+
+  if (reader == nullptr) { return; }
+  out.clear();
+
+  for (size_t pos = 0; pos < data.size(); pos += 100) {
+    serial.receive(data.substr(pos, 50));
+    int available = reader->available(serial);
+
+    while (available > 0) {
+      out += static_cast<char>(reader->read(serial));
+      --available;
+
+      if (out.size() == pos + 10) {
+        // Data arriving while reading
+        serial.receive(data.substr(pos + 50, 50));
+        check(reader->available(serial) == 90, scenario, "available incl. buffered");
+        available = reader->available(serial);
+      }
+    }
+  }
+  check(out == data, scenario, "reader data");
+  check(reader->read(serial) == -1, scenario, "read when empty");
+  check(reader->peek(serial) == -1, scenario, "peek when empty");
+  check(reader->getStats().bytesReceived == data.size(), scenario, "bytes received");
+  result(scenario, before);
+  printf("  serial calls per byte: %.3f (per byte: %.3f)\n",
+         static_cast<double>(serial.calls) / data.size(),
+         static_cast<double>(perByte.calls) / data.size());
+  delete reader;
+}
+
+// Like P053_data_struct::packetAvailable()
+void packet_sync() {
+  const char *scenario = "Packet sync with peek (P053)";
+  const int   before   = failures;
+  const size_t packetSize = 32;
+  std::string packet("\x42\x4d", 2);
+
+  packet += testData(packetSize - 2);
+
+  ESPeasySerial serial;
+  SerialFrameReader *reader = SerialFrameReader::create(packetSize);
+
+  if (reader == nullptr) { return; }
+
+  // Garbage, a packet in 2 parts, then the next packet
+  serial.receive(std::string("\x01\x02\x4d", 3) + packet.substr(0, 20));
+  std::string received;
+  int packets = 0;
+
+  for (int call = 0; call < 3; ++call) {
+    if (call == 1) { serial.receive(packet.substr(20) + packet); }
+
+    while (reader->available(serial)) {
+      if (received.empty()) {
+        while ((reader->peek(serial) != 0x42) && reader->available(serial)) {
+          reader->read(serial);
+        }
+
+        if (reader->peek(serial) != 0x42) { break; }
+      }
+      received += static_cast<char>(reader->read(serial));
+
+      if (received.size() == packetSize) {
+        check(received == packet, scenario, "packet data");
+        ++packets;
+        received.clear();
+      }
+    }
+  }
+  check(packets == 2, scenario, "nr of packets");
+  check(reader->bytesBuffered() == 0, scenario, "all read");
+  result(scenario, before);
+  delete reader;
+}
+
+void framing() {
+  const char *scenario = "Delimiter, skip LF (P087 ASCII)";
+  int before           = failures;
+  ESPeasySerial serial;
+  SerialFrameReader reader(64);
+
+  reader.setSkipByte(10);
+  reader.setDelimiter(13);
+  serial.receive("abc\r\ndef\r\ngh");
+  check(frames(reader, serial) == "abc|def|", scenario, "frames");
+  serial.receive("i\r\n");
+  check(frames(reader, serial) == "ghi|", scenario, "frame in 2 parts");
+  result(scenario, before);
+
+  scenario = "Fixed length, skip LF (P087 ASCII)";
+  before   = failures;
+  reader.setFixedLength(5);
+  serial.receive("12345\n67890\n123");
+  check(frames(reader, serial) == "12345|67890|", scenario, "frames");
+  check(reader.bytesBuffered() == 3, scenario, "incomplete frame kept");
+  reader.clear();
+  result(scenario, before);
+
+  scenario = "Fixed length with start byte";
+  before   = failures;
+  reader.setSkipByte(-1);
+  reader.setFixedLength(4);
+  reader.setStartByte('S');
+  serial.receive("xxSabcySdefS");
+  check(frames(reader, serial) == "Sabc|Sdef|", scenario, "frames");
+  serial.receive("gh");
+  check(frames(reader, serial) == "", scenario, "incomplete frame");
+  serial.receive("i");
+  check(frames(reader, serial) == "Sghi|", scenario, "frame in 2 parts");
+  reader.setStartByte(-1);
+  result(scenario, before);
+
+  scenario = "Length prefixed, frame too long dropped";
+  before   = failures;
+  reader.setLengthPrefixed(1, 1, 0, false);
+  serial.receive(std::string("H\x03" "abcH\xC8", 7));
+  check(frames(reader, serial) == "H\x03" "abc|", scenario, "frames");
+  check(reader.getStats().dropped == 1, scenario, "dropped");
+  serial.receive(std::string("H\x01" "x", 3));
+  check(frames(reader, serial) == "H\x01x|", scenario, "resync");
+  result(scenario, before);
+
+  scenario = "Max. frame length, truncated";
+  before   = failures;
+  reader.clearStats();
+  reader.setDelimiter(13);
+  reader.setMaxFrameLength(8);
+  serial.receive("0123456789AB\r");
+  check(frames(reader, serial) == "01234567|89AB|", scenario, "frames");
+  check(reader.getStats().truncated == 1, scenario, "truncated");
+  check(reader.getStats().framesReceived == 2, scenario, "frames received");
+  result(scenario, before);
+}
+} // namespace
+
+int main() {
+  stream_read();
+  packet_sync();
+  framing();
+  return failures == 0 ? 0 : 1;
+}
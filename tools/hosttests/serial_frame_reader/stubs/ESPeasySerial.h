@@ -0,0 +1,56 @@
+#ifndef ESPEASYSERIAL_H
+#define ESPEASYSERIAL_H
+
+// Host build replacement for the ESPeasySerial library.
+// Received data is added with receive(), the calls made are counted.
+
+#include <deque>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+class ESPeasySerial {
+public:
+
+  void receive(const std::string& data) {
+    rx.insert(rx.end(), data.begin(), data.end());
+  }
+
+  int available() {
+    ++calls;
+    return rx.size();
+  }
+
+  int peek() {
+    ++calls;
+    return rx.empty() ? -1 : rx.front();
+  }
+
+  int read() {
+    ++calls;
+
+    if (rx.empty()) { return -1; }
+    const uint8_t c = rx.front();
+
+    rx.pop_front();
+    return c;
+  }
+
+  int read(uint8_t *buffer, size_t size) {
+    ++calls;
+    size_t i = 0;
+
+    for (; i < size && !rx.empty(); ++i) {
+      buffer[i] = rx.front();
+      rx.pop_front();
+    }
+    return i;
+  }
+
+  std::deque<uint8_t> rx;
+
+  // Nr of calls to the functions above, which each take a lock or virtual call on the ESP
+  uint32_t calls = 0;
+};
+
+#endif // ifndef ESPEASYSERIAL_H
@@ -0,0 +1,121 @@
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+// Host build replacement for the Arduino core.
+// Time is simulated, see HostClock in host_clock.cpp.
+
+#include <algorithm>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "WString.h"
+
+using std::max;
+using std::min;
+
+#define PROGMEM
+#define IRAM_ATTR
+#define ICACHE_RAM_ATTR
+
+#define HIGH          1
+#define LOW           0
+#define INPUT         0x01
+#define OUTPUT        0x03
+#define INPUT_PULLUP  0x05
+
+#define RISING        0x01
+#define FALLING       0x02
+#define CHANGE        0x03
+
+typedef bool    boolean;
+typedef uint8_t byte;
+
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define bitWrite(value, bit, bitvalue) ((bitvalue) ? bitSet(value, bit) : bitClear(value, bit))
+
+#define _min(a, b) ((a) < (b) ? (a) : (b))
+#define _max(a, b) ((a) > (b) ? (a) : (b))
+
+#define PGM_P const char *
+#define pgm_read_byte(addr)  (*reinterpret_cast<const uint8_t *>(addr))
+#define pgm_read_dword(addr) (*reinterpret_cast<const uint32_t *>(addr))
+#define pgm_read_ptr(addr)   (*reinterpret_cast<const void * const *>(addr))
+#define strncpy_P            strncpy
+#define strlen_P             strlen
+#define strchr_P             strchr
+#define memcpy_P             memcpy
+#define PSTR(s)              (s)
+
+#include "IPAddress.h"
+
+class Print {
+public:
+
+  virtual ~Print() {}
+
+  virtual size_t write(uint8_t c) = 0;
+
+  virtual size_t write(const uint8_t *buffer, size_t size) {
+    size_t res = 0;
+
+    while (size--) {
+      res += write(*buffer++);
+    }
+    return res;
+  }
+
+  size_t print(const char *str) {
+    return write(reinterpret_cast<const uint8_t *>(str), strlen(str));
+  }
+
+  size_t print(const __FlashStringHelper *str) {
+    return print(reinterpret_cast<const char *>(str));
+  }
+};
+
+struct HostClock {
+  // Simulated time since boot
+  static uint64_t now_usec;
+
+  // Added to the time on each call to micros(), so busy waiting loops end.
+  static uint32_t tick_usec;
+
+  static void advance_usec(uint64_t usec);
+};
+
+unsigned long millis();
+unsigned long micros();
+uint64_t      micros64();
+void          delay(unsigned long ms);
+void          delayMicroseconds(unsigned int us);
+void          yield();
+
+inline void   noInterrupts() {}
+inline void   interrupts() {}
+
+// The interrupt handler attached last, to be called by the test
+struct HostInterrupt {
+  static void (*handler)(void *);
+  static void *arg;
+  static int   mode;
+};
+
+inline uint8_t digitalPinToInterrupt(uint8_t pin) { return pin; }
+void          attachInterruptArg(uint8_t pin,
+                                 void (*handler)(void *),
+                                 void *arg,
+                                 int mode);
+void          detachInterrupt(uint8_t pin);
+
+void          pinMode(uint8_t pin,
+                      uint8_t mode);
+void          digitalWrite(uint8_t pin,
+                           uint8_t val);
+
+#endif // ifndef ARDUINO_H
@@ -0,0 +1,3 @@
+#include "ESPEasy_common.h"
+
+const String EMPTY_STRING;
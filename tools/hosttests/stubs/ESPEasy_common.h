@@ -0,0 +1,31 @@
+#ifndef ESPEASY_COMMON_H
+#define ESPEASY_COMMON_H
+
+// Host build replacement for src/ESPEasy_common.h
+// Only provides what the sources compiled by run.sh need.
+
+// Emulate an ESP8266 build, unless the test selects ESP32
+#if !defined(ESP32) && !defined(ESP8266)
+# define ESP8266
+#endif // if !defined(ESP32) && !defined(ESP8266)
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Included via Arduino.h in the ESP build
+#include <initializer_list>
+
+#include "Arduino.h"
+
+extern const String EMPTY_STRING;
+
+#ifdef ESP32
+inline int64_t esp_timer_get_time() { return micros64(); }
+#endif // ifdef ESP32
+
+// From include/ESPEasy_config.h
+#define ISR_noInterrupts() noInterrupts();
+#define ISR_interrupts() interrupts();
+#define ESPEASY_VOLATILE(T)  volatile T
+
+#endif // ifndef ESPEASY_COMMON_H
@@ -0,0 +1,27 @@
+#ifndef IPADDRESS_H
+#define IPADDRESS_H
+
+// Host build replacement for the Arduino IPAddress class, IPv4 only.
+
+#include <stdint.h>
+#include <string.h>
+
+class IPAddress {
+public:
+
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _bytes{ a, b, c, d } {}
+
+  // In network byte order, like the ESP32 core
+  operator uint32_t() const {
+    uint32_t res;
+
+    memcpy(&res, _bytes, sizeof(res));
+    return res;
+  }
+
+private:
+
+  uint8_t _bytes[4];
+};
+
+#endif // ifndef IPADDRESS_H
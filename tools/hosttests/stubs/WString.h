@@ -0,0 +1,109 @@
+#ifndef WSTRING_H
+#define WSTRING_H
+
+// Host build replacement for the Arduino String class, backed by std::string.
+// Only the members used by the sources under test.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <string>
+
+class __FlashStringHelper;
+
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper *>(string_literal))
+#define FPSTR(pstr_pointer) (reinterpret_cast<const __FlashStringHelper *>(pstr_pointer))
+
+class String {
+public:
+
+  String() = default;
+  String(const char *cstr) : _s(cstr ? cstr : "") {}
+  String(const __FlashStringHelper *str) : _s(str ? reinterpret_cast<const char *>(str) : "") {}
+  String(const std::string& str) : _s(str) {}
+
+  String& operator=(char c) { _s.assign(1, c); return *this; }
+  explicit String(char c) : _s(1, c) {}
+  explicit String(int value, unsigned char base = 10);
+  explicit String(unsigned int value, unsigned char base = 10);
+  explicit String(long value, unsigned char base = 10);
+  explicit String(unsigned long value, unsigned char base = 10);
+  explicit String(long long value, unsigned char base = 10);
+  explicit String(unsigned long long value, unsigned char base = 10);
+  explicit String(float value, unsigned int decimalPlaces = 2);
+  explicit String(double value, unsigned int decimalPlaces = 2);
+
+  const char* c_str() const { return _s.c_str(); }
+  const char* begin() const { return _s.c_str(); }
+  unsigned int length() const { return _s.length(); }
+  bool isEmpty() const { return _s.empty(); }
+  bool reserve(unsigned int size) { _s.reserve(size); return true; }
+  void clear() { _s.clear(); }
+
+  bool concat(const char *cstr, unsigned int length) { _s.append(cstr, length); return true; }
+  bool concat(const String& str) { _s += str._s; return true; }
+  bool concat(const char *cstr) { _s += cstr; return true; }
+  bool concat(const __FlashStringHelper *str) { return concat(reinterpret_cast<const char *>(str)); }
+  bool concat(char c) { _s += c; return true; }
+
+  template<typename T>
+  bool concat(T value) { return concat(String(value)); }
+
+  template<typename T>
+  String& operator+=(const T& rhs) { concat(rhs); return *this; }
+
+  char operator[](unsigned int index) const { return index < _s.length() ? _s[index] : 0; }
+  char& operator[](unsigned int index) { return _s[index]; }
+  char charAt(unsigned int index) const { return (*this)[index]; }
+
+  bool operator==(const String& rhs) const { return _s == rhs._s; }
+  bool operator==(const char *rhs) const { return _s == rhs; }
+  bool operator!=(const String& rhs) const { return _s != rhs._s; }
+  bool operator!=(const char *rhs) const { return _s != rhs; }
+  bool operator<(const String& rhs) const { return _s < rhs._s; }
+  bool equals(const String& rhs) const { return _s == rhs._s; }
+  bool equalsIgnoreCase(const String& rhs) const;
+  int  compareTo(const String& rhs) const { return _s.compare(rhs._s); }
+
+  bool startsWith(const String& prefix) const { return _s.compare(0, prefix._s.length(), prefix._s) == 0; }
+  bool endsWith(const String& suffix) const;
+  int  indexOf(char c, unsigned int from = 0) const;
+  int  indexOf(const String& str, unsigned int from = 0) const;
+  int  lastIndexOf(char c) const;
+  String substring(unsigned int from) const { return substring(from, _s.length()); }
+  String substring(unsigned int from, unsigned int to) const;
+
+  void toLowerCase();
+  void toUpperCase();
+  void trim();
+  void replace(const String& find, const String& replace);
+  void replace(char find, char replace) { std::replace(_s.begin(), _s.end(), find, replace); }
+  void remove(unsigned int index) { if (index < _s.length()) { _s.erase(index); } }
+  void remove(unsigned int index, unsigned int count) { if (index < _s.length()) { _s.erase(index, count); } }
+
+  long  toInt() const { return strtol(_s.c_str(), nullptr, 10); }
+  float toFloat() const { return strtof(_s.c_str(), nullptr); }
+
+  void toCharArray(char *buf, unsigned int bufsize) const {
+    if (bufsize == 0) { return; }
+    const size_t len = std::min<size_t>(bufsize - 1, _s.length());
+
+    memcpy(buf, _s.data(), len);
+    buf[len] = 0;
+  }
+
+  // Access to the buffer, e.g. for tests
+  const std::string& str() const { return _s; }
+
+private:
+
+  std::string _s;
+};
+
+String operator+(const String& lhs, const String& rhs);
+String operator+(const String& lhs, const char *rhs);
+String operator+(const char *lhs, const String& rhs);
+String operator+(const String& lhs, char rhs);
+
+#endif // ifndef WSTRING_H
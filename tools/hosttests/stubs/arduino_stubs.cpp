@@ -0,0 +1,210 @@
+// Implementation of the Arduino stubs: String and a simulated clock.
+
+#include "Arduino.h"
+
+#include <ctype.h>
+
+uint64_t HostClock::now_usec  = 0;
+uint32_t HostClock::tick_usec = 1;
+
+void HostClock::advance_usec(uint64_t usec)
+{
+  now_usec += usec;
+}
+
+unsigned long millis()
+{
+  return static_cast<unsigned long>(HostClock::now_usec / 1000);
+}
+
+unsigned long micros()
+{
+  HostClock::now_usec += HostClock::tick_usec;
+  return static_cast<unsigned long>(HostClock::now_usec);
+}
+
+uint64_t micros64()
+{
+  HostClock::now_usec += HostClock::tick_usec;
+  return HostClock::now_usec;
+}
+
+void delay(unsigned long ms)
+{
+  HostClock::advance_usec(ms * 1000ull);
+}
+
+void delayMicroseconds(unsigned int us)
+{
+  HostClock::advance_usec(us);
+}
+
+void yield() {}
+
+void pinMode(uint8_t, uint8_t) {}
+
+void (*HostInterrupt::handler)(void *) = nullptr;
+void *HostInterrupt::arg               = nullptr;
+int   HostInterrupt::mode              = 0;
+
+void attachInterruptArg(uint8_t, void (*handler)(void *), void *arg, int mode)
+{
+  HostInterrupt::handler = handler;
+  HostInterrupt::arg     = arg;
+  HostInterrupt::mode    = mode;
+}
+
+void detachInterrupt(uint8_t)
+{
+  HostInterrupt::handler = nullptr;
+}
+
+void digitalWrite(uint8_t, uint8_t) {}
+
+namespace {
+std::string toBase(unsigned long long value, unsigned char base, bool negative)
+{
+  std::string res;
+
+  do {
+    const int digit = value % base;
+    res.insert(res.begin(), static_cast<char>(digit < 10 ? '0' + digit : 'a' + digit - 10));
+    value /= base;
+  } while (value != 0);
+
+  if (negative) { res.insert(res.begin(), '-'); }
+  return res;
+}
+
+std::string formatFloat(double value, unsigned int decimalPlaces)
+{
+  char buf[64];
+
+  snprintf(buf, sizeof(buf), "%.*f", decimalPlaces, value);
+  return buf;
+}
+} // namespace
+
+String::String(int value, unsigned char base) : String(static_cast<long long>(value), base) {}
+
+String::String(unsigned int value, unsigned char base) : String(static_cast<unsigned long long>(value), base) {}
+
+String::String(long value, unsigned char base) : String(static_cast<long long>(value), base) {}
+
+String::String(unsigned long value, unsigned char base) : String(static_cast<unsigned long long>(value), base) {}
+
+String::String(long long value, unsigned char base)
+  : _s(value < 0 && base == 10
+       ? toBase(-static_cast<unsigned long long>(value), base, true)
+       : toBase(static_cast<unsigned long long>(value), base, false)) {}
+
+String::String(unsigned long long value, unsigned char base) : _s(toBase(value, base, false)) {}
+
+String::String(float value, unsigned int decimalPlaces) : _s(formatFloat(value, decimalPlaces)) {}
+
+String::String(double value, unsigned int decimalPlaces) : _s(formatFloat(value, decimalPlaces)) {}
+
+bool String::equalsIgnoreCase(const String& rhs) const
+{
+  if (_s.length() != rhs._s.length()) { return false; }
+
+  for (size_t i = 0; i < _s.length(); ++i) {
+    if (tolower(_s[i]) != tolower(rhs._s[i])) { return false; }
+  }
+  return true;
+}
+
+bool String::endsWith(const String& suffix) const
+{
+  return _s.length() >= suffix._s.length() &&
+         _s.compare(_s.length() - suffix._s.length(), suffix._s.length(), suffix._s) == 0;
+}
+
+int String::indexOf(char c, unsigned int from) const
+{
+  const size_t pos = _s.find(c, from);
+
+  return pos == std::string::npos ? -1 : static_cast<int>(pos);
+}
+
+int String::indexOf(const String& str, unsigned int from) const
+{
+  const size_t pos = _s.find(str._s, from);
+
+  return pos == std::string::npos ? -1 : static_cast<int>(pos);
+}
+
+int String::lastIndexOf(char c) const
+{
+  const size_t pos = _s.rfind(c);
+
+  return pos == std::string::npos ? -1 : static_cast<int>(pos);
+}
+
+String String::substring(unsigned int from, unsigned int to) const
+{
+  if (from > to) { std::swap(from, to); }
+
+  if (from >= _s.length()) { return String(); }
+
+  if (to > _s.length()) { to = _s.length(); }
+  return String(_s.substr(from, to - from));
+}
+
+void String::toLowerCase()
+{
+  for (char& c : _s) { c = tolower(c); }
+}
+
+void String::toUpperCase()
+{
+  for (char& c : _s) { c = toupper(c); }
+}
+
+void String::trim()
+{
+  const size_t first = _s.find_first_not_of(" \t\r\n");
+
+  if (first == std::string::npos) {
+    _s.clear();
+    return;
+  }
+  _s = _s.substr(first, _s.find_last_not_of(" \t\r\n") - first + 1);
+}
+
+void String::replace(const String& find, const String& replace)
+{
+  if (find._s.empty()) { return; }
+  size_t pos = 0;
+
+  while ((pos = _s.find(find._s, pos)) != std::string::npos) {
+    _s.replace(pos, find._s.length(), replace._s);
+    pos += replace._s.length();
+  }
+}
+
+String operator+(const String& lhs, const String& rhs)
+{
+  String res(lhs);
+
+  res += rhs;
+  return res;
+}
+
+String operator+(const String& lhs, const char *rhs)
+{
+  return lhs + String(rhs);
+}
+
+String operator+(const char *lhs, const String& rhs)
+{
+  return String(lhs) + rhs;
+}
+
+String operator+(const String& lhs, char rhs)
+{
+  String res(lhs);
+
+  res += rhs;
+  return res;
+}
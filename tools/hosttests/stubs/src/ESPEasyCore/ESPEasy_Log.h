@@ -0,0 +1,21 @@
+#pragma once
+
+// Host build replacement for src/src/ESPEasyCore/ESPEasy_Log.h
+// Logging is not available, messages are dropped.
+
+#include "../../ESPEasy_common.h"
+
+#define LOG_LEVEL_NONE      0
+#define LOG_LEVEL_ERROR     1
+#define LOG_LEVEL_INFO      2
+#define LOG_LEVEL_DEBUG     3
+#define LOG_LEVEL_DEBUG_MORE 4
+#define LOG_LEVEL_DEBUG_DEV 9
+
+inline bool loglevelActiveFor(uint8_t) { return false; }
+
+inline void addLog(uint8_t, const String&) {}
+
+inline void addToLogMove(uint8_t, String&&) {}
+
+#define addLogMove(L, S) addToLogMove(L, std::move(S))
@@ -0,0 +1,13 @@
+#pragma once
+
+// Host build replacement for src/ESPEasy/net/ESPEasyNetwork.h
+
+#include "../../ESPEasy_common.h"
+
+namespace ESPEasy {
+namespace net {
+inline bool   NetworkConnected(bool force = false) { return true; }
+
+inline String NetworkCreateRFCCompliantHostname(bool force_add_unitnr = false) { return F("host-1"); }
+} // namespace net
+} // namespace ESPEasy
@@ -0,0 +1,6 @@
+#pragma once
+
+// Host build replacement for src/ESPEasy/net/Globals/NetworkState.h
+
+// No system time, so no timestamps in the syslog messages
+constexpr bool statusNTPInitialized = false;
@@ -0,0 +1,18 @@
+#ifndef WIFIUDP_H
+#define WIFIUDP_H
+
+// Host build replacement for WiFiUdp.h, only the TCP transport is tested.
+
+#include "Arduino.h"
+#include "IPAddress.h"
+
+class WiFiUDP : public Print {
+public:
+
+  int    beginPacket(const IPAddress&, uint16_t) { return 0; }
+  int    endPacket() { return 0; }
+  size_t write(uint8_t) override { return 0; }
+  size_t write(const uint8_t *, size_t) override { return 0; }
+};
+
+#endif // ifndef WIFIUDP_H
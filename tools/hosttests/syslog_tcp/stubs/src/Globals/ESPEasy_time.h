@@ -0,0 +1,22 @@
+#ifndef GLOBALS_ESPEASY_TIME_H
+#define GLOBALS_ESPEASY_TIME_H
+
+// Host build replacement for src/src/Globals/ESPEasy_time.h, only used when the system time is set.
+
+#include "../Helpers/ESPEasy_time_calc.h"
+
+#include <time.h>
+
+struct ESPEasy_time {
+  static String month_str(int) { return String(); }
+
+  uint32_t systemMicros_to_Unixtime(const int64_t&, uint32_t&) const { return 0; }
+
+  uint32_t systemMicros_to_Localtime(const int64_t&, uint32_t&) const { return 0; }
+
+  int64_t  internalTimestamp_to_systemMicros(const uint32_t&) const { return 0; }
+};
+
+extern ESPEasy_time node_time;
+
+#endif // GLOBALS_ESPEASY_TIME_H
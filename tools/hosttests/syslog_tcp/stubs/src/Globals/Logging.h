@@ -0,0 +1,37 @@
+#ifndef GLOBALS_LOGGING_H
+#define GLOBALS_LOGGING_H
+
+// Host build replacement for src/src/Globals/Logging.h
+// The log buffer is a queue of messages, filled by the test.
+
+#include "../../ESPEasy_common.h"
+
+#include "../DataTypes/LogLevels.h"
+
+#include <deque>
+
+// From src/src/DataStructs/LogEntry.h
+#define LOG_BUFFER_EXPIRE  30000
+
+struct HostLogging {
+  bool getNext(LogDestination, uint32_t& timestamp, String& message, uint8_t& loglevel) {
+    if (messages.empty()) { return false; }
+    timestamp = millis() + 1;
+    message   = messages.front();
+    loglevel  = LOG_LEVEL_INFO;
+    messages.pop_front();
+    return true;
+  }
+
+  uint32_t getNrMessages(LogDestination) const { return messages.size(); }
+
+  uint32_t getNrDropped(LogDestination) const { return 0; }
+
+  std::deque<String> messages;
+};
+
+extern HostLogging Logging;
+
+inline bool loglevelActiveFor(LogDestination, uint8_t) { return true; }
+
+#endif // GLOBALS_LOGGING_H
@@ -0,0 +1,20 @@
+#ifndef GLOBALS_SETTINGS_H
+#define GLOBALS_SETTINGS_H
+
+// Host build replacement for src/src/Globals/Settings.h, only the syslog settings.
+
+#include "../../ESPEasy_common.h"
+
+struct SettingsStruct {
+  uint8_t SyslogTransport() const { return _syslogTransport; }
+
+  uint8_t  Syslog_IP[4] = { 127, 0, 0, 1 };
+  uint8_t  SyslogLevel  = LOG_LEVEL_INFO;
+  uint8_t  SyslogFacility{};
+  uint16_t SyslogPort{};
+  uint8_t  _syslogTransport{};
+};
+
+extern SettingsStruct Settings;
+
+#endif // GLOBALS_SETTINGS_H
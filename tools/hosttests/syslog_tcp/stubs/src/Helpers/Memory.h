@@ -0,0 +1,8 @@
+#ifndef HELPERS_MEMORY_H
+#define HELPERS_MEMORY_H
+
+// Host build replacement for src/src/Helpers/Memory.h
+
+#include "../../ESPEasy_common.h"
+
+#endif // ifndef HELPERS_MEMORY_H
@@ -0,0 +1,15 @@
+#ifndef HELPERS_NETWORKING_H
+#define HELPERS_NETWORKING_H
+
+// Host build replacement for src/src/Helpers/Networking.h
+
+#include "../../ESPEasy_common.h"
+
+#include <WiFiUdp.h>
+
+inline bool beginWiFiUDP_randomPort(WiFiUDP&) { return false; }
+
+// From src/src/Helpers/Misc.h
+inline void FeedSW_watchdog() {}
+
+#endif // ifndef HELPERS_NETWORKING_H
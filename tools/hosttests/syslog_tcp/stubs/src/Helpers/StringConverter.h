@@ -0,0 +1,22 @@
+#ifndef HELPERS_STRINGCONVERTER_H
+#define HELPERS_STRINGCONVERTER_H
+
+// Host build replacement for src/src/Helpers/StringConverter.h
+
+#include "../../ESPEasy_common.h"
+
+template<typename ... Args>
+String strformat(const String& format, Args... args) {
+  const int len = snprintf(nullptr, 0, format.c_str(), args ...);
+
+  if (len <= 0) { return String(); }
+  std::string res(len + 1, '\0');
+
+  snprintf(&res[0], res.size(), format.c_str(), args ...);
+  res.resize(len);
+  return String(res);
+}
+
+inline void free_string(String& str) { str = String(); }
+
+#endif // ifndef HELPERS_STRINGCONVERTER_H
@@ -0,0 +1,11 @@
+#include "src/Globals/ESPEasy_time.h"
+#include "src/Globals/Logging.h"
+#include "src/Globals/Settings.h"
+
+HostLogging    Logging;
+SettingsStruct Settings;
+ESPEasy_time   node_time;
+
+uint32_t unix_time_frac_to_millis(uint32_t) { return 0; }
+
+void     breakTime(unsigned long, struct tm&) {}
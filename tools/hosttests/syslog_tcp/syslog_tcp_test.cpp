@@ -0,0 +1,360 @@
+// Check of the TCP transport of the syslog client (src/src/Helpers/SyslogWriter.cpp),
+// using the ESP32 implementation of SyslogTCPClient on host sockets, as lwIP follows the BSD socket API.
+//
+// A syslog server is run in the test on 127.0.0.1, the log buffer is a queue of messages (stubs/src/Globals/Logging.h).
+// Checked:
+// - Each message arrives as one RFC6587 octet-counted frame "MSG-LEN SP SYSLOG-MSG" with the RFC5424 prefix.
+// - A server which does not read fills the send buffer: process() must not block
+//   and the frames must continue where they were cut off.
+// - A connect to an unreachable server does not block, the failure is counted after the connect timeout,
+//   and a new connect is only tried after SYSLOG_TCP_RECONNECT_INTERVAL.
+// - A connection closed by the server is detected, the next connection starts with a complete frame.
+// Shown are the max. duration of a process() call and the nr. of calls while the send buffer was full.
+
+#include "src/Helpers/SyslogWriter.h"
+
+#include "src/Globals/Logging.h"
+#include "src/Globals/Settings.h"
+
+#include <arpa/inet.h>
+#include <chrono>
+#include <csignal>
+#include <cstdio>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <string>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+int failures = 0;
+
+void check(bool ok, const char *scenario, const char *what) {
+  if (!ok) {
+    ++failures;
+    printf("  %s: %s FAILED\n", scenario, what);
+  }
+}
+
+void result(const char *scenario, int failuresBefore) {
+  printf("%-40s %s\n", scenario, failures == failuresBefore ? "OK" : "FAILED");
+}
+
+// Syslog server on 127.0.0.1, the data of each accepted connection is kept
+struct Server {
+  explicit Server(int receiveBuffer = 0) {
+    listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    const int one = 1;
+
+    setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+    if (receiveBuffer != 0) {
+      // Inherited by the accepted connections
+      setsockopt(listenFd, SOL_SOCKET, SO_RCVBUF, &receiveBuffer, sizeof(receiveBuffer));
+    }
+    sockaddr_in addr{};
+
+    addr.sin_family      = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    bind(listenFd, reinterpret_cast<sockaddr *>(&addr), sizeof(addr));
+    listen(listenFd, 4);
+    fcntl(listenFd, F_SETFL, O_NONBLOCK);
+
+    socklen_t length = sizeof(addr);
+
+    getsockname(listenFd, reinterpret_cast<sockaddr *>(&addr), &length);
+    port = ntohs(addr.sin_port);
+  }
+
+  ~Server() {
+    closeConnection();
+    close(listenFd);
+  }
+
+  // Accept a new connection and read all available data
+  void poll(bool read = true) {
+    const int fd = accept(listenFd, nullptr, nullptr);
+
+    if (fd >= 0) {
+      closeConnection();
+      fcntl(fd, F_SETFL, O_NONBLOCK);
+      conn = fd;
+      connections.emplace_back();
+    }
+
+    if (!read || (conn < 0)) { return; }
+    char buf[4096];
+    int  res;
+
+    while ((res = recv(conn, buf, sizeof(buf), 0)) > 0) {
+      connections.back().append(buf, res);
+    }
+  }
+
+  void closeConnection() {
+    if (conn >= 0) {
+      close(conn);
+      conn = -1;
+    }
+  }
+
+  int      listenFd = -1;
+  int      conn     = -1;
+  uint16_t port{};
+  std::vector<std::string> connections;
+};
+
+// Split RFC6587 octet-counted frames, false when the data is not valid.
+// An incomplete frame at the end is allowed when the connection was closed.
+bool parseFrames(const std::string& data, std::vector<std::string>& frames, bool allowIncomplete = false) {
+  size_t pos = 0;
+
+  while (pos < data.size()) {
+    const size_t space = data.find(' ', pos);
+
+    if ((space == std::string::npos) || (space == pos) || (space - pos > 5)) { return allowIncomplete && space == std::string::npos; }
+
+    for (size_t i = pos; i < space; ++i) {
+      if ((data[i] < '0') || (data[i] > '9')) { return false; }
+    }
+    const size_t length = std::stoul(data.substr(pos, space - pos));
+
+    if (space + 1 + length > data.size()) { return allowIncomplete; }
+    frames.push_back(data.substr(space + 1, length));
+    pos = space + 1 + length;
+  }
+  return true;
+}
+
+const std::string prefix = "<5>1 - host-1 EspEasy - - - ";
+
+std::string message(int nr, size_t length) {
+  std::string res = "Message " + std::to_string(nr) + " ";
+
+  while (res.size() < length) { res += static_cast<char>('a' + (res.size() % 26)); }
+  return res;
+}
+
+void setup(uint16_t port) {
+  Settings._syslogTransport = SYSLOG_TRANSPORT_TCP;
+  Settings.SyslogPort       = port;
+  Settings.Syslog_IP[0]     = 127;
+  Settings.Syslog_IP[1]     = 0;
+  Settings.Syslog_IP[2]     = 0;
+  Settings.Syslog_IP[3]     = 1;
+  Logging.messages.clear();
+}
+
+double maxProcessMsec = 0.0;
+
+bool process(SyslogWriter& writer) {
+  const auto start = std::chrono::steady_clock::now();
+  const bool res   = writer.process();
+  const double ms  = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+  maxProcessMsec = std::max(maxProcessMsec, ms);
+  return res;
+}
+
+void framing() {
+  const char *scenario = "Octet-counted frames";
+  const int   before   = failures;
+  Server server;
+  SyslogWriter writer(LOG_TO_SYSLOG);
+  std::vector<std::string> expected;
+
+  setup(server.port);
+
+  for (int i = 0; i < 200; ++i) {
+    expected.push_back(message(i, 20 + (i * 37) % 900));
+    Logging.messages.push_back(String(expected.back()));
+  }
+
+  for (int i = 0; i < 100 && writer.getStats().messagesSent < expected.size(); ++i) {
+    process(writer);
+    server.poll();
+    HostClock::advance_usec(10000);
+  }
+  server.poll();
+
+  std::vector<std::string> frames;
+
+  check(server.connections.size() == 1, scenario, "one connection");
+  check(!server.connections.empty() && parseFrames(server.connections[0], frames), scenario, "frame format");
+  check(frames.size() == expected.size(), scenario, "nr of frames");
+
+  for (size_t i = 0; i < frames.size() && i < expected.size(); ++i) {
+    if (frames[i] != prefix + expected[i]) {
+      check(false, scenario, "frame content");
+      break;
+    }
+  }
+  check(writer.getStats().messagesSent == expected.size(), scenario, "messages sent");
+  result(scenario, before);
+}
+
+void server_not_reading() {
+  const char *scenario = "Server not reading, send buffer full";
+  const int   before   = failures;
+  Server server(4096);
+  SyslogWriter writer(LOG_TO_SYSLOG);
+  const int nrMessages = 20000;
+
+  setup(server.port);
+
+  for (int i = 0; i < nrMessages; ++i) {
+    Logging.messages.push_back(String(message(i, 400)));
+  }
+
+  // Connect, then fill the send buffer
+  maxProcessMsec = 0.0;
+  int callsFull = 0;
+
+  for (int i = 0; i < 20; ++i) {
+    process(writer);
+    server.poll(false);
+    HostClock::advance_usec(10000);
+
+    if ((i >= 2) && !Logging.messages.empty()) { ++callsFull; }
+  }
+  const uint32_t sentWhileFull = writer.getStats().messagesSent;
+
+  check(!Logging.messages.empty() && (sentWhileFull < nrMessages), scenario, "send buffer full");
+  check(maxProcessMsec < 100.0, scenario, "process() does not block");
+  printf("  max. process(): %.2f ms  calls with full send buffer: %d  messages sent: %u of %d\n",
+         maxProcessMsec, callsFull, sentWhileFull, nrMessages);
+
+  // Server reads again
+  for (int i = 0; i < 10000 && (!Logging.messages.empty() || writer.getStats().messagesSent < nrMessages); ++i) {
+    process(writer);
+    server.poll();
+    HostClock::advance_usec(10000);
+  }
+  usleep(10000);
+  server.poll();
+
+  std::vector<std::string> frames;
+
+  check(server.connections.size() == 1 && parseFrames(server.connections[0], frames), scenario, "frame format");
+  check(frames.size() == nrMessages, scenario, "all frames received");
+  check(!frames.empty() && frames.back() == prefix + message(nrMessages - 1, 400), scenario, "last frame");
+  result(scenario, before);
+}
+
+void unreachable() {
+  const char *scenario = "Unreachable server";
+  const int   before   = failures;
+  SyslogWriter writer(LOG_TO_SYSLOG);
+
+  // Not routed, so the connect stays pending or fails at once
+  setup(514);
+  Settings.Syslog_IP[0] = 10;
+  Settings.Syslog_IP[1] = 255;
+  Settings.Syslog_IP[2] = 255;
+  Settings.Syslog_IP[3] = 1;
+  Logging.messages.push_back(F("lost"));
+
+  maxProcessMsec = 0.0;
+  process(writer);
+  process(writer);
+  const bool pending = writer.getStats().connectFailures == 0;
+
+  HostClock::advance_usec((SYSLOG_TCP_CONNECT_TIMEOUT + 10) * 1000ull);
+  process(writer);
+  check(writer.getStats().connectFailures == 1, scenario, "failure after connect timeout");
+
+  // Refused, no new connect before the reconnect interval
+  {
+    Server closed;
+    Settings.SyslogPort = closed.port;
+  }
+  Settings.Syslog_IP[0] = 127;
+  Settings.Syslog_IP[1] = 0;
+  Settings.Syslog_IP[2] = 0;
+  Settings.Syslog_IP[3] = 1;
+  HostClock::advance_usec((SYSLOG_TCP_RECONNECT_INTERVAL - SYSLOG_TCP_CONNECT_TIMEOUT - 100) * 1000ull);
+  process(writer);
+  process(writer);
+  check(writer.getStats().connectFailures == 1, scenario, "no connect within reconnect interval");
+  HostClock::advance_usec(200 * 1000ull);
+
+  for (int i = 0; i < 5; ++i) {
+    process(writer);
+    usleep(1000);
+  }
+  check(writer.getStats().connectFailures == 2, scenario, "refused connect");
+  check(maxProcessMsec < 20.0, scenario, "process() does not block");
+  check(writer.getStats().messagesSent == 0, scenario, "nothing sent");
+  result(scenario, before);
+  printf("  connect %s, max. process(): %.2f ms\n", pending ? "pending until timeout" : "failed at once", maxProcessMsec);
+}
+
+void server_closes() {
+  const char *scenario = "Connection closed by server";
+  const int   before   = failures;
+  Server server(4096);
+  SyslogWriter writer(LOG_TO_SYSLOG);
+  const int nrMessages = 20000;
+
+  setup(server.port);
+
+  for (int i = 0; i < nrMessages; ++i) {
+    Logging.messages.push_back(String(message(i, 300)));
+  }
+
+  // Read a part, then close the connection while frames are pending
+  for (int i = 0; i < 5; ++i) {
+    process(writer);
+    server.poll(i > 2);
+    HostClock::advance_usec(10000);
+  }
+  server.closeConnection();
+  const size_t pendingBefore = Logging.messages.size();
+
+  for (int i = 0; i < 2000 && (!Logging.messages.empty() || server.connections.size() < 2); ++i) {
+    process(writer);
+    server.poll();
+    HostClock::advance_usec(10000);
+  }
+  usleep(10000);
+  server.poll();
+
+  std::vector<std::string> first, second;
+
+  check(server.connections.size() == 2, scenario, "reconnected");
+  check(pendingBefore > 0, scenario, "messages pending when closed");
+
+  if (server.connections.size() == 2) {
+    check(parseFrames(server.connections[0], first, true), scenario, "first connection frames");
+    check(parseFrames(server.connections[1], second), scenario, "second connection starts with a frame");
+    check(!second.empty() && second.back() == prefix + message(nrMessages - 1, 300), scenario, "last frame");
+  }
+  result(scenario, before);
+  printf("  frames: %u before close, %u after reconnect, %d messages\n",
+         static_cast<unsigned>(first.size()), static_cast<unsigned>(second.size()), nrMessages);
+}
+} // namespace
+
+int main() {
+  // A blocking write would hang the test
+  signal(SIGALRM, [](int) {
+    const char msg[] = "Timeout, process() blocked FAILED\n";
+    fflush(stdout);
+    write(STDOUT_FILENO, msg, sizeof(msg) - 1);
+    _exit(1);
+  });
+  alarm(60);
+
+  // Writing to a closed connection, no SIGPIPE in lwIP
+  signal(SIGPIPE, SIG_IGN);
+
+  HostClock::tick_usec = 0;
+  HostClock::advance_usec(1000000);
+
+  framing();
+  server_not_reading();
+  unreachable();
+  server_closes();
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,18 @@
+#ifndef GLOBALS_ESPEASY_TIME_H
+#define GLOBALS_ESPEASY_TIME_H
+
+// Host build replacement for src/src/Globals/ESPEasy_time.h
+// Only the static helper functions, implemented in time_zone_stubs.cpp
+
+#include "../../ESPEasy_common.h"
+
+class ESPEasy_time {
+public:
+
+  static int year(unsigned long t);
+
+  // 1 = Sunday
+  static int weekday(unsigned long t);
+};
+
+#endif // ifndef GLOBALS_ESPEASY_TIME_H
@@ -0,0 +1,17 @@
+#ifndef GLOBALS_SETTINGS_H
+#define GLOBALS_SETTINGS_H
+
+// Host build replacement for src/src/Globals/Settings.h
+
+#include "../../ESPEasy_common.h"
+
+struct SettingsStruct {
+  int16_t  TimeZone{};
+  bool     DST{};
+  uint16_t DST_Start{};
+  uint16_t DST_End{};
+};
+
+extern SettingsStruct Settings;
+
+#endif // ifndef GLOBALS_SETTINGS_H
@@ -0,0 +1,17 @@
+#ifndef HELPERS_ESPEASY_TIME_CALC_H
+#define HELPERS_ESPEASY_TIME_CALC_H
+
+// Host build replacement for src/src/Helpers/ESPEasy_time_calc.h
+// Implemented in time_zone_stubs.cpp, using the C library as reference.
+
+#include "../../ESPEasy_common.h"
+
+#include <time.h>
+
+uint32_t makeTime(const struct tm& tm);
+
+// tm_wday: 1 = Sunday, like ESPEasy
+void     breakTime(unsigned long timeInput,
+                   struct tm   & tm);
+
+#endif // ifndef HELPERS_ESPEASY_TIME_CALC_H
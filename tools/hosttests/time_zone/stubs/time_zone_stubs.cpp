@@ -0,0 +1,38 @@
+// Implementation of the stub headers, using the C library as reference.
+
+#include "src/Globals/ESPEasy_time.h"
+#include "src/Globals/Settings.h"
+#include "src/Helpers/ESPEasy_time_calc.h"
+
+SettingsStruct Settings;
+
+uint32_t makeTime(const struct tm& tm)
+{
+  struct tm tmp = tm;
+
+  return static_cast<uint32_t>(timegm(&tmp));
+}
+
+void breakTime(unsigned long timeInput, struct tm& tm)
+{
+  const time_t t = static_cast<time_t>(static_cast<uint32_t>(timeInput));
+
+  gmtime_r(&t, &tm);
+  tm.tm_wday += 1;
+}
+
+int ESPEasy_time::year(unsigned long t)
+{
+  struct tm tmp;
+
+  breakTime(t, tmp);
+  return 1900 + tmp.tm_year;
+}
+
+int ESPEasy_time::weekday(unsigned long t)
+{
+  struct tm tmp;
+
+  breakTime(t, tmp);
+  return tmp.tm_wday;
+}
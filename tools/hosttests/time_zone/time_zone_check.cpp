@@ -0,0 +1,198 @@
+// Check of ESPEasy_time_zone::toLocal() and fromLocal() against a reference implementation,
+// plus a benchmark.
+//
+// The reference computes the time change points of the year and the DST state on each call,
+// like toLocal()/fromLocal() did before the time change points of the year were cached.
+//
+// Checked for several time zones (northern/southern hemisphere, no DST):
+// - Every 599 sec. from 2020 till 2037.
+// - +/- 2 sec. around each time change, given in UTC and in local time.
+// - Random times, so the cached year is often not valid.
+// - Changing the time zone on an object with a cached year.
+
+#include "Helpers/ESPEasy_time_zone.h"
+
+#include "Globals/ESPEasy_time.h"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+namespace {
+class RefTimeZone {
+public:
+
+  void setTimeZone(const TimeChangeRule& dstStart, const TimeChangeRule& stdStart, uint32_t curTime) {
+    _tz.setTimeZone(dstStart, stdStart, curTime);
+  }
+
+  uint32_t toLocal(uint32_t utc) {
+    if (ESPEasy_time::year(utc) != ESPEasy_time::year(_tz.m_dstUTC)) { _tz.calcTimeChanges(ESPEasy_time::year(utc)); }
+
+    if (_tz.utcIsDST(utc)) {
+      return utc + _tz.m_dst.offset * 60;
+    }
+    return utc + _tz.m_std.offset * 60;
+  }
+
+  uint32_t fromLocal(uint32_t local) {
+    if (ESPEasy_time::year(local) != ESPEasy_time::year(_tz.m_dstUTC)) { _tz.calcTimeChanges(ESPEasy_time::year(local)); }
+
+    if (_tz.locIsDST(local)) {
+      return local - _tz.m_dst.offset * 60;
+    }
+    return local - _tz.m_std.offset * 60;
+  }
+
+  ESPEasy_time_zone _tz;
+};
+
+struct Zone {
+  const char    *name;
+  TimeChangeRule dst;
+  TimeChangeRule std;
+};
+
+const Zone zones[] = {
+  { "CET",   { TimeChangeRule::Last,   TimeChangeRule::Sun, TimeChangeRule::Mar, 2, 120  }, { TimeChangeRule::Last,  TimeChangeRule::Sun, TimeChangeRule::Oct, 3, 60   } },
+  { "UK",    { TimeChangeRule::Last,   TimeChangeRule::Sun, TimeChangeRule::Mar, 1, 60   }, { TimeChangeRule::Last,  TimeChangeRule::Sun, TimeChangeRule::Oct, 2, 0    } },
+  { "US-E",  { TimeChangeRule::Second, TimeChangeRule::Sun, TimeChangeRule::Mar, 2, -240 }, { TimeChangeRule::First, TimeChangeRule::Sun, TimeChangeRule::Nov, 2, -300 } },
+  { "AUS-E", { TimeChangeRule::First,  TimeChangeRule::Sun, TimeChangeRule::Oct, 2, 660  }, { TimeChangeRule::First, TimeChangeRule::Sun, TimeChangeRule::Apr, 3, 600  } },
+  { "NZ",    { TimeChangeRule::Last,   TimeChangeRule::Sun, TimeChangeRule::Sep, 2, 780  }, { TimeChangeRule::First, TimeChangeRule::Sun, TimeChangeRule::Apr, 3, 720  } },
+  { "US-AZ", { TimeChangeRule::Second, TimeChangeRule::Sun, TimeChangeRule::Mar, 2, -420 }, { TimeChangeRule::First, TimeChangeRule::Sun, TimeChangeRule::Nov, 2, -420 } },
+  { "UTC",   { TimeChangeRule::Last,   TimeChangeRule::Sun, TimeChangeRule::Mar, 1, 0    }, { TimeChangeRule::Last,  TimeChangeRule::Sun, TimeChangeRule::Mar, 1, 0    } },
+};
+
+constexpr uint32_t start2020 = 1577836800u;
+constexpr uint32_t start2026 = 1767225600u;
+constexpr uint32_t start2027 = 1798761600u;
+constexpr uint32_t start2038 = 2145916800u;
+constexpr uint32_t curTime   = 1790000000u;
+
+uint64_t nrChecks     = 0;
+uint64_t nrMismatches = 0;
+
+void check(const char *name, RefTimeZone& ref, ESPEasy_time_zone& tz, uint32_t t)
+{
+  const uint32_t refLocal = ref.toLocal(t);
+  const uint32_t local    = tz.toLocal(t);
+  const uint32_t refUTC   = ref.fromLocal(t);
+  const uint32_t utc      = tz.fromLocal(t);
+
+  nrChecks += 2;
+
+  if ((refLocal != local) || (refUTC != utc)) {
+    if (nrMismatches < 10) {
+      printf("%s: t=%u toLocal: %u (ref: %u) fromLocal: %u (ref: %u)\n", name, t, local, refLocal, utc, refUTC);
+    }
+    ++nrMismatches;
+  }
+}
+
+double benchmark(uint32_t (*convert)(void *, uint32_t), void *tz, const uint32_t *times, size_t count)
+{
+  volatile uint32_t sink  = 0;
+  const auto        start = std::chrono::steady_clock::now();
+
+  for (size_t i = 0; i < count; ++i) {
+    sink = sink + convert(tz, times[i]);
+  }
+  const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+  return elapsed.count() / count;
+}
+
+template<typename T>
+uint32_t toLocal(void *tz, uint32_t t)
+{
+  return static_cast<T *>(tz)->toLocal(t);
+}
+} // namespace
+
+int main()
+{
+  std::mt19937 gen(1);
+  std::uniform_int_distribution<uint32_t> randomTime(start2020, start2038 - 1);
+
+  for (const Zone& zone : zones) {
+    RefTimeZone       ref;
+    ESPEasy_time_zone tz;
+
+    ref.setTimeZone(zone.dst, zone.std, curTime);
+    tz.setTimeZone(zone.dst, zone.std, curTime);
+
+    for (uint32_t t = start2020; t < start2038; t += 599) {
+      check(zone.name, ref, tz, t);
+    }
+
+    for (int year = 2020; year < 2038; ++year) {
+      RefTimeZone points;
+      points.setTimeZone(zone.dst, zone.std, curTime);
+      points._tz.calcTimeChanges(year);
+
+      for (const uint32_t p : { points._tz.m_dstUTC, points._tz.m_stdUTC, points._tz.m_dstLoc, points._tz.m_stdLoc }) {
+        for (int d = -2; d <= 2; ++d) {
+          check(zone.name, ref, tz, p + d);
+        }
+      }
+    }
+
+    for (int i = 0; i < 100000; ++i) {
+      check(zone.name, ref, tz, randomTime(gen));
+    }
+  }
+
+  // Time zone changed while a year is cached
+  {
+    RefTimeZone       ref;
+    ESPEasy_time_zone tz;
+
+    for (int i = 0; i < 1000; ++i) {
+      const Zone& zone = zones[i % (sizeof(zones) / sizeof(zones[0]))];
+      ref.setTimeZone(zone.dst, zone.std, curTime);
+      tz.setTimeZone(zone.dst, zone.std, curTime);
+
+      const uint32_t t = randomTime(gen);
+
+      for (int d = 0; d < 3; ++d) {
+        check(zone.name, ref, tz, t + d);
+      }
+    }
+  }
+
+  printf("Checked: %llu  mismatches: %llu\n",
+         static_cast<unsigned long long>(nrChecks),
+         static_cast<unsigned long long>(nrMismatches));
+
+  // Benchmark toLocal() for consecutive seconds (typical use), random times within a year and random times
+  {
+    constexpr size_t count = 2000000;
+    static uint32_t  sequential[count];
+    static uint32_t  sameYear[count];
+    static uint32_t  random[count];
+    std::uniform_int_distribution<uint32_t> randomTime2026(start2026, start2027 - 1);
+
+    for (size_t i = 0; i < count; ++i) {
+      sequential[i] = curTime + i;
+      sameYear[i]   = randomTime2026(gen);
+      random[i]     = randomTime(gen);
+    }
+
+    RefTimeZone       ref;
+    ESPEasy_time_zone tz;
+    ref.setTimeZone(zones[0].dst, zones[0].std, curTime);
+    tz.setTimeZone(zones[0].dst, zones[0].std, curTime);
+
+    printf("toLocal() sequential: %6.1f ns/call (ref: %6.1f ns/call)\n",
+           benchmark(toLocal<ESPEasy_time_zone>, &tz, sequential, count),
+           benchmark(toLocal<RefTimeZone>, &ref, sequential, count));
+    printf("toLocal() same year:  %6.1f ns/call (ref: %6.1f ns/call)\n",
+           benchmark(toLocal<ESPEasy_time_zone>, &tz, sameYear, count),
+           benchmark(toLocal<RefTimeZone>, &ref, sameYear, count));
+    printf("toLocal() random:     %6.1f ns/call (ref: %6.1f ns/call)\n",
+           benchmark(toLocal<ESPEasy_time_zone>, &tz, random, count),
+           benchmark(toLocal<RefTimeZone>, &ref, random, count));
+  }
+
+  return (nrMismatches == 0) ? 0 : 1;
+}
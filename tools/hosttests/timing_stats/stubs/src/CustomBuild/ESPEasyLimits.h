@@ -0,0 +1,14 @@
+#ifndef CUSTOMBUILD_ESPEASYLIMITS_H
+#define CUSTOMBUILD_ESPEASYLIMITS_H
+
+// Host build replacement for src/src/CustomBuild/ESPEasyLimits.h
+
+#define TASKS_MAX                  32
+#define CONTROLLER_MAX             3
+#define DEVICE_INDEX_MAX           255
+#define PLUGIN_MAX                 255
+#define CPLUGIN_MAX                255
+#define NETWORKDRIVER_INDEX_MAX    255
+#define NWPLUGIN_MAX               255
+
+#endif // ifndef CUSTOMBUILD_ESPEASYLIMITS_H
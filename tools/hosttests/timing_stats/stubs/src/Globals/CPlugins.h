@@ -0,0 +1,9 @@
+#ifndef GLOBALS_CPLUGINS_H
+#define GLOBALS_CPLUGINS_H
+
+// Host build replacement for src/src/Globals/CPlugins.h
+
+#include "../DataTypes/CPluginID.h"
+#include "../DataTypes/ProtocolIndex.h"
+
+#endif // ifndef GLOBALS_CPLUGINS_H
@@ -0,0 +1,22 @@
+#ifndef GLOBALS_SETTINGS_H
+#define GLOBALS_SETTINGS_H
+
+// Host build replacement for src/src/Globals/Settings.h
+// Only the timing stats setting.
+
+#include "../../ESPEasy_common.h"
+
+#include "../DataTypes/TaskIndex.h"
+
+// From src/src/Globals/Plugins.h
+#define validTaskIndex(X) ((X) < (TASKS_MAX))
+
+struct SettingsStruct {
+  bool EnableTimingStats() const { return enableTimingStats; }
+
+  bool enableTimingStats = true;
+};
+
+extern SettingsStruct Settings;
+
+#endif // ifndef GLOBALS_SETTINGS_H
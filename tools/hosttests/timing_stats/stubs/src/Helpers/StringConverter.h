@@ -0,0 +1,16 @@
+#ifndef HELPERS_STRINGCONVERTER_H
+#define HELPERS_STRINGCONVERTER_H
+
+// Host build replacement for src/src/Helpers/StringConverter.h
+
+#include "../../ESPEasy_common.h"
+
+template<typename T, typename U>
+String concat(const T& a, const U& b) {
+  String res(a);
+
+  res += b;
+  return res;
+}
+
+#endif // ifndef HELPERS_STRINGCONVERTER_H
@@ -0,0 +1,11 @@
+#ifndef HELPERS__CPLUGIN_HELPER_H
+#define HELPERS__CPLUGIN_HELPER_H
+
+// Host build replacement for src/src/Helpers/_CPlugin_Helper.h
+// Only what the timing stats names need.
+
+#include "../../ESPEasy_common.h"
+
+inline String get_formatted_Controller_number(int controller) { return String(controller); }
+
+#endif // ifndef HELPERS__CPLUGIN_HELPER_H
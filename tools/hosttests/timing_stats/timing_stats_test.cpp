@@ -0,0 +1,219 @@
+// Check of the TimingStats histogram, used for the percentiles on the timing stats page.
+//
+// Checked:
+// - Bucket index and lower bound of the log-bucketed histogram match for all durations.
+// - Estimated percentiles lie in the same bucket as the exact percentiles of the samples.
+// - Halving all buckets when one is full keeps the percentiles.
+// - The histogram is only allocated on the first add(), freed by reset(),
+//   and copies of the stats have their own histogram.
+// Shown are the size of an instance, the histogram size and the time per add().
+
+#include "src/DataStructs/TimingStats.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <vector>
+
+SettingsStruct Settings;
+
+namespace {
+int allocations = 0;
+}
+
+// Count the allocations made by TimingStats
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+  ++allocations;
+  return malloc(size);
+}
+
+void operator delete[](void *ptr) noexcept {
+  free(ptr);
+}
+
+namespace {
+int failures = 0;
+
+void check(bool ok, const char *scenario, const char *what) {
+  if (!ok) {
+    ++failures;
+    printf("  %s: %s FAILED\n", scenario, what);
+  }
+}
+
+void result(const char *scenario, int failuresBefore) {
+  printf("%-40s %s\n", scenario, failures == failuresBefore ? "OK" : "FAILED");
+}
+
+// Exact percentile, same rank definition as TimingStats::getPercentile()
+uint32_t exactPercentile(std::vector<uint32_t> samples, uint8_t percentile) {
+  std::sort(samples.begin(), samples.end());
+  const size_t rank = (samples.size() * percentile + 99) / 100;
+
+  return samples[rank == 0 ? 0 : rank - 1];
+}
+
+void buckets() {
+  const char *scenario = "Bucket index and lower bound";
+  const int   before   = failures;
+  uint8_t     prevIndex = 0;
+
+  for (uint32_t duration = 0; duration < (1u << (TIMING_STATS_MAX_BUCKET_MSB + 2)); ++duration) {
+    const uint8_t index = TimingStats::getBucketIndex(duration);
+
+    if (index >= TIMING_STATS_NR_BUCKETS) {
+      check(false, scenario, "index in range");
+      break;
+    }
+
+    if ((index != prevIndex) && (index != prevIndex + 1)) {
+      check(false, scenario, "indices contiguous");
+      break;
+    }
+
+    if ((index != prevIndex) || (duration == 0)) {
+      // First duration of a bucket
+      check(TimingStats::getBucketLowerBound(index) == duration, scenario, "lower bound");
+    }
+    prevIndex = index;
+  }
+  check(prevIndex == TIMING_STATS_NR_BUCKETS - 1, scenario, "all buckets used");
+  check(TimingStats::getBucketIndex(0xFFFFFFFF) == TIMING_STATS_NR_BUCKETS - 1, scenario, "overflow bucket");
+  result(scenario, before);
+}
+
+bool sameBucket(uint32_t estimate, uint32_t exact) {
+  return TimingStats::getBucketIndex(estimate) == TimingStats::getBucketIndex(exact);
+}
+
+void percentiles() {
+  const char *scenario = "Percentiles vs. exact";
+  const int   before   = failures;
+  std::mt19937 rnd(1);
+
+  // Loop like durations: mostly short, with a long tail
+  std::lognormal_distribution<double> lognormal(6.0, 1.2);
+  std::vector<uint32_t> samples;
+  TimingStats stats;
+
+  for (int i = 0; i < 10000; ++i) {
+    const uint32_t duration = static_cast<uint32_t>(lognormal(rnd));
+    samples.push_back(duration);
+    stats.add(duration);
+  }
+  const uint8_t checked[] = { 1, 10, 50, 90, 95, 99, 100 };
+
+  for (uint8_t p : checked) {
+    const uint32_t exact    = exactPercentile(samples, p);
+    const uint32_t estimate = stats.getPercentile(p);
+
+    check(sameBucket(estimate, exact), scenario, "estimate in bucket of exact");
+
+    if (p == 100) {
+      check(estimate == exact, scenario, "P100 is max");
+    }
+    printf("  P%-3u exact %7u  estimate %7u\n", p, exact, estimate);
+  }
+
+  // Constant duration must be reported exactly
+  TimingStats constant;
+
+  for (int i = 0; i < 100; ++i) {
+    constant.add(1234);
+  }
+  check(constant.getPercentile(50) == 1234, scenario, "constant duration");
+  check(TimingStats().getPercentile(50) == 0, scenario, "empty stats");
+  result(scenario, before);
+}
+
+void overflow() {
+  const char *scenario = "Halving on full bucket";
+  const int   before   = failures;
+  TimingStats stats;
+  std::vector<uint32_t> samples;
+
+  // 3/4 short, 1/4 long; more than 0xFFFF in a bucket
+  for (int i = 0; i < 200000; ++i) {
+    const uint32_t duration = (i % 4 == 3) ? 5000 : 100;
+    samples.push_back(duration);
+    stats.add(duration);
+  }
+
+  uint32_t minVal, maxVal;
+
+  check(stats.getMinMax(minVal, maxVal) == 200000, scenario, "count");
+  check(sameBucket(stats.getPercentile(50), exactPercentile(samples, 50)), scenario, "P50");
+  check(sameBucket(stats.getPercentile(70), exactPercentile(samples, 70)), scenario, "P70");
+  check(sameBucket(stats.getPercentile(80), exactPercentile(samples, 80)), scenario, "P80");
+  result(scenario, before);
+}
+
+void allocation() {
+  const char *scenario = "Histogram allocated on first use";
+  const int   before   = failures;
+  const int   start    = allocations;
+
+  TimingStats stats[TASKS_MAX];
+
+  check(allocations == start, scenario, "not allocated when unused");
+  check(stats[0].getPercentile(50) == 0, scenario, "unused percentile");
+
+  stats[0].add(100);
+  stats[0].add(200);
+  check(allocations == start + 1, scenario, "allocated once");
+
+  // Copy must have its own histogram
+  TimingStats copy(stats[0]);
+
+  check(allocations == start + 2, scenario, "copy allocated");
+  stats[0].reset();
+  copy.add(300);
+  check(copy.getPercentile(100) == 300, scenario, "copy after reset of original");
+  check(sameBucket(copy.getPercentile(1), 100), scenario, "copy keeps histogram");
+
+  // Assigning empty stats frees the histogram
+  copy = stats[1];
+  check(copy.isEmpty(), scenario, "assign empty");
+  stats[0].add(100);
+  check(allocations == start + 3, scenario, "allocated again after reset");
+  result(scenario, before);
+  printf("  instance: %u bytes  histogram: %u bytes (%u buckets)\n",
+         static_cast<unsigned>(sizeof(TimingStats)),
+         static_cast<unsigned>(TIMING_STATS_NR_BUCKETS * sizeof(uint16_t)),
+         static_cast<unsigned>(TIMING_STATS_NR_BUCKETS));
+}
+
+void benchmark() {
+  std::mt19937 rnd(2);
+  std::vector<int32_t> durations(4096);
+
+  for (auto& d : durations) {
+    d = rnd() % 100000;
+  }
+  TimingStats stats;
+  const int   rounds = 2000;
+  const auto  start  = std::chrono::steady_clock::now();
+
+  for (int r = 0; r < rounds; ++r) {
+    for (int32_t d : durations) {
+      stats.add(d);
+    }
+  }
+  const auto end = std::chrono::steady_clock::now();
+  const double ns = std::chrono::duration<double, std::nano>(end - start).count() / (rounds * durations.size());
+
+  printf("add(): %.1f ns\n", ns);
+}
+} // namespace
+
+int main() {
+  buckets();
+  percentiles();
+  overflow();
+  allocation();
+  benchmark();
+  return failures == 0 ? 0 : 1;
+}